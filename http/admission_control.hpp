@@ -0,0 +1,298 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include "http_response.hpp"
+#include "logging.hpp"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/container/flat_map.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace crow
+{
+
+// Limits the connections and in-flight requests that are accepted, both in
+// total and from any one client, so that one misbehaving client can't starve
+// every other.  Requests over a limit are answered with 503 (server wide
+// limits) or 429 (per client limits) and a Retry-After header, rather than
+// being dropped.  Shared by every HTTP thread.
+class AdmissionControl
+{
+  public:
+    // A limit of 0 means unlimited
+    struct Limits
+    {
+        size_t maxConnections = 0;
+        size_t maxConnectionsPerClient = 0;
+        size_t maxRequests = 0;
+        size_t maxRequestsPerClient = 0;
+        // Connections over a connection limit that are kept open long enough
+        // to be told to retry.  Past this, they're closed straight away.
+        size_t acceptQueue = 0;
+    };
+
+    struct Counters
+    {
+        size_t connections = 0;
+        size_t requests = 0;
+        size_t queuedConnections = 0;
+        uint64_t connectionsRejected = 0;
+        uint64_t connectionsDropped = 0;
+        uint64_t requestsRejected = 0;
+    };
+
+    enum class Decision
+    {
+        Admit,
+        // Over a server wide limit; respond 503
+        Busy,
+        // Over a per client limit; respond 429
+        TooManyRequests,
+        // The accept queue is full too; close without responding
+        Drop,
+    };
+
+    // Holds an admitted connection or request, or a place in the accept
+    // queue, until destroyed
+    class Ticket
+    {
+      public:
+        Ticket() = default;
+        ~Ticket()
+        {
+            release();
+        }
+
+        Ticket(const Ticket&) = delete;
+        Ticket& operator=(const Ticket&) = delete;
+
+        Ticket(Ticket&& other) noexcept :
+            control(std::exchange(other.control, nullptr)), kind(other.kind),
+            decision(other.decision), client(other.client)
+        {}
+
+        Ticket& operator=(Ticket&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                control = std::exchange(other.control, nullptr);
+                kind = other.kind;
+                decision = other.decision;
+                client = other.client;
+            }
+            return *this;
+        }
+
+        Decision getDecision() const
+        {
+            return decision;
+        }
+
+        bool admitted() const
+        {
+            return decision == Decision::Admit;
+        }
+
+      private:
+        friend class AdmissionControl;
+
+        enum class Kind
+        {
+            Connection,
+            Request,
+        };
+
+        void release()
+        {
+            if (control != nullptr)
+            {
+                control->release(*this);
+                control = nullptr;
+            }
+        }
+
+        AdmissionControl* control = nullptr;
+        Kind kind = Kind::Connection;
+        Decision decision = Decision::Admit;
+        boost::asio::ip::address client;
+    };
+
+    explicit AdmissionControl(const Limits& limitsIn) : limits(limitsIn) {}
+
+    AdmissionControl(const AdmissionControl&) = delete;
+    AdmissionControl& operator=(const AdmissionControl&) = delete;
+    AdmissionControl(AdmissionControl&&) = delete;
+    AdmissionControl& operator=(AdmissionControl&&) = delete;
+    ~AdmissionControl() = default;
+
+    static AdmissionControl& getInstance()
+    {
+        static AdmissionControl admissionControl(Limits{
+            .maxConnections = BMCWEB_HTTP_MAX_CONNECTIONS,
+            .maxConnectionsPerClient = BMCWEB_HTTP_MAX_CONNECTIONS_PER_CLIENT,
+            .maxRequests = BMCWEB_HTTP_MAX_REQUESTS,
+            .maxRequestsPerClient = BMCWEB_HTTP_MAX_REQUESTS_PER_CLIENT,
+            .acceptQueue = BMCWEB_HTTP_ACCEPT_QUEUE,
+        });
+        return admissionControl;
+    }
+
+    Ticket admitConnection(const boost::asio::ip::address& client)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ClientCount& clientCount = clients[client];
+        Decision decision = Decision::Admit;
+        if (overLimit(counters.connections, limits.maxConnections))
+        {
+            decision = Decision::Busy;
+        }
+        else if (overLimit(clientCount.connections,
+                           limits.maxConnectionsPerClient))
+        {
+            decision = Decision::TooManyRequests;
+        }
+
+        if (decision == Decision::Admit)
+        {
+            counters.connections++;
+            clientCount.connections++;
+            return makeTicket(this, Ticket::Kind::Connection, decision,
+                              client);
+        }
+        eraseIfUnused(client);
+        if (counters.queuedConnections >= limits.acceptQueue)
+        {
+            counters.connectionsDropped++;
+            return makeTicket(nullptr, Ticket::Kind::Connection,
+                              Decision::Drop, client);
+        }
+        counters.queuedConnections++;
+        counters.connectionsRejected++;
+        return makeTicket(this, Ticket::Kind::Connection, decision, client);
+    }
+
+    Ticket admitRequest(const boost::asio::ip::address& client)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ClientCount& clientCount = clients[client];
+        Decision decision = Decision::Admit;
+        if (overLimit(counters.requests, limits.maxRequests))
+        {
+            decision = Decision::Busy;
+        }
+        else if (overLimit(clientCount.requests, limits.maxRequestsPerClient))
+        {
+            decision = Decision::TooManyRequests;
+        }
+
+        if (decision != Decision::Admit)
+        {
+            counters.requestsRejected++;
+            eraseIfUnused(client);
+            return makeTicket(nullptr, Ticket::Kind::Request, decision,
+                              client);
+        }
+        counters.requests++;
+        clientCount.requests++;
+        return makeTicket(this, Ticket::Kind::Request, decision, client);
+    }
+
+    Counters getCounters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return counters;
+    }
+
+    // Fills in the response for a connection or request that wasn't admitted
+    static void setRejectedResponse(Response& res, Decision decision)
+    {
+        if (decision == Decision::TooManyRequests)
+        {
+            res.result(boost::beast::http::status::too_many_requests);
+        }
+        else
+        {
+            res.result(boost::beast::http::status::service_unavailable);
+        }
+        res.addHeader(boost::beast::http::field::retry_after,
+                      std::to_string(BMCWEB_HTTP_RETRY_AFTER));
+    }
+
+  private:
+    struct ClientCount
+    {
+        size_t connections = 0;
+        size_t requests = 0;
+    };
+
+    static bool overLimit(size_t count, size_t limit)
+    {
+        return limit != 0 && count >= limit;
+    }
+
+    static Ticket makeTicket(AdmissionControl* control, Ticket::Kind kind,
+                             Decision decision,
+                             const boost::asio::ip::address& client)
+    {
+        Ticket ticket;
+        ticket.control = control;
+        ticket.kind = kind;
+        ticket.decision = decision;
+        ticket.client = client;
+        return ticket;
+    }
+
+    void eraseIfUnused(const boost::asio::ip::address& client)
+    {
+        auto it = clients.find(client);
+        if (it != clients.end() && it->second.connections == 0 &&
+            it->second.requests == 0)
+        {
+            clients.erase(it);
+        }
+    }
+
+    void release(const Ticket& ticket)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (ticket.kind == Ticket::Kind::Connection &&
+            ticket.decision != Decision::Admit)
+        {
+            counters.queuedConnections--;
+            return;
+        }
+        auto it = clients.find(ticket.client);
+        if (it == clients.end())
+        {
+            BMCWEB_LOG_CRITICAL("Released a ticket for an unknown client");
+            return;
+        }
+        if (ticket.kind == Ticket::Kind::Connection)
+        {
+            counters.connections--;
+            it->second.connections--;
+        }
+        else
+        {
+            counters.requests--;
+            it->second.requests--;
+        }
+        eraseIfUnused(ticket.client);
+    }
+
+    const Limits limits;
+    mutable std::mutex mutex;
+    Counters counters;
+    boost::container::flat_map<boost::asio::ip::address, ClientCount> clients;
+};
+
+} // namespace crow
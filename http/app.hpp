@@ -9,9 +9,11 @@
 #include "utility.hpp"
 
 #include <systemd/sd-daemon.h>
+#include <unistd.h>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/stream.hpp>
 
@@ -21,11 +23,14 @@
 #include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage, clang-diagnostic-unused-macros)
 #define BMCWEB_ROUTE(app, url)                                                 \
-    app.template route<crow::utility::getParameterTag(url)>(url)
+    app.template route<crow::utility::getParameterTag(url),                    \
+                       crow::utility::isSegmentRoute(url)>(url)
 
 namespace crow
 {
@@ -58,12 +63,36 @@ class App
                        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                        Adaptor&& adaptor)
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!io->get_executor().running_in_this_thread())
+            {
+                boost::asio::post(*io, [this, req, asyncResp,
+                                        adaptor(std::forward<Adaptor>(
+                                            adaptor))]() mutable {
+                    router.handleUpgrade(req, asyncResp, std::move(adaptor));
+                });
+                return;
+            }
+        }
         router.handleUpgrade(req, asyncResp, std::forward<Adaptor>(adaptor));
     }
 
     void handle(const std::shared_ptr<Request>& req,
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            // Requests accepted on a worker thread are routed on the main
+            // io_context, which owns D-Bus and the rest of the shared state.
+            if (!io->get_executor().running_in_this_thread())
+            {
+                boost::asio::post(*io, [this, req, asyncResp]() {
+                    router.handle(req, asyncResp);
+                });
+                return;
+            }
+        }
         router.handle(req, asyncResp);
     }
 
@@ -72,9 +101,11 @@ class App
         return router.newRuleDynamic(rule);
     }
 
-    template <uint64_t Tag>
+    template <uint64_t Tag, bool IsSegmentRoute = true>
     auto& route(std::string&& rule)
     {
+        static_assert(IsSegmentRoute,
+                      "Route parameters must span a whole path segment");
         return router.newRuleTagged<Tag>(std::move(rule));
     }
 
@@ -100,6 +131,7 @@ class App
             {
                 BMCWEB_LOG_INFO("Starting webserver on socket handle {}",
                                 SD_LISTEN_FDS_START);
+                socketActivated = true;
                 return boost::asio::ip::tcp::acceptor(
                     *io, boost::asio::ip::tcp::v6(), SD_LISTEN_FDS_START);
             }
@@ -108,9 +140,88 @@ class App
                 defaultPort);
         }
         BMCWEB_LOG_INFO("Starting webserver on port {}", defaultPort);
-        return boost::asio::ip::tcp::acceptor(
-            *io, boost::asio::ip::tcp::endpoint(
-                     boost::asio::ip::make_address("0.0.0.0"), defaultPort));
+        boost::asio::ip::tcp::endpoint endpoint(
+            boost::asio::ip::make_address("0.0.0.0"), defaultPort);
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            return openReusePortAcceptor(*io, endpoint);
+        }
+        return boost::asio::ip::tcp::acceptor(*io, endpoint);
+    }
+
+    using reuse_port =
+        boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+
+    static std::optional<boost::asio::ip::tcp::acceptor>
+        openReusePortAcceptor(boost::asio::io_context& ioCtx,
+                              const boost::asio::ip::tcp::endpoint& endpoint)
+    {
+        boost::asio::ip::tcp::acceptor acceptor(ioCtx);
+        boost::system::error_code ec;
+        acceptor.open(endpoint.protocol(), ec);
+        if (!ec)
+        {
+            acceptor.set_option(
+                boost::asio::ip::tcp::acceptor::reuse_address(true), ec);
+        }
+        if (!ec)
+        {
+            acceptor.set_option(reuse_port(true), ec);
+        }
+        if (!ec)
+        {
+            acceptor.bind(endpoint, ec);
+        }
+        if (!ec)
+        {
+            acceptor.listen(boost::asio::socket_base::max_listen_connections,
+                            ec);
+        }
+        if (ec)
+        {
+            BMCWEB_LOG_CRITICAL("Failed to listen on port {}: {}",
+                                endpoint.port(), ec.message());
+            return std::nullopt;
+        }
+        return acceptor;
+    }
+
+    // Worker acceptors listen on the same port as the main one.  A socket
+    // handed over by systemd can't be re-bound, so workers share a duplicate
+    // of it instead of getting their own SO_REUSEPORT socket.
+    std::optional<boost::asio::ip::tcp::acceptor>
+        setupWorkerSocket(boost::asio::io_context& workerIo,
+                          boost::asio::ip::tcp::acceptor& mainAcceptor)
+    {
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::endpoint endpoint =
+            mainAcceptor.local_endpoint(ec);
+        if (ec)
+        {
+            BMCWEB_LOG_CRITICAL("Failed to get listen endpoint: {}",
+                                ec.message());
+            return std::nullopt;
+        }
+        if (!socketActivated)
+        {
+            return openReusePortAcceptor(workerIo, endpoint);
+        }
+        int fd = dup(mainAcceptor.native_handle());
+        if (fd < 0)
+        {
+            BMCWEB_LOG_CRITICAL("Failed to duplicate listen socket");
+            return std::nullopt;
+        }
+        boost::asio::ip::tcp::acceptor acceptor(workerIo);
+        acceptor.assign(endpoint.protocol(), fd, ec);
+        if (ec)
+        {
+            BMCWEB_LOG_CRITICAL("Failed to assign listen socket: {}",
+                                ec.message());
+            ::close(fd);
+            return std::nullopt;
+        }
+        return acceptor;
     }
 
     void run()
@@ -123,13 +234,55 @@ class App
             BMCWEB_LOG_CRITICAL("Couldn't start server");
             return;
         }
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            createWorkers(*acceptor);
+        }
         server.emplace(this, std::move(*acceptor), sslContext, io);
         server->run();
+
+        // The main server has loaded the certificate by now
+        for (std::unique_ptr<Worker>& worker : workers)
+        {
+            worker->thread = std::thread(
+                [thisWorker(worker.get()), sslCtx(sslContext)]() mutable {
+                thisWorker->server->setSslContext(std::move(sslCtx));
+                thisWorker->server->runWorker();
+                thisWorker->io->run();
+            });
+        }
+    }
+
+    void createWorkers(boost::asio::ip::tcp::acceptor& mainAcceptor)
+    {
+        for (int index = 1; index < BMCWEB_HTTP_THREADS; index++)
+        {
+            std::unique_ptr<Worker> worker = std::make_unique<Worker>();
+            std::optional<boost::asio::ip::tcp::acceptor> acceptor =
+                setupWorkerSocket(*worker->io, mainAcceptor);
+            if (!acceptor)
+            {
+                BMCWEB_LOG_ERROR("Couldn't start HTTP worker {}", index);
+                return;
+            }
+            worker->server.emplace(this, std::move(*acceptor), sslContext,
+                                   worker->io);
+            workers.emplace_back(std::move(worker));
+        }
     }
 
     void stop()
     {
         io->stop();
+        for (std::unique_ptr<Worker>& worker : workers)
+        {
+            worker->io->stop();
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+        workers.clear();
     }
 
     void debugPrint()
@@ -148,11 +301,28 @@ class App
         return router.getRoutes(parent);
     }
 
+    const Router& getRouter() const
+    {
+        return router;
+    }
+
     App& ssl(std::shared_ptr<boost::asio::ssl::context>&& ctx)
     {
         sslContext = std::move(ctx);
         BMCWEB_LOG_INFO("app::ssl context use_count={}",
                         sslContext.use_count());
+        // Certificate reloads on SIGHUP need to reach the running workers
+        for (std::unique_ptr<Worker>& worker : workers)
+        {
+            if (!worker->thread.joinable())
+            {
+                continue;
+            }
+            boost::asio::post(*worker->io, [thisWorker(worker.get()),
+                                            sslCtx(sslContext)]() mutable {
+                thisWorker->server->setSslContext(std::move(sslCtx));
+            });
+        }
         return *this;
     }
 
@@ -168,6 +338,17 @@ class App
 
     std::optional<server_type> server;
 
+    // Additional HTTP threads, each with its own io_context and acceptor.
+    struct Worker
+    {
+        std::shared_ptr<boost::asio::io_context> io =
+            std::make_shared<boost::asio::io_context>();
+        std::optional<server_type> server;
+        std::thread thread;
+    };
+    std::vector<std::unique_ptr<Worker>> workers;
+    bool socketActivated = false;
+
     Router router;
 };
 } // namespace crow
@@ -0,0 +1,477 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BMCWEB_BASE64_X86 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BMCWEB_BASE64_NEON 1
+#endif
+
+// Vector kernels for the bulk of base64 encoding and decoding.  Each kernel
+// only handles whole blocks of input, and leaves the rest, padding, and any
+// error handling, to the scalar code in utility.hpp.  x86 kernels are picked
+// at runtime from what the CPU supports; NEON is used whenever the build
+// targets it.
+
+namespace crow
+{
+namespace utility
+{
+
+enum class Base64Kernel
+{
+    Scalar,
+    Ssse3,
+    Avx2,
+    Neon,
+};
+
+// Encodes whole 3 byte groups from the front of in, and returns how many
+// bytes were consumed.  out must have room for 4 chars per 3 bytes consumed.
+using Base64EncodeBlocks = size_t (*)(const char* in, size_t size, char* out);
+
+// Decodes whole 4 char groups from the front of in, stopping before the first
+// group with padding, or with a character outside the alphabet, and returns
+// how many chars were consumed.  out must have room for 3 bytes per 4 chars
+// consumed, and 4 more, which may be written with junk.
+using Base64DecodeBlocks = size_t (*)(const char* in, size_t size, char* out);
+
+struct Base64Kernels
+{
+    Base64Kernel kernel;
+    Base64EncodeBlocks encode;
+    Base64DecodeBlocks decode;
+};
+
+namespace base64_kernels
+{
+
+inline size_t encodeScalar(const char* /*in*/, size_t /*size*/, char* /*out*/)
+{
+    return 0;
+}
+
+inline size_t decodeScalar(const char* /*in*/, size_t /*size*/, char* /*out*/)
+{
+    return 0;
+}
+
+#ifdef BMCWEB_BASE64_X86
+
+// Splits 12 bytes, in the low 12 bytes of the vector, into 16 six bit
+// indexes, and maps them to the base64 alphabet
+__attribute__((target("ssse3"))) inline __m128i encodeSsse3Block(__m128i in)
+{
+    in = _mm_shuffle_epi8(
+        in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    __m128i indexes = _mm_or_si128(t1, t3);
+
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12; each of
+    // which picks the offset from index to character
+    __m128i reduced = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+    __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indexes);
+    reduced = _mm_or_si128(reduced,
+                           _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+    __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, reduced), indexes);
+}
+
+// Maps 16 chars to their six bit values, and packs them into the low 12
+// bytes of out.  Returns false if any char isn't in the alphabet.
+__attribute__((target("ssse3"))) inline bool decodeSsse3Block(__m128i in,
+                                                              __m128i& out)
+{
+    const __m128i lowLut =
+        _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                      0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i highLut =
+        _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i rollLut = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0,
+                                          0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2f);
+    __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask2F);
+    __m128i lowNibbles = _mm_and_si128(in, mask2F);
+    __m128i low = _mm_shuffle_epi8(lowLut, lowNibbles);
+    __m128i high = _mm_shuffle_epi8(highLut, highNibbles);
+    __m128i invalid = _mm_and_si128(low, high);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) !=
+        0xffff)
+    {
+        return false;
+    }
+    __m128i isSlash = _mm_cmpeq_epi8(in, mask2F);
+    __m128i roll =
+        _mm_shuffle_epi8(rollLut, _mm_add_epi8(isSlash, highNibbles));
+    __m128i values = _mm_add_epi8(in, roll);
+
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                                13, 12, -1, -1, -1, -1));
+    return true;
+}
+
+// The same as the SSSE3 blocks, on both 128 bit lanes at once
+__attribute__((target("avx2"))) inline __m256i encodeAvx2Block(__m256i in)
+{
+    in = _mm256_shuffle_epi8(
+        in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                             1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11,
+                             10));
+    __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    __m256i indexes = _mm256_or_si256(t1, t3);
+
+    __m256i reduced = _mm256_subs_epu8(indexes, _mm256_set1_epi8(51));
+    __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indexes);
+    reduced = _mm256_or_si256(reduced,
+                              _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+    __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, reduced), indexes);
+}
+
+__attribute__((target("avx2"))) inline bool decodeAvx2Block(__m256i in,
+                                                            __m256i& out)
+{
+    const __m256i lowLut = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+        0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i highLut = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i rollLut = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
+        -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2f);
+    __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask2F);
+    __m256i lowNibbles = _mm256_and_si256(in, mask2F);
+    __m256i low = _mm256_shuffle_epi8(lowLut, lowNibbles);
+    __m256i high = _mm256_shuffle_epi8(highLut, highNibbles);
+    if (_mm256_testz_si256(low, high) == 0)
+    {
+        return false;
+    }
+    __m256i isSlash = _mm256_cmpeq_epi8(in, mask2F);
+    __m256i roll =
+        _mm256_shuffle_epi8(rollLut, _mm256_add_epi8(isSlash, highNibbles));
+    __m256i values = _mm256_add_epi8(in, roll);
+
+    __m256i pairs =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    __m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    out = _mm256_shuffle_epi8(
+        quads, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+                                -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                -1, -1, -1, -1));
+    return true;
+}
+
+__attribute__((target("ssse3"))) inline size_t
+    encodeSsse3(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    // Each step reads 16 bytes, but only uses 12
+    while (size - consumed >= 16)
+    {
+        __m128i block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + consumed));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                         encodeSsse3Block(block));
+        consumed += 12;
+        out += 16;
+    }
+    return consumed;
+}
+
+__attribute__((target("ssse3"))) inline size_t
+    decodeSsse3(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    while (size - consumed >= 16)
+    {
+        __m128i block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + consumed));
+        __m128i decoded;
+        if (!decodeSsse3Block(block, decoded))
+        {
+            break;
+        }
+        // Writes 16 bytes, of which 12 are kept
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), decoded);
+        consumed += 16;
+        out += 12;
+    }
+    return consumed;
+}
+
+__attribute__((target("avx2"))) inline size_t
+    encodeAvx2(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    // Each step reads 28 bytes, as two overlapping 16 byte loads, and uses 24
+    while (size - consumed >= 28)
+    {
+        const char* block = in + consumed;
+        __m256i lanes = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(block))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 12)), 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                            encodeAvx2Block(lanes));
+        consumed += 24;
+        out += 32;
+    }
+    return consumed + encodeSsse3(in + consumed, size - consumed, out);
+}
+
+__attribute__((target("avx2"))) inline size_t
+    decodeAvx2(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    while (size - consumed >= 32)
+    {
+        __m256i block = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in + consumed));
+        __m256i decoded;
+        if (!decodeAvx2Block(block, decoded))
+        {
+            // Leave the block to the scalar code, which finds the padding, or
+            // reports the error
+            return consumed;
+        }
+        // Each lane holds 12 bytes; the second store overwrites the 4 junk
+        // bytes of the first
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                         _mm256_castsi256_si128(decoded));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12),
+                         _mm256_extracti128_si256(decoded, 1));
+        consumed += 32;
+        out += 24;
+    }
+    return consumed + decodeSsse3(in + consumed, size - consumed, out);
+}
+
+#endif // BMCWEB_BASE64_X86
+
+#ifdef BMCWEB_BASE64_NEON
+
+// Maps 16 six bit indexes to the base64 alphabet
+inline uint8x16_t encodeNeonIndexes(uint8x16_t indexes)
+{
+    uint8x16_t offsets = vdupq_n_u8('A');
+    offsets = vbslq_u8(vcgeq_u8(indexes, vdupq_n_u8(26)),
+                       vdupq_n_u8(static_cast<uint8_t>('a' - 26)), offsets);
+    offsets = vbslq_u8(vcgeq_u8(indexes, vdupq_n_u8(52)),
+                       vdupq_n_u8(static_cast<uint8_t>('0' - 52)), offsets);
+    offsets = vbslq_u8(vceqq_u8(indexes, vdupq_n_u8(62)),
+                       vdupq_n_u8(static_cast<uint8_t>('+' - 62)), offsets);
+    offsets = vbslq_u8(vceqq_u8(indexes, vdupq_n_u8(63)),
+                       vdupq_n_u8(static_cast<uint8_t>('/' - 63)), offsets);
+    return vaddq_u8(indexes, offsets);
+}
+
+// Maps 16 chars to their six bit values, setting invalid to all ones in any
+// lane that isn't in the alphabet
+inline uint8x16_t decodeNeonChars(uint8x16_t chars, uint8x16_t& invalid)
+{
+    uint8x16_t upper = vsubq_u8(chars, vdupq_n_u8('A'));
+    uint8x16_t lower = vsubq_u8(chars, vdupq_n_u8('a'));
+    uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+    uint8x16_t isUpper = vcltq_u8(upper, vdupq_n_u8(26));
+    uint8x16_t isLower = vcltq_u8(lower, vdupq_n_u8(26));
+    uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+    uint8x16_t isPlus = vceqq_u8(chars, vdupq_n_u8('+'));
+    uint8x16_t isSlash = vceqq_u8(chars, vdupq_n_u8('/'));
+
+    uint8x16_t values = vandq_u8(isUpper, upper);
+    values = vorrq_u8(values,
+                      vandq_u8(isLower, vaddq_u8(lower, vdupq_n_u8(26))));
+    values = vorrq_u8(values,
+                      vandq_u8(isDigit, vaddq_u8(digit, vdupq_n_u8(52))));
+    values = vorrq_u8(values, vandq_u8(isPlus, vdupq_n_u8(62)));
+    values = vorrq_u8(values, vandq_u8(isSlash, vdupq_n_u8(63)));
+
+    uint8x16_t valid = vorrq_u8(vorrq_u8(isUpper, isLower),
+                                vorrq_u8(vorrq_u8(isDigit, isPlus), isSlash));
+    invalid = vorrq_u8(invalid, vmvnq_u8(valid));
+    return values;
+}
+
+inline size_t encodeNeon(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    while (size - consumed >= 48)
+    {
+        uint8x16x3_t bytes =
+            vld3q_u8(reinterpret_cast<const uint8_t*>(in + consumed));
+        uint8x16x4_t chars;
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] =
+            vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4),
+                              vshrq_n_u8(bytes.val[1], 4)),
+                     vdupq_n_u8(0x3f));
+        chars.val[2] =
+            vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2),
+                              vshrq_n_u8(bytes.val[2], 6)),
+                     vdupq_n_u8(0x3f));
+        chars.val[3] = vandq_u8(bytes.val[2], vdupq_n_u8(0x3f));
+        for (uint8x16_t& value : chars.val)
+        {
+            value = encodeNeonIndexes(value);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t*>(out), chars);
+        consumed += 48;
+        out += 64;
+    }
+    return consumed;
+}
+
+inline size_t decodeNeon(const char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    while (size - consumed >= 64)
+    {
+        uint8x16x4_t chars =
+            vld4q_u8(reinterpret_cast<const uint8_t*>(in + consumed));
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (uint8x16_t& value : chars.val)
+        {
+            value = decodeNeonChars(value, invalid);
+        }
+        uint64x2_t invalidWords = vreinterpretq_u64_u8(invalid);
+        if ((vgetq_lane_u64(invalidWords, 0) |
+             vgetq_lane_u64(invalidWords, 1)) != 0)
+        {
+            break;
+        }
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(chars.val[0], 2),
+                                vshrq_n_u8(chars.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(chars.val[1], 4),
+                                vshrq_n_u8(chars.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(chars.val[2], 6), chars.val[3]);
+        vst3q_u8(reinterpret_cast<uint8_t*>(out), bytes);
+        consumed += 64;
+        out += 48;
+    }
+    return consumed;
+}
+
+#endif // BMCWEB_BASE64_NEON
+
+inline const Base64Kernels& scalarKernels()
+{
+    static const Base64Kernels kernels{Base64Kernel::Scalar, &encodeScalar,
+                                       &decodeScalar};
+    return kernels;
+}
+
+inline std::atomic<const Base64Kernels*>& selectedKernels();
+
+} // namespace base64_kernels
+
+// The kernels for kernel, or nullptr if this build or CPU can't run them
+inline const Base64Kernels* getBase64Kernels(Base64Kernel kernel)
+{
+    switch (kernel)
+    {
+        case Base64Kernel::Scalar:
+            return &base64_kernels::scalarKernels();
+#ifdef BMCWEB_BASE64_X86
+        case Base64Kernel::Ssse3:
+        {
+            static const Base64Kernels kernels{Base64Kernel::Ssse3,
+                                               &base64_kernels::encodeSsse3,
+                                               &base64_kernels::decodeSsse3};
+            if (__builtin_cpu_supports("ssse3") == 0)
+            {
+                return nullptr;
+            }
+            return &kernels;
+        }
+        case Base64Kernel::Avx2:
+        {
+            static const Base64Kernels kernels{Base64Kernel::Avx2,
+                                               &base64_kernels::encodeAvx2,
+                                               &base64_kernels::decodeAvx2};
+            if (__builtin_cpu_supports("avx2") == 0)
+            {
+                return nullptr;
+            }
+            return &kernels;
+        }
+#endif
+#ifdef BMCWEB_BASE64_NEON
+        case Base64Kernel::Neon:
+        {
+            static const Base64Kernels kernels{Base64Kernel::Neon,
+                                               &base64_kernels::encodeNeon,
+                                               &base64_kernels::decodeNeon};
+            return &kernels;
+        }
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+// The kernels that base64 encoding and decoding use; the widest this CPU
+// supports, unless another has been picked with setBase64Kernel
+inline const Base64Kernels& getBase64Kernels()
+{
+    return *base64_kernels::selectedKernels().load(std::memory_order_relaxed);
+}
+
+// Makes base64 encoding and decoding use kernel.  Returns false, and changes
+// nothing, if it isn't supported.  For tests and benchmarks.
+inline bool setBase64Kernel(Base64Kernel kernel)
+{
+    const Base64Kernels* kernels = getBase64Kernels(kernel);
+    if (kernels == nullptr)
+    {
+        return false;
+    }
+    base64_kernels::selectedKernels().store(kernels,
+                                            std::memory_order_relaxed);
+    return true;
+}
+
+inline std::atomic<const Base64Kernels*>& base64_kernels::selectedKernels()
+{
+    static std::atomic<const Base64Kernels*> selected = []() {
+        for (Base64Kernel kernel :
+             {Base64Kernel::Avx2, Base64Kernel::Neon, Base64Kernel::Ssse3})
+        {
+            const Base64Kernels* kernels = getBase64Kernels(kernel);
+            if (kernels != nullptr)
+            {
+                return kernels;
+            }
+        }
+        return &scalarKernels();
+    }();
+    return selected;
+}
+
+} // namespace utility
+} // namespace crow
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include <boost/beast/core/flat_static_buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace bmcweb
+{
+
+// Fixed size blocks of memory that are lent out for as long as some I/O
+// needs them, and given back once it's done.  Freed blocks are kept for the
+// next borrower, up to a budget; anything over the budget goes back to the
+// allocator, so a burst of connections doesn't hold memory forever.
+class BufferPool
+{
+  public:
+    BufferPool(size_t blockSizeIn, size_t maxFreeBytes) :
+        blockSize(blockSizeIn), maxFreeBlocks(maxFreeBytes / blockSizeIn)
+    {}
+
+    ~BufferPool() = default;
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool(BufferPool&&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+
+    // One pool per block size, per thread, so that lending and returning
+    // never takes a lock.  A block can be returned on a different thread than
+    // it was taken on; it then joins that thread's pool.
+    template <size_t BlockSize>
+    static BufferPool& getInstance()
+    {
+        static thread_local BufferPool pool(
+            BlockSize, static_cast<size_t>(BMCWEB_BUFFER_POOL_SIZE) * 1024U);
+        return pool;
+    }
+
+    std::unique_ptr<std::byte[]> take()
+    {
+        inUse++;
+        if (freeBlocks.empty())
+        {
+            // Not value initialized; these are only ever written to first
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+            return std::unique_ptr<std::byte[]>(new std::byte[blockSize]);
+        }
+        std::unique_ptr<std::byte[]> block = std::move(freeBlocks.back());
+        freeBlocks.pop_back();
+        return block;
+    }
+
+    void give(std::unique_ptr<std::byte[]> block)
+    {
+        if (inUse > 0)
+        {
+            inUse--;
+        }
+        if (freeBlocks.size() < maxFreeBlocks)
+        {
+            freeBlocks.push_back(std::move(block));
+        }
+    }
+
+    size_t getBlockSize() const
+    {
+        return blockSize;
+    }
+
+    size_t getFreeBlocks() const
+    {
+        return freeBlocks.size();
+    }
+
+    // Blocks taken from this pool, less those given back to it
+    size_t getBlocksInUse() const
+    {
+        return inUse;
+    }
+
+  private:
+    const size_t blockSize;
+    const size_t maxFreeBlocks;
+    std::vector<std::unique_ptr<std::byte[]>> freeBlocks;
+    size_t inUse = 0;
+};
+
+// A flat_static_buffer whose storage is borrowed from a BufferPool.  It
+// starts out with no storage; acquire() must be called before reading into
+// it, and release() gives the storage back once everything in it has been
+// consumed.
+template <size_t N>
+class PooledFlatBuffer : public boost::beast::flat_static_buffer_base
+{
+  public:
+    PooledFlatBuffer() : boost::beast::flat_static_buffer_base(nullptr, 0) {}
+
+    ~PooledFlatBuffer()
+    {
+        if (block != nullptr)
+        {
+            BufferPool::getInstance<N>().give(std::move(block));
+        }
+    }
+
+    PooledFlatBuffer(const PooledFlatBuffer&) = delete;
+    PooledFlatBuffer& operator=(const PooledFlatBuffer&) = delete;
+    PooledFlatBuffer(PooledFlatBuffer&&) = delete;
+    PooledFlatBuffer& operator=(PooledFlatBuffer&&) = delete;
+
+    void acquire()
+    {
+        if (block != nullptr)
+        {
+            return;
+        }
+        block = BufferPool::getInstance<N>().take();
+        reset(block.get(), N);
+    }
+
+    // Returns false, and keeps the storage, if there is still data in it
+    bool release()
+    {
+        if (block == nullptr)
+        {
+            return true;
+        }
+        if (size() != 0)
+        {
+            return false;
+        }
+        reset(nullptr, 0);
+        BufferPool::getInstance<N>().give(std::move(block));
+        return true;
+    }
+
+    bool hasStorage() const
+    {
+        return block != nullptr;
+    }
+
+  private:
+    std::unique_ptr<std::byte[]> block;
+};
+
+} // namespace bmcweb
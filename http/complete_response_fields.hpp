@@ -1,7 +1,10 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include "authentication.hpp"
 #include "boost_formatters.hpp"
+#include "compression.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
 #include "http_utility.hpp"
@@ -14,10 +17,113 @@
 #include <nlohmann/json.hpp>
 
 #include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace crow
 {
 
+// Compresses string and streamed json bodies when the client allows it.
+// Files and shared bodies are left alone; static assets are served
+// precompressed instead.
+inline void compressResponse(const Request& req, Response& res)
+{
+    if (!res.getHeaderValue(boost::beast::http::field::content_encoding)
+             .empty())
+    {
+        return;
+    }
+    bmcweb::HttpBody::value_type& body = res.response.body();
+    if (body.file().is_open() || body.isShared())
+    {
+        return;
+    }
+    // Whether this response is compressed depends on the request, so caches
+    // need to know, even when it isn't compressed this time
+    res.addHeader(boost::beast::http::field::vary, "Accept-Encoding");
+    if (!body.isJson() &&
+        body.str().size() <
+            static_cast<size_t>(BMCWEB_HTTP_COMPRESSION_THRESHOLD))
+    {
+        return;
+    }
+    using http_helpers::ContentEncoding;
+    ContentEncoding encoding = http_helpers::getPreferredEncoding(
+        req.getHeaderValue(boost::beast::http::field::accept_encoding));
+    if (encoding == ContentEncoding::Identity)
+    {
+        return;
+    }
+    if (body.isJson())
+    {
+        body.jsonContentEncoding(encoding);
+    }
+    else
+    {
+        std::string compressed;
+        if (!bmcweb::Compressor::compress(body.str(), compressed, encoding,
+                                          BMCWEB_HTTP_COMPRESSION_LEVEL))
+        {
+            return;
+        }
+        BMCWEB_LOG_DEBUG("Compressed response from {} to {} bytes",
+                         body.str().size(), compressed.size());
+        res.write(std::move(compressed));
+    }
+    res.addHeader(boost::beast::http::field::content_encoding,
+                  http_helpers::getEncodingName(encoding));
+    std::string etag(res.getHeaderValue(boost::beast::http::field::etag));
+    if (!etag.empty())
+    {
+        res.clearHeader(boost::beast::http::field::etag);
+        res.addHeader(boost::beast::http::field::etag,
+                      http_helpers::getEncodedEtag(etag, encoding));
+    }
+}
+
+// Sends only the parts of a file body asked for by a Range header.  Ranges
+// are honoured on GETs that succeeded, and only while an If-Range validator,
+// if there is one, still matches the file.
+inline void handleRangeRequest(const Request& req, Response& res)
+{
+    bmcweb::HttpBody::value_type& body = res.response.body();
+    if (!body.file().is_open() || !body.rawFileSize() ||
+        res.result() != boost::beast::http::status::ok)
+    {
+        return;
+    }
+    res.addHeader(boost::beast::http::field::accept_ranges, "bytes");
+    std::string_view rangeHeader =
+        req.getHeaderValue(boost::beast::http::field::range);
+    if (req.method() != boost::beast::http::verb::get || rangeHeader.empty())
+    {
+        return;
+    }
+    std::string_view ifRange =
+        req.getHeaderValue(boost::beast::http::field::if_range);
+    if (!ifRange.empty())
+    {
+        // Entity tags have to match exactly, and weak ones never do
+        std::string_view validator =
+            ifRange.starts_with('"')
+                ? res.getHeaderValue(boost::beast::http::field::etag)
+                : res.getHeaderValue(boost::beast::http::field::last_modified);
+        if (validator != ifRange)
+        {
+            return;
+        }
+    }
+    std::optional<std::vector<http_helpers::ByteRange>> ranges =
+        http_helpers::parseRange(rangeHeader, body.payloadSize().value_or(0));
+    if (!ranges)
+    {
+        return;
+    }
+    res.setByteRanges(*ranges);
+}
+
 inline void completeResponseFields(const Request& req, Response& res)
 {
     BMCWEB_LOG_INFO("Response:  {} {}", req.url().encoded_path(),
@@ -54,9 +160,25 @@ inline void completeResponseFields(const Request& req, Response& res)
             // backward compatibility.
             res.addHeader(boost::beast::http::field::content_type,
                           "application/json");
-            res.write(res.jsonValue.dump(
-                2, ' ', true, nlohmann::json::error_handler_t::replace));
+            int indent =
+                http_helpers::getJsonIndent(req.getHeaderValue("Accept"));
+            if (req.version() < 11)
+            {
+                // HTTP/1.0 can't use chunked encoding for larger responses
+                res.write(res.jsonValue.dump(
+                    indent, ' ', true,
+                    nlohmann::json::error_handler_t::replace));
+            }
+            else
+            {
+                res.writeJson(indent);
+            }
         }
     }
+    handleRangeRequest(req, res);
+    if constexpr (BMCWEB_HTTP_COMPRESSION)
+    {
+        compressResponse(req, res);
+    }
 }
 } // namespace crow
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "http_utility.hpp"
+#include "logging.hpp"
+
+#include <zlib.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace bmcweb
+{
+
+// Streaming gzip/deflate compressor for response bodies.
+class Compressor
+{
+  public:
+    Compressor() = default;
+    ~Compressor()
+    {
+        if (initialized)
+        {
+            deflateEnd(&stream);
+        }
+    }
+
+    Compressor(const Compressor&) = delete;
+    Compressor& operator=(const Compressor&) = delete;
+    Compressor(Compressor&&) = delete;
+    Compressor& operator=(Compressor&&) = delete;
+
+    bool init(http_helpers::ContentEncoding encoding, int level)
+    {
+        // 15 is the largest zlib window; adding 16 selects a gzip wrapper
+        // instead of a zlib one.  HTTP "deflate" means the zlib format.
+        int windowBits = 15;
+        if (encoding == http_helpers::ContentEncoding::Gzip)
+        {
+            windowBits += 16;
+        }
+        int ret = deflateInit2(&stream, level, Z_DEFLATED, windowBits, 8,
+                               Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK)
+        {
+            BMCWEB_LOG_ERROR("Failed to initialize zlib: {}", ret);
+            return false;
+        }
+        initialized = true;
+        return true;
+    }
+
+    // Compresses input, appending any output to out.  finish must be set on
+    // the last call, to flush the remaining output and the trailer.
+    bool compress(std::string_view input, std::string& out, bool finish)
+    {
+        if (!initialized)
+        {
+            return false;
+        }
+        // zlib doesn't modify the input, but the API isn't const correct
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(
+            input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+        int flush = finish ? Z_FINISH : Z_NO_FLUSH;
+        int ret = Z_OK;
+        do
+        {
+            stream.next_out = reinterpret_cast<Bytef*>(outBuf.data());
+            stream.avail_out = static_cast<uInt>(outBuf.size());
+            ret = deflate(&stream, flush);
+            if (ret == Z_STREAM_ERROR)
+            {
+                BMCWEB_LOG_ERROR("zlib deflate failed");
+                return false;
+            }
+            out.append(outBuf.data(), outBuf.size() - stream.avail_out);
+        } while (stream.avail_out == 0 || (finish && ret != Z_STREAM_END));
+        return true;
+    }
+
+    // Compresses a complete payload in one call
+    static bool compress(std::string_view input, std::string& out,
+                         http_helpers::ContentEncoding encoding, int level)
+    {
+        Compressor compressor;
+        if (!compressor.init(encoding, level))
+        {
+            return false;
+        }
+        out.reserve(deflateBound(&compressor.stream,
+                                 static_cast<uLong>(input.size())));
+        return compressor.compress(input, out, true);
+    }
+
+  private:
+    z_stream stream{};
+    bool initialized = false;
+    std::array<char, 1024UL * 4UL> outBuf{};
+};
+
+} // namespace bmcweb
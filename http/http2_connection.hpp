@@ -1,6 +1,7 @@
 #pragma once
 #include "bmcweb_config.h"
 
+#include "admission_control.hpp"
 #include "async_resp.hpp"
 #include "authentication.hpp"
 #include "complete_response_fields.hpp"
@@ -15,6 +16,7 @@
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/beast/http/error.hpp>
@@ -23,6 +25,7 @@
 #include <boost/beast/http/serializer.hpp>
 #include <boost/beast/http/write.hpp>
 #include <boost/beast/websocket.hpp>
+#include <boost/container/flat_map.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <array>
@@ -41,6 +44,7 @@ struct Http2StreamData
     std::optional<bmcweb::HttpBody::reader> reqReader;
     Response res;
     std::optional<bmcweb::HttpBody::writer> writer;
+    AdmissionControl::Ticket requestTicket;
 };
 
 template <typename Adaptor, typename Handler>
@@ -51,16 +55,38 @@ class HTTP2Connection :
 
   public:
     HTTP2Connection(Adaptor&& adaptorIn, Handler* handlerIn,
-                    std::function<std::string()>& getCachedDateStrF) :
+                    std::function<std::string()>& getCachedDateStrF,
+                    const boost::asio::ip::address& clientIpIn = {},
+                    AdmissionControl::Ticket&& connectionTicketIn = {}) :
         adaptor(std::move(adaptorIn)),
         ngSession(initializeNghttp2Session()), handler(handlerIn),
-        getCachedDateStr(getCachedDateStrF)
+        getCachedDateStr(getCachedDateStrF), clientIp(clientIpIn),
+        connectionTicket(std::move(connectionTicketIn))
     {}
 
+    boost::asio::io_context& socketIoContext()
+    {
+        return static_cast<boost::asio::io_context&>(
+            adaptor.get_executor().context());
+    }
+
+    // See Connection::handlerIoContext
+    boost::asio::io_context& handlerIoContext()
+    {
+        if constexpr (requires { handler->ioContext(); })
+        {
+            return handler->ioContext();
+        }
+        else
+        {
+            return socketIoContext();
+        }
+    }
+
     void start()
     {
         // Create the control stream
-        streams[0];
+        streams.emplace(0, std::make_unique<Http2StreamData>());
 
         if (sendServerConnectionHeader() != 0)
         {
@@ -74,9 +100,11 @@ class HTTP2Connection :
     {
         BMCWEB_LOG_DEBUG("send_server_connection_header()");
 
-        uint32_t maxStreams = 4;
-        std::array<nghttp2_settings_entry, 2> iv = {
-            {{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, maxStreams},
+        std::array<nghttp2_settings_entry, 3> iv = {
+            {{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS,
+              BMCWEB_HTTP2_MAX_CONCURRENT_STREAMS},
+             {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE,
+              BMCWEB_HTTP2_INITIAL_WINDOW_SIZE},
              {NGHTTP2_SETTINGS_ENABLE_PUSH, 0}}};
         int rv = ngSession.submitSettings(iv);
         if (rv != 0)
@@ -84,6 +112,15 @@ class HTTP2Connection :
             BMCWEB_LOG_ERROR("Fatal error: {}", nghttp2_strerror(rv));
             return -1;
         }
+        // The connection window isn't a setting; raising it sends a
+        // WINDOW_UPDATE on the control stream
+        rv = ngSession.setLocalWindowSize(0,
+                                          BMCWEB_HTTP2_CONNECTION_WINDOW_SIZE);
+        if (rv != 0)
+        {
+            BMCWEB_LOG_ERROR("Fatal error: {}", nghttp2_strerror(rv));
+            return -1;
+        }
         writeBuffer();
         return 0;
     }
@@ -101,7 +138,7 @@ class HTTP2Connection :
         {
             return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
         }
-        Http2StreamData& stream = streamIt->second;
+        Http2StreamData& stream = *streamIt->second;
         BMCWEB_LOG_DEBUG("File read callback length: {}", length);
         if (!stream.writer)
         {
@@ -167,7 +204,7 @@ class HTTP2Connection :
             close();
             return -1;
         }
-        Http2StreamData& stream = it->second;
+        Http2StreamData& stream = *it->second;
         Response& res = stream.res;
         res = std::move(completedRes);
         crow::Request& thisReq = *stream.req;
@@ -176,17 +213,22 @@ class HTTP2Connection :
         res.addHeader(boost::beast::http::field::date, getCachedDateStr());
         res.preparePayload();
 
-        boost::beast::http::fields& fields = res.fields();
+        Response::Fields& fields = res.fields();
         std::string code = std::to_string(res.resultInt());
         std::vector<nghttp2_nv> hdr;
         hdr.emplace_back(
             headerFromStringViews(":status", code, NGHTTP2_NV_FLAG_NONE));
-        for (const boost::beast::http::fields::value_type& header : fields)
+        for (const Response::Fields::value_type& header : fields)
         {
+            // HTTP/2 frames the body itself; chunked encoding isn't allowed
+            if (header.name() == boost::beast::http::field::transfer_encoding)
+            {
+                continue;
+            }
             hdr.emplace_back(headerFromStringViews(
                 header.name_string(), header.value(), NGHTTP2_NV_FLAG_NONE));
         }
-        http::response<bmcweb::HttpBody>& fbody = res.response;
+        Response::response_type& fbody = res.response;
         stream.writer.emplace(fbody.base(), fbody.body());
 
         nghttp2_data_provider dataPrd{
@@ -231,7 +273,7 @@ class HTTP2Connection :
             close();
             return -1;
         }
-        auto& reqReader = it->second.reqReader;
+        auto& reqReader = it->second->reqReader;
         if (reqReader)
         {
             boost::beast::error_code ec;
@@ -243,17 +285,51 @@ class HTTP2Connection :
                 return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
             }
         }
-        crow::Request& thisReq = *it->second.req;
-        thisReq.ioService = static_cast<decltype(thisReq.ioService)>(
-            &adaptor.get_executor().context());
+        crow::Request& thisReq = *it->second->req;
+        thisReq.ioService = &handlerIoContext();
         BMCWEB_LOG_DEBUG("Handling {} \"{}\"", logPtr(&thisReq),
                          thisReq.url().encoded_path());
 
-        crow::Response& thisRes = it->second.res;
+        crow::Response& thisRes = it->second->res;
+
+        AdmissionControl::Decision decision = connectionTicket.getDecision();
+        if (decision == AdmissionControl::Decision::Admit)
+        {
+            it->second->requestTicket =
+                AdmissionControl::getInstance().admitRequest(clientIp);
+            decision = it->second->requestTicket.getDecision();
+        }
+        if (decision != AdmissionControl::Decision::Admit)
+        {
+            BMCWEB_LOG_WARNING("Stream {} over limit, rejecting", streamId);
+            AdmissionControl::setRejectedResponse(thisRes, decision);
+            if (sendResponse(thisRes, streamId) != 0)
+            {
+                return NGHTTP2_ERR_CALLBACK_FAILURE;
+            }
+            return 0;
+        }
 
         thisRes.setCompleteRequestHandler(
             [this, streamId](Response& completeRes) {
             BMCWEB_LOG_DEBUG("res.completeRequestHandler called");
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                // Responses complete on the handler thread; the nghttp2
+                // session belongs to the socket's.
+                if (!socketIoContext().get_executor().running_in_this_thread())
+                {
+                    boost::asio::post(socketIoContext(),
+                                      [self(shared_from_this()), streamId,
+                                       resIn(std::move(completeRes))]() mutable {
+                        if (self->sendResponse(resIn, streamId) != 0)
+                        {
+                            self->close();
+                        }
+                    });
+                    return;
+                }
+            }
             if (sendResponse(completeRes, streamId) != 0)
             {
                 close();
@@ -261,7 +337,27 @@ class HTTP2Connection :
             }
         });
         auto asyncResp =
-            std::make_shared<bmcweb::AsyncResp>(std::move(it->second.res));
+            std::make_shared<bmcweb::AsyncResp>(std::move(it->second->res));
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            // Authentication and routing need the session store and D-Bus,
+            // which are owned by the handler thread.
+            boost::asio::post(handlerIoContext(),
+                              [self(shared_from_this()), req(it->second->req),
+                               asyncResp]() {
+                self->authenticateAndHandle(req, asyncResp);
+            });
+            return 0;
+        }
+        authenticateAndHandle(it->second->req, asyncResp);
+        return 0;
+    }
+
+    void authenticateAndHandle(
+        const std::shared_ptr<Request>& req,
+        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+    {
+        crow::Request& thisReq = *req;
         if constexpr (!BMCWEB_INSECURE_DISABLE_AUTH)
         {
             thisReq.session = crow::authentication::authenticate(
@@ -275,7 +371,7 @@ class HTTP2Connection :
                     thisReq.url().encoded_path(),
                     thisReq.getHeaderValue("X-Requested-With"),
                     thisReq.getHeaderValue("Accept"), asyncResp->res);
-                return 0;
+                return;
             }
         }
         std::string_view expected =
@@ -285,8 +381,7 @@ class HTTP2Connection :
         {
             asyncResp->res.setExpectedHash(expected);
         }
-        handler->handle(it->second.req, asyncResp);
-        return 0;
+        handler->handle(req, asyncResp);
     }
 
     int onDataChunkRecvCallback(uint8_t /*flags*/, int32_t streamId,
@@ -301,12 +396,12 @@ class HTTP2Connection :
         }
 
         std::optional<bmcweb::HttpBody::reader>& reqReader =
-            thisStream->second.reqReader;
+            thisStream->second->reqReader;
         if (!reqReader)
         {
             reqReader.emplace(
-                bmcweb::HttpBody::reader(thisStream->second.req->req.base(),
-                                         thisStream->second.req->req.body()));
+                bmcweb::HttpBody::reader(thisStream->second->req->req.base(),
+                                         thisStream->second->req->req.body()));
         }
         boost::beast::error_code ec;
         reqReader->put(boost::asio::const_buffer(data, len), ec);
@@ -424,7 +519,7 @@ class HTTP2Connection :
             return -1;
         }
 
-        crow::Request& thisReq = *thisStream->second.req;
+        crow::Request& thisReq = *thisStream->second->req;
 
         if (nameSv == ":path")
         {
@@ -490,7 +585,8 @@ class HTTP2Connection :
         {
             BMCWEB_LOG_DEBUG("create stream for id {}", frame.hd.stream_id);
 
-            streams.emplace(frame.hd.stream_id, Http2StreamData());
+            streams.emplace(frame.hd.stream_id,
+                            std::make_unique<Http2StreamData>());
         }
         return 0;
     }
@@ -533,14 +629,25 @@ class HTTP2Connection :
         {
             return;
         }
-        std::span<const uint8_t> data = ngSession.memSend();
-        if (data.empty())
+        // nghttp2 hands out roughly a frame at a time.  Batch them, so that
+        // many streams sending in parallel don't cost a write per frame.
+        outBuffer.clear();
+        while (outBuffer.size() < maxWriteSize)
+        {
+            std::span<const uint8_t> data = ngSession.memSend();
+            if (data.empty())
+            {
+                break;
+            }
+            outBuffer.insert(outBuffer.end(), data.begin(), data.end());
+        }
+        if (outBuffer.empty())
         {
             return;
         }
         isWriting = true;
         boost::asio::async_write(
-            adaptor, boost::asio::const_buffer(data.data(), data.size()),
+            adaptor, boost::asio::buffer(outBuffer),
             std::bind_front(afterWriteBuffer, shared_from_this()));
     }
 
@@ -595,11 +702,17 @@ class HTTP2Connection :
             std::bind_front(&self_type::afterDoRead, this, shared_from_this()));
     }
 
-    // A mapping from http2 stream ID to Stream Data
-    std::map<int32_t, Http2StreamData> streams;
+    // A mapping from http2 stream ID to Stream Data.  Stream IDs only
+    // increase, so new streams are appended to the end.  The data is held by
+    // pointer, as the body writers refer into it.
+    boost::container::flat_map<int32_t, std::unique_ptr<Http2StreamData>>
+        streams;
 
     std::array<uint8_t, 8192> inBuffer{};
 
+    static constexpr size_t maxWriteSize = 1024UL * 64UL;
+    std::vector<uint8_t> outBuffer;
+
     Adaptor adaptor;
     bool isWriting = false;
 
@@ -608,6 +721,10 @@ class HTTP2Connection :
     Handler* handler;
     std::function<std::string()>& getCachedDateStr;
 
+    boost::asio::ip::address clientIp;
+    // Taken over from the HTTP/1 connection that negotiated HTTP/2
+    AdmissionControl::Ticket connectionTicket;
+
     using std::enable_shared_from_this<
         HTTP2Connection<Adaptor, Handler>>::shared_from_this;
 
@@ -1,5 +1,10 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
+#include "compression.hpp"
+#include "http_utility.hpp"
+#include "json_serializer.hpp"
 #include "logging.hpp"
 #include "utility.hpp"
 
@@ -10,8 +15,14 @@
 #include <boost/beast/core/file_posix.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/system/error_code.hpp>
+#include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace bmcweb
 {
@@ -31,11 +42,50 @@ enum class EncodingType
     Base64,
 };
 
+// Part of a file payload sent in a 206 Partial Content response
+struct FileRange
+{
+    // Offset and length within the payload, after any base64 encoding
+    size_t offset = 0;
+    size_t length = 0;
+    // Multipart/byteranges part header, sent before the range
+    std::string header;
+};
+
 class HttpBody::value_type
 {
     boost::beast::file_posix fileHandle;
     std::optional<size_t> fileSize;
+    // When not empty, only these parts of the file are sent
+    std::vector<FileRange> fileRanges;
+    // Closes a multipart/byteranges body
+    std::string rangeTrailer;
     std::string strBody;
+    // Immutable data shared between responses, like cached static files.
+    // Takes the place of strBody when set.
+    std::shared_ptr<const std::string> sharedBody;
+    // Json documents too large to serialize up front are kept as a DOM, and
+    // serialized by the writer as they're sent.  The DOM is kept on the heap
+    // so that jsonSerializer, which points into it, survives a move.
+    std::unique_ptr<nlohmann::json> jsonBody;
+    int jsonIndent = -1;
+    // Where serializing had got to when the body was handed the document,
+    // and what it had written, which the writer sends first
+    std::optional<JsonSerializer> jsonSerializer;
+    std::string jsonStart;
+    // Streamed json is compressed by the writer as it's serialized
+    http_helpers::ContentEncoding jsonEncoding =
+        http_helpers::ContentEncoding::Identity;
+
+    static std::unique_ptr<nlohmann::json>
+        copyJson(const std::unique_ptr<nlohmann::json>& json)
+    {
+        if (json == nullptr)
+        {
+            return nullptr;
+        }
+        return std::make_unique<nlohmann::json>(*json);
+    }
 
   public:
     EncodingType encodingType = EncodingType::Raw;
@@ -47,23 +97,48 @@ class HttpBody::value_type
 
     value_type(value_type&& other) noexcept :
         fileHandle(std::move(other.fileHandle)), fileSize(other.fileSize),
-        strBody(std::move(other.strBody)), encodingType(other.encodingType)
-    {}
+        fileRanges(std::move(other.fileRanges)),
+        rangeTrailer(std::move(other.rangeTrailer)),
+        strBody(std::move(other.strBody)),
+        sharedBody(std::move(other.sharedBody)),
+        jsonBody(std::move(other.jsonBody)), jsonIndent(other.jsonIndent),
+        jsonSerializer(std::move(other.jsonSerializer)),
+        jsonStart(std::move(other.jsonStart)),
+        jsonEncoding(other.jsonEncoding), encodingType(other.encodingType)
+    {
+        other.jsonSerializer.reset();
+    }
 
     value_type& operator=(value_type&& other) noexcept
     {
         fileHandle = std::move(other.fileHandle);
         fileSize = other.fileSize;
+        fileRanges = std::move(other.fileRanges);
+        rangeTrailer = std::move(other.rangeTrailer);
         strBody = std::move(other.strBody);
+        sharedBody = std::move(other.sharedBody);
+        jsonSerializer.reset();
+        if (other.jsonSerializer)
+        {
+            jsonSerializer.emplace(std::move(*other.jsonSerializer));
+            other.jsonSerializer.reset();
+        }
+        jsonBody = std::move(other.jsonBody);
+        jsonIndent = other.jsonIndent;
+        jsonStart = std::move(other.jsonStart);
+        jsonEncoding = other.jsonEncoding;
         encodingType = other.encodingType;
 
         return *this;
     }
 
     // Overload copy constructor, because posix doesn't have dup(), but linux
-    // does
+    // does.  A copy of a json body serializes it again from the start.
     value_type(const value_type& other) :
-        fileSize(other.fileSize), strBody(other.strBody),
+        fileSize(other.fileSize), fileRanges(other.fileRanges),
+        rangeTrailer(other.rangeTrailer), strBody(other.strBody),
+        sharedBody(other.sharedBody), jsonBody(copyJson(other.jsonBody)),
+        jsonIndent(other.jsonIndent), jsonEncoding(other.jsonEncoding),
         encodingType(other.encodingType)
     {
         fileHandle.native_handle(dup(other.fileHandle.native_handle()));
@@ -74,7 +149,15 @@ class HttpBody::value_type
         if (this != &other)
         {
             fileSize = other.fileSize;
+            fileRanges = other.fileRanges;
+            rangeTrailer = other.rangeTrailer;
             strBody = other.strBody;
+            sharedBody = other.sharedBody;
+            jsonSerializer.reset();
+            jsonStart.clear();
+            jsonBody = copyJson(other.jsonBody);
+            jsonIndent = other.jsonIndent;
+            jsonEncoding = other.jsonEncoding;
             encodingType = other.encodingType;
             fileHandle.native_handle(dup(other.fileHandle.native_handle()));
         }
@@ -96,11 +179,112 @@ class HttpBody::value_type
         return strBody;
     }
 
+    void shared(std::shared_ptr<const std::string> data)
+    {
+        sharedBody = std::move(data);
+    }
+
+    bool isShared() const
+    {
+        return sharedBody != nullptr;
+    }
+
+    // The string body, whether owned or shared
+    std::string_view strView() const
+    {
+        if (sharedBody)
+        {
+            return *sharedBody;
+        }
+        return strBody;
+    }
+
+    bool isJson() const
+    {
+        return jsonBody != nullptr;
+    }
+
+    // Takes a document part way through being serialized.  serializer must
+    // have been made on *value, and start holds what it has written so far.
+    void json(std::unique_ptr<nlohmann::json>&& value, int indentIn,
+              JsonSerializer&& serializer, std::string&& start)
+    {
+        jsonBody = std::move(value);
+        jsonIndent = indentIn;
+        jsonSerializer.emplace(std::move(serializer));
+        jsonStart = std::move(start);
+    }
+
+    // Carries on from where serializing had got to, or starts from the
+    // beginning if this is a copy
+    JsonSerializer& serializer()
+    {
+        if (!jsonSerializer)
+        {
+            jsonSerializer.emplace(*jsonBody, jsonIndent);
+        }
+        return *jsonSerializer;
+    }
+
+    // What was serialized before the body was handed the document
+    std::string takeJsonStart()
+    {
+        return std::exchange(jsonStart, {});
+    }
+
+    http_helpers::ContentEncoding jsonContentEncoding() const
+    {
+        return jsonEncoding;
+    }
+
+    void jsonContentEncoding(http_helpers::ContentEncoding encoding)
+    {
+        jsonEncoding = encoding;
+    }
+
+    // The full size of the file before encoding, if known
+    std::optional<size_t> rawFileSize() const
+    {
+        return fileSize;
+    }
+
+    const std::vector<FileRange>& ranges() const
+    {
+        return fileRanges;
+    }
+
+    const std::string& rangesTrailer() const
+    {
+        return rangeTrailer;
+    }
+
+    // Limits a file body to the given parts of its payload.  The trailer is
+    // sent after the last range.
+    void setRanges(std::vector<FileRange>&& ranges, std::string&& trailer)
+    {
+        fileRanges = std::move(ranges);
+        rangeTrailer = std::move(trailer);
+    }
+
     std::optional<size_t> payloadSize() const
     {
+        if (isJson())
+        {
+            // Not known until the document has been serialized
+            return std::nullopt;
+        }
         if (!fileHandle.is_open())
         {
-            return strBody.size();
+            return strView().size();
+        }
+        if (!fileRanges.empty())
+        {
+            size_t size = rangeTrailer.size();
+            for (const FileRange& range : fileRanges)
+            {
+                size += range.header.size() + range.length;
+            }
+            return size;
         }
         if (fileSize)
         {
@@ -116,8 +300,16 @@ class HttpBody::value_type
     {
         strBody.clear();
         strBody.shrink_to_fit();
+        sharedBody = nullptr;
+        jsonSerializer.reset();
+        jsonBody = nullptr;
+        jsonIndent = -1;
+        jsonStart.clear();
+        jsonEncoding = http_helpers::ContentEncoding::Identity;
         fileHandle = boost::beast::file_posix();
         fileSize = std::nullopt;
+        fileRanges.clear();
+        rangeTrailer.clear();
         encodingType = EncodingType::Raw;
     }
 
@@ -178,6 +370,16 @@ class HttpBody::writer
 
     value_type& body;
     size_t sent = 0;
+    // Owned by the body
+    JsonSerializer* jsonSerializer = nullptr;
+    std::optional<Compressor> compressor;
+    std::string uncompressed;
+    bool compressionDone = false;
+    // Progress through the body's file ranges
+    size_t rangeIndex = 0;
+    size_t rangeSent = 0;
+    bool rangeHeaderSent = false;
+    size_t rangeBytesSent = 0;
     // 64KB This number is arbitrary, and selected to try to optimize for larger
     // files and fewer loops over per-connection reduction in memory usage.
     // Nginx uses 16-32KB here, so we're in the range of what other webservers
@@ -207,14 +409,23 @@ class HttpBody::writer
         getWithMaxSize(boost::beast::error_code& ec, size_t maxSize)
     {
         std::pair<const_buffers_type, bool> ret;
+        if (body.isJson())
+        {
+            return getJson(ec, maxSize);
+        }
+        if (body.file().is_open() && !body.ranges().empty())
+        {
+            return getFileRange(ec, maxSize);
+        }
         if (!body.file().is_open())
         {
-            size_t remain = body.str().size() - sent;
+            std::string_view str = body.strView();
+            size_t remain = str.size() - sent;
             size_t toReturn = std::min(maxSize, remain);
-            ret.first = const_buffers_type(&body.str()[sent], toReturn);
+            ret.first = const_buffers_type(str.data() + sent, toReturn);
 
             sent += toReturn;
-            ret.second = sent < body.str().size();
+            ret.second = sent < str.size();
             BMCWEB_LOG_INFO("Returning {} bytes more={}", ret.first.size(),
                             ret.second);
             return ret;
@@ -258,6 +469,177 @@ class HttpBody::writer
         }
         return ret;
     }
+
+  private:
+    // Returns the next piece of a ranged file body: each range's part header
+    // and data in turn, then the trailer.
+    boost::optional<std::pair<const_buffers_type, bool>>
+        getFileRange(boost::beast::error_code& ec, size_t maxSize)
+    {
+        const std::vector<FileRange>& ranges = body.ranges();
+        std::string_view chunk;
+        while (chunk.empty() && rangeIndex < ranges.size())
+        {
+            const FileRange& range = ranges[rangeIndex];
+            if (!rangeHeaderSent && sent < range.header.size())
+            {
+                chunk = std::string_view(range.header).substr(sent, maxSize);
+                sent += chunk.size();
+                break;
+            }
+            rangeHeaderSent = true;
+            if (rangeSent == range.length)
+            {
+                rangeIndex++;
+                rangeSent = 0;
+                rangeHeaderSent = false;
+                sent = 0;
+                continue;
+            }
+            size_t toRead = std::min({range.length - rangeSent, maxSize,
+                                      fileReadBuf.size()});
+            if (body.encodingType == EncodingType::Base64)
+            {
+                chunk = readBase64Range(ec, range.offset + rangeSent, toRead);
+            }
+            else
+            {
+                chunk = readRaw(ec, range.offset + rangeSent, toRead);
+            }
+            if (ec)
+            {
+                return boost::none;
+            }
+            rangeSent += chunk.size();
+        }
+        if (chunk.empty())
+        {
+            chunk = std::string_view(body.rangesTrailer()).substr(sent,
+                                                                  maxSize);
+            sent += chunk.size();
+        }
+        rangeBytesSent += chunk.size();
+        std::pair<const_buffers_type, bool> ret;
+        ret.first = const_buffers_type(chunk.data(), chunk.size());
+        ret.second = rangeBytesSent < body.payloadSize().value_or(0);
+        return ret;
+    }
+
+    std::string_view readRaw(boost::beast::error_code& ec, size_t offset,
+                             size_t size)
+    {
+        ssize_t read = pread(body.file().native_handle(), fileReadBuf.data(),
+                             size, static_cast<off_t>(offset));
+        if (read <= 0)
+        {
+            // The file shrank since the ranges were checked against it
+            BMCWEB_LOG_ERROR("Failed to read file range at {}", offset);
+            ec = boost::system::errc::make_error_code(
+                boost::system::errc::io_error);
+            return {};
+        }
+        return {fileReadBuf.data(), static_cast<size_t>(read)};
+    }
+
+    // Every 3 bytes of the file encode to 4 characters, so a range of the
+    // encoded payload is read from the start of the group it falls in, and
+    // the characters before the range are dropped after encoding.
+    std::string_view readBase64Range(boost::beast::error_code& ec,
+                                     size_t offset, size_t size)
+    {
+        size_t rawOffset = offset / 4 * 3;
+        size_t skip = offset % 4;
+        size_t rawSize = (skip + size + 3) / 4 * 3;
+        rawSize = std::min(rawSize, fileReadBuf.size() / 3 * 3);
+        rawSize = std::min(rawSize, body.rawFileSize().value_or(0) - rawOffset);
+        std::string_view raw = readRaw(ec, rawOffset, rawSize);
+        if (ec)
+        {
+            return {};
+        }
+        // Only the end of the file gets padded
+        bool atEnd = rawOffset + raw.size() == body.rawFileSize();
+        if (!atEnd)
+        {
+            raw = raw.substr(0, raw.size() / 3 * 3);
+        }
+        crow::utility::Base64Encoder rangeEncoder;
+        buf.clear();
+        buf.reserve(crow::utility::Base64Encoder::encodedSize(raw.size()));
+        rangeEncoder.encode(raw, buf);
+        if (atEnd)
+        {
+            rangeEncoder.finalize(buf);
+        }
+        if (skip >= buf.size())
+        {
+            ec = boost::system::errc::make_error_code(
+                boost::system::errc::io_error);
+            return {};
+        }
+        return std::string_view(buf).substr(skip, size);
+    }
+
+    // Serializes the next chunk of the json body into buf, once the previous
+    // one has been fully consumed.  buf never holds more than one chunk.
+    boost::optional<std::pair<const_buffers_type, bool>>
+        getJson(boost::beast::error_code& ec, size_t maxSize)
+    {
+        if (jsonSerializer == nullptr)
+        {
+            jsonSerializer = &body.serializer();
+            std::string start = body.takeJsonStart();
+            if (body.jsonContentEncoding() !=
+                http_helpers::ContentEncoding::Identity)
+            {
+                compressor.emplace();
+                if (!compressor->init(body.jsonContentEncoding(),
+                                      BMCWEB_HTTP_COMPRESSION_LEVEL) ||
+                    !compressor->compress(start, buf, false))
+                {
+                    ec = boost::system::errc::make_error_code(
+                        boost::system::errc::not_enough_memory);
+                    return boost::none;
+                }
+            }
+            else
+            {
+                buf = std::move(start);
+            }
+        }
+        if (sent == buf.size())
+        {
+            buf.clear();
+            sent = 0;
+            if (!compressor)
+            {
+                jsonSerializer->fill(buf);
+            }
+            // deflate buffers internally, so a chunk of input doesn't always
+            // produce output; keep feeding it until it does.
+            while (compressor && buf.empty() && !compressionDone)
+            {
+                uncompressed.clear();
+                jsonSerializer->fill(uncompressed);
+                compressionDone = jsonSerializer->done();
+                if (!compressor->compress(uncompressed, buf, compressionDone))
+                {
+                    ec = boost::system::errc::make_error_code(
+                        boost::system::errc::io_error);
+                    return boost::none;
+                }
+            }
+        }
+        size_t toReturn = std::min(maxSize, buf.size() - sent);
+        std::pair<const_buffers_type, bool> ret;
+        ret.first = const_buffers_type(&buf[sent], toReturn);
+        sent += toReturn;
+        ret.second = sent < buf.size() || !jsonSerializer->done() ||
+                     (compressor && !compressionDone);
+        BMCWEB_LOG_DEBUG("Returning {} bytes of json more={}", toReturn,
+                         ret.second);
+        return ret;
+    }
 };
 
 class HttpBody::reader
@@ -20,6 +20,7 @@
 #include "http_response.hpp"
 #include "logging.hpp"
 #include "ssl_key_handler.hpp"
+#include "timer_wheel.hpp"
 
 #include <boost/asio/connect.hpp>
 #include <boost/asio/io_context.hpp>
@@ -138,7 +139,9 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
 
     // Data buffers
     http::request<bmcweb::HttpBody> req;
-    using parser_type = http::response_parser<bmcweb::HttpBody>;
+    using parser_type =
+        http::response_parser<bmcweb::HttpBody,
+                              Response::Fields::allocator_type>;
     std::optional<parser_type> parser;
     boost::beast::flat_static_buffer<httpReadBufferSize> buffer;
     Response res;
@@ -157,7 +160,10 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
     std::optional<boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>>
         sslConn;
 
+    // Waits between retries
     boost::asio::steady_timer timer;
+    // Times out each step of talking to the server
+    bmcweb::Deadline deadline;
 
     friend class ConnectionPool;
 
@@ -187,8 +193,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
 
         BMCWEB_LOG_DEBUG("Trying to connect to: {}, id: {}", host, connId);
 
-        timer.expires_after(std::chrono::seconds(30));
-        timer.async_wait(std::bind_front(onTimeout, weak_from_this()));
+        startTimeout();
 
         boost::asio::async_connect(
             conn, endpointList,
@@ -207,7 +212,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
             return;
         }
 
-        timer.cancel();
+        deadline.cancel();
         if (ec)
         {
             BMCWEB_LOG_ERROR("Connect {}:{}, id: {} failed: {}",
@@ -236,8 +241,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
             return;
         }
         state = ConnState::handshakeInProgress;
-        timer.expires_after(std::chrono::seconds(30));
-        timer.async_wait(std::bind_front(onTimeout, weak_from_this()));
+        startTimeout();
         sslConn->async_handshake(
             boost::asio::ssl::stream_base::client,
             std::bind_front(&ConnectionInfo::afterSslHandshake, this,
@@ -254,7 +258,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
             return;
         }
 
-        timer.cancel();
+        deadline.cancel();
         if (ec)
         {
             BMCWEB_LOG_ERROR("SSL Handshake failed - id: {} error: {}", connId,
@@ -273,8 +277,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
         state = ConnState::sendInProgress;
 
         // Set a timeout on the operation
-        timer.expires_after(std::chrono::seconds(30));
-        timer.async_wait(std::bind_front(onTimeout, weak_from_this()));
+        startTimeout();
         boost::beast::http::message_generator messageGenerator(std::move(req));
         // Send the HTTP request to the remote host
         if (sslConn)
@@ -303,7 +306,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
             return;
         }
 
-        timer.cancel();
+        deadline.cancel();
         if (ec)
         {
             BMCWEB_LOG_ERROR("sendMessage() failed: {} {}", ec.message(), host);
@@ -326,8 +329,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
 
         thisParser.body_limit(connPolicy->requestByteLimit);
 
-        timer.expires_after(std::chrono::seconds(30));
-        timer.async_wait(std::bind_front(onTimeout, weak_from_this()));
+        startTimeout();
 
         // Receive the HTTP response
         if (sslConn)
@@ -357,7 +359,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
             return;
         }
 
-        timer.cancel();
+        deadline.cancel();
         if (ec && ec != boost::asio::ssl::error::stream_truncated)
         {
             BMCWEB_LOG_ERROR("recvMessage() failed: {} from {}", ec.message(),
@@ -416,21 +418,19 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
         res.clear();
     }
 
-    static void onTimeout(const std::weak_ptr<ConnectionInfo>& weakSelf,
-                          const boost::system::error_code& ec)
+    // Gives each step of talking to the server 30 seconds
+    void startTimeout()
     {
-        if (ec == boost::asio::error::operation_aborted)
-        {
-            BMCWEB_LOG_DEBUG(
-                "async_wait failed since the operation is aborted");
-            return;
-        }
-        if (ec)
+        if (!deadline.hasCallback())
         {
-            BMCWEB_LOG_ERROR("async_wait failed: {}", ec.message());
-            // If the timer fails, we need to close the socket anyway, same
-            // as if it expired.
+            deadline.setCallback(std::bind_front(onTimeout, weak_from_this()));
         }
+        deadline.arm(bmcweb::TimerWheel::getInstance(ioc),
+                     std::chrono::seconds(30));
+    }
+
+    static void onTimeout(const std::weak_ptr<ConnectionInfo>& weakSelf)
+    {
         std::shared_ptr<ConnectionInfo> self = weakSelf.lock();
         if (self == nullptr)
         {
@@ -441,6 +441,7 @@ class ConnectionInfo : public std::enable_shared_from_this<ConnectionInfo>
 
     void waitAndRetry()
     {
+        deadline.cancel();
         if ((retryCount >= connPolicy->maxRetryAttempts) ||
             (state == ConnState::sslInitFailed))
         {
@@ -1,8 +1,11 @@
 #pragma once
 #include "bmcweb_config.h"
 
+#include "admission_control.hpp"
+#include "allocation_stats.hpp"
 #include "async_resp.hpp"
 #include "authentication.hpp"
+#include "buffer_pool.hpp"
 #include "complete_response_fields.hpp"
 #include "http2_connection.hpp"
 #include "http_body.hpp"
@@ -10,26 +13,35 @@
 #include "http_utility.hpp"
 #include "logging.hpp"
 #include "mutual_tls.hpp"
+#include "request_arena.hpp"
 #include "ssl_key_handler.hpp"
 #include "str_utility.hpp"
+#include "timer_wheel.hpp"
+#include "tls_session_resumption.hpp"
 #include "utility.hpp"
 
+#include <sys/sendfile.h>
+
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ssl/stream.hpp>
-#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/_experimental/test/stream.hpp>
 #include <boost/beast/core/buffers_generator.hpp>
-#include <boost/beast/core/flat_static_buffer.hpp>
 #include <boost/beast/http/error.hpp>
+#include <boost/beast/http/fields.hpp>
 #include <boost/beast/http/message_generator.hpp>
 #include <boost/beast/http/parser.hpp>
 #include <boost/beast/http/read.hpp>
 #include <boost/beast/http/write.hpp>
 #include <boost/beast/websocket.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -37,7 +49,7 @@ namespace crow
 {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-static int connectionCount = 0;
+static std::atomic<int> connectionCount = 0;
 
 // request body limit size set by the BMCWEB_HTTP_BODY_LIMIT option
 constexpr uint64_t httpReqBodyLimit = 1024UL * 1024UL * BMCWEB_HTTP_BODY_LIMIT;
@@ -46,6 +58,14 @@ constexpr uint64_t loggedOutPostBodyLimit = 4096U;
 
 constexpr uint32_t httpHeaderLimit = 8192U;
 
+// Size of the buffer requests are read into, borrowed from the buffer pool
+// only while a request is being read
+constexpr size_t httpReadBufferSize = 8192U;
+
+// Requests on one connection that can be outstanding at once
+constexpr size_t httpPipelineDepth =
+    static_cast<size_t>(BMCWEB_HTTP_PIPELINE_DEPTH);
+
 template <typename>
 struct IsTls : std::false_type
 {};
@@ -60,13 +80,30 @@ class Connection :
 {
     using self_type = Connection<Adaptor, Handler>;
 
+    // Allocation counts are per thread.  With more than one HTTP thread the
+    // handlers allocate on another thread, so the count would be meaningless.
+    static constexpr bool logAllocations =
+        BMCWEB_ALLOCATION_STATS && BMCWEB_HTTP_THREADS == 1;
+
+    // A request that has been read, along with its response once the
+    // handler has finished with it
+    struct PipelinedRequest
+    {
+        uint64_t id = 0;
+        std::shared_ptr<crow::Request> req;
+        crow::Response res;
+        bool completed = false;
+        bool keepAlive = true;
+        AdmissionControl::Ticket requestTicket;
+        bmcweb::AllocationStats allocationsAtStart;
+    };
+
   public:
-    Connection(Handler* handlerIn, boost::asio::steady_timer&& timerIn,
+    Connection(Handler* handlerIn,
                std::function<std::string()>& getCachedDateStrF,
                Adaptor adaptorIn) :
         adaptor(std::move(adaptorIn)),
-        handler(handlerIn), timer(std::move(timerIn)),
-        getCachedDateStr(getCachedDateStrF)
+        handler(handlerIn), getCachedDateStr(getCachedDateStrF)
     {
         initParser();
 
@@ -78,17 +115,18 @@ class Connection :
         connectionCount++;
 
         BMCWEB_LOG_DEBUG("{} Connection created, total {}", logPtr(this),
-                         connectionCount);
+                         connectionCount.load());
     }
 
     ~Connection()
     {
         res.releaseCompleteRequestHandler();
         cancelDeadlineTimer();
+        bmcweb::RequestArena::release(std::move(arena));
 
         connectionCount--;
         BMCWEB_LOG_DEBUG("{} Connection closed, total {}", logPtr(this),
-                         connectionCount);
+                         connectionCount.load());
     }
 
     Connection(const Connection&) = delete;
@@ -103,6 +141,18 @@ class Connection :
         // don't require auth
         if (preverified)
         {
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                // The session store is owned by the handler thread; remember
+                // the verified user and create the session along with the
+                // first request's authentication.
+                std::string user = getMtlsUsername(ctx);
+                if (!user.empty())
+                {
+                    mtlsUsername = std::move(user);
+                }
+                return true;
+            }
             mtlsSession = verifyMtlsUser(ip, ctx);
             if (mtlsSession)
             {
@@ -121,23 +171,18 @@ class Connection :
             std::filesystem::path caPath(ensuressl::trustStorePath);
             auto caAvailable = !std::filesystem::is_empty(caPath, error);
             caAvailable = caAvailable && !error;
-            if (caAvailable && persistent_data::SessionStore::getInstance()
-                                   .getAuthMethodsConfig()
-                                   .tls)
+            // Worker threads can't read the auth config; they always request
+            // a certificate and the TLS auth method is checked when the
+            // session gets created on the handler thread.
+            if (caAvailable &&
+                (BMCWEB_HTTP_THREADS > 1 ||
+                 persistent_data::SessionStore::getInstance()
+                     .getAuthMethodsConfig()
+                     .tls))
             {
+                // The session id context is set on the SSL context, so that
+                // sessions can be resumed on any connection
                 adaptor.set_verify_mode(boost::asio::ssl::verify_peer);
-                std::string id = "bmcweb";
-
-                const char* cStr = id.c_str();
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-                const auto* idC = reinterpret_cast<const unsigned char*>(cStr);
-                int ret = SSL_set_session_id_context(
-                    adaptor.native_handle(), idC,
-                    static_cast<unsigned int>(id.length()));
-                if (ret == 0)
-                {
-                    BMCWEB_LOG_ERROR("{} failed to set SSL id", logPtr(this));
-                }
             }
 
             adaptor.set_verify_callback(
@@ -145,26 +190,79 @@ class Connection :
         }
     }
 
+    // A resumed session skips certificate verification, so the verify
+    // callback never ran; take the user from the session instead.
+    void restoreResumedMtlsUser()
+    {
+        std::string user = getResumedMtlsUsername(adaptor.native_handle());
+        if (user.empty())
+        {
+            return;
+        }
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            mtlsUsername = std::move(user);
+        }
+        else
+        {
+            if (persistent_data::SessionStore::getInstance()
+                    .getAuthMethodsConfig()
+                    .tls)
+            {
+                mtlsSession = createMtlsUserSession(ip, user);
+            }
+        }
+    }
+
     Adaptor& socket()
     {
         return adaptor;
     }
 
+    boost::asio::io_context& socketIoContext()
+    {
+        return static_cast<boost::asio::io_context&>(
+            adaptor.get_executor().context());
+    }
+
+    // Route handlers, D-Bus and the session store live on the handler's
+    // io_context.  With more than one HTTP thread this differs from the
+    // io_context that owns this socket.
+    boost::asio::io_context& handlerIoContext()
+    {
+        if constexpr (requires { handler->ioContext(); })
+        {
+            return handler->ioContext();
+        }
+        else
+        {
+            return socketIoContext();
+        }
+    }
+
     void start()
     {
         BMCWEB_LOG_DEBUG("{} Connection started, total {}", logPtr(this),
-                         connectionCount);
-        if (connectionCount >= 200)
+                         connectionCount.load());
+
+        readClientIp();
+
+        connectionTicket = AdmissionControl::getInstance().admitConnection(ip);
+        if (connectionTicket.getDecision() == AdmissionControl::Decision::Drop)
         {
-            BMCWEB_LOG_CRITICAL("{} Max connection count exceeded.",
-                                logPtr(this));
+            BMCWEB_LOG_CRITICAL(
+                "{} Max connection count exceeded and accept queue full.",
+                logPtr(this));
             return;
         }
+        if (!connectionTicket.admitted())
+        {
+            BMCWEB_LOG_WARNING("{} Connection from {} over limit, rejecting",
+                               logPtr(this), ip.to_string());
+        }
 
         startDeadline();
 
-        readClientIp();
-
         // TODO(ed) Abstract this to a more clever class with the idea of an
         // asynchronous "start"
         if constexpr (IsTls<Adaptor>::value)
@@ -187,6 +285,15 @@ class Connection :
 
     void afterSslHandshake()
     {
+        ensuressl::countHandshake(adaptor.native_handle());
+        if constexpr (BMCWEB_MUTUAL_TLS_AUTH)
+        {
+            if (SSL_session_reused(adaptor.native_handle()) == 1)
+            {
+                restoreResumedMtlsUser();
+            }
+        }
+
         // If http2 is enabled, negotiate the protocol
         if constexpr (BMCWEB_EXPERIMENTAL_HTTP2)
         {
@@ -203,7 +310,8 @@ class Connection :
                 {
                     auto http2 =
                         std::make_shared<HTTP2Connection<Adaptor, Handler>>(
-                            std::move(adaptor), handler, getCachedDateStr);
+                            std::move(adaptor), handler, getCachedDateStr, ip,
+                            std::move(connectionTicket));
                     http2->start();
                     return;
                 }
@@ -233,79 +341,107 @@ class Connection :
         {
             return;
         }
-        req = std::make_shared<crow::Request>(parser->release(), reqEc);
+        PipelinedRequest& entry = pipeline.back();
+        if constexpr (logAllocations)
+        {
+            entry.allocationsAtStart = bmcweb::threadAllocationStats();
+        }
+        if (arena == nullptr || arena.use_count() != 1 || !arena->reset())
+        {
+            // Either the connection was idle, or something is still holding
+            // on to part of an earlier request, so leave that memory alone
+            bmcweb::RequestArena::release(std::move(arena));
+            arena = bmcweb::RequestArena::acquire();
+        }
+        entry.req = std::allocate_shared<crow::Request>(
+            bmcweb::ArenaAllocator<crow::Request>(arena), parser->release(),
+            reqEc);
         if (reqEc)
         {
             BMCWEB_LOG_DEBUG("Request failed to construct{}", reqEc.message());
-            res.result(boost::beast::http::status::bad_request);
-            completeRequest(res);
+            entry.res.result(boost::beast::http::status::bad_request);
+            completeRequest(entry.id, entry.res);
             return;
         }
-        req->session = userSession;
+        // Handlers get their own reference; the entry gives up its one as
+        // soon as the response is ready, which can be before handle returns
+        std::shared_ptr<crow::Request> thisReq = entry.req;
+        thisReq->session = userSession;
 
         // Fetch the client IP address
-        req->ipAddress = ip;
+        thisReq->ipAddress = ip;
 
         // Check for HTTP version 1.1.
-        if (req->version() == 11)
+        if (thisReq->version() == 11)
         {
-            if (req->getHeaderValue(boost::beast::http::field::host).empty())
+            if (thisReq->getHeaderValue(boost::beast::http::field::host)
+                    .empty())
             {
-                res.result(boost::beast::http::status::bad_request);
-                completeRequest(res);
+                entry.res.result(boost::beast::http::status::bad_request);
+                completeRequest(entry.id, entry.res);
                 return;
             }
         }
 
         BMCWEB_LOG_INFO("Request:  {} HTTP/{}.{} {} {} {}", logPtr(this),
-                        req->version() / 10, req->version() % 10,
-                        req->methodString(), req->target(),
-                        req->ipAddress.to_string());
+                        thisReq->version() / 10, thisReq->version() % 10,
+                        thisReq->methodString(), thisReq->target(),
+                        thisReq->ipAddress.to_string());
 
-        req->ioService = static_cast<decltype(req->ioService)>(
-            &adaptor.get_executor().context());
+        thisReq->ioService = &handlerIoContext();
 
-        if (res.completed)
+        if (entry.res.completed)
+        {
+            completeRequest(entry.id, entry.res);
+            return;
+        }
+        entry.keepAlive = thisReq->keepAlive();
+        if (!entry.keepAlive)
+        {
+            readClosed = true;
+        }
+        if (!admitRequest(entry))
         {
-            completeRequest(res);
             return;
         }
-        keepAlive = req->keepAlive();
         if constexpr (!std::is_same_v<Adaptor, boost::beast::test::stream>)
         {
             if constexpr (!BMCWEB_INSECURE_DISABLE_AUTH)
             {
-                if (!crow::authentication::isOnAllowlist(req->url().path(),
-                                                         req->method()) &&
-                    req->session == nullptr)
+                if (!crow::authentication::isOnAllowlist(
+                        thisReq->url().path(), thisReq->method()) &&
+                    thisReq->session == nullptr)
                 {
                     BMCWEB_LOG_WARNING("Authentication failed");
                     forward_unauthorized::sendUnauthorized(
-                        req->url().encoded_path(),
-                        req->getHeaderValue("X-Requested-With"),
-                        req->getHeaderValue("Accept"), res);
-                    completeRequest(res);
+                        thisReq->url().encoded_path(),
+                        thisReq->getHeaderValue("X-Requested-With"),
+                        thisReq->getHeaderValue("Accept"), entry.res);
+                    completeRequest(entry.id, entry.res);
                     return;
                 }
             }
         }
-        auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+        auto asyncResp = std::allocate_shared<bmcweb::AsyncResp>(
+            bmcweb::ArenaAllocator<bmcweb::AsyncResp>(arena),
+            bmcweb::ArenaAllocator<char>(arena));
         BMCWEB_LOG_DEBUG("Setting completion handler");
         asyncResp->res.setCompleteRequestHandler(
-            [self(shared_from_this())](crow::Response& thisRes) {
-            self->completeRequest(thisRes);
+            [self(shared_from_this()), id(entry.id)](crow::Response& thisRes) {
+            self->completeRequest(id, thisRes);
         });
         bool isSse =
-            isContentTypeAllowed(req->getHeaderValue("Accept"),
+            isContentTypeAllowed(thisReq->getHeaderValue("Accept"),
                                  http_helpers::ContentType::EventStream, false);
         std::string_view upgradeType(
-            req->getHeaderValue(boost::beast::http::field::upgrade));
-        if ((req->isUpgrade() &&
+            thisReq->getHeaderValue(boost::beast::http::field::upgrade));
+        if ((thisReq->isUpgrade() &&
              bmcweb::asciiIEquals(upgradeType, "websocket")) ||
             isSse)
         {
             asyncResp->res.setCompleteRequestHandler(
-                [self(shared_from_this())](crow::Response& thisRes) {
+                [self(shared_from_this()),
+                 id(entry.id)](crow::Response& thisRes) {
                 if (thisRes.result() != boost::beast::http::status::ok)
                 {
                     // When any error occurs before handle upgradation,
@@ -314,20 +450,50 @@ class Connection :
                     // which implies successful handle upgrade. Response
                     // needs to be sent over this connection only on
                     // failure.
-                    self->completeRequest(thisRes);
+                    self->completeRequest(id, thisRes);
                     return;
                 }
             });
-            handler->handleUpgrade(req, asyncResp, std::move(adaptor));
+            // The socket belongs to the upgraded connection from here on
+            readClosed = true;
+            handler->handleUpgrade(thisReq, asyncResp, std::move(adaptor));
             return;
         }
         std::string_view expected =
-            req->getHeaderValue(boost::beast::http::field::if_none_match);
+            thisReq->getHeaderValue(boost::beast::http::field::if_none_match);
         if (!expected.empty())
         {
-            res.setExpectedHash(expected);
+            entry.res.setExpectedHash(expected);
+        }
+        handler->handle(thisReq, asyncResp);
+    }
+
+    // Returns false, having already responded, if the connection or the
+    // request is over one of the admission limits
+    bool admitRequest(PipelinedRequest& entry)
+    {
+        AdmissionControl::Decision decision = connectionTicket.getDecision();
+        if (decision == AdmissionControl::Decision::Admit)
+        {
+            entry.requestTicket =
+                AdmissionControl::getInstance().admitRequest(ip);
+            decision = entry.requestTicket.getDecision();
+        }
+        else
+        {
+            // The connection was only kept open to send this response
+            entry.keepAlive = false;
+            readClosed = true;
         }
-        handler->handle(req, asyncResp);
+        if (decision == AdmissionControl::Decision::Admit)
+        {
+            return true;
+        }
+        BMCWEB_LOG_WARNING("{} Request from {} over limit, rejecting",
+                           logPtr(this), ip.to_string());
+        AdmissionControl::setRejectedResponse(entry.res, decision);
+        completeRequest(entry.id, entry.res);
+        return false;
     }
 
     void hardClose()
@@ -354,8 +520,19 @@ class Connection :
         {
             BMCWEB_LOG_DEBUG("{} Removing TLS session: {}", logPtr(this),
                              mtlsSession->uniqueId);
-            persistent_data::SessionStore::getInstance().removeSession(
-                mtlsSession);
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                boost::asio::post(handlerIoContext(),
+                                  [session(std::move(mtlsSession))]() {
+                    persistent_data::SessionStore::getInstance().removeSession(
+                        session);
+                });
+            }
+            else
+            {
+                persistent_data::SessionStore::getInstance().removeSession(
+                    mtlsSession);
+            }
         }
         if constexpr (IsTls<Adaptor>::value)
         {
@@ -368,13 +545,82 @@ class Connection :
         }
     }
 
-    void completeRequest(crow::Response& thisRes)
+    void completeRequest(uint64_t id, crow::Response& thisRes)
+    {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            // Handlers complete on the handler thread; serialize and write
+            // the response on the thread that owns the socket.
+            if (!socketIoContext().get_executor().running_in_this_thread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [self(shared_from_this()), id,
+                                   resIn(std::move(thisRes))]() mutable {
+                    self->completeRequest(id, resIn);
+                });
+                return;
+            }
+        }
+        auto entry = std::ranges::find(pipeline, id, &PipelinedRequest::id);
+        if (entry == pipeline.end())
+        {
+            BMCWEB_LOG_CRITICAL("{} Completed unknown request {}",
+                                logPtr(this), id);
+            return;
+        }
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (entry->req != nullptr && entry->req->session != nullptr)
+            {
+                boost::asio::post(handlerIoContext(),
+                                  [session(std::move(entry->req->session))]() {
+                    authentication::cleanupTempSession(session);
+                });
+            }
+        }
+        entry->requestTicket = AdmissionControl::Ticket();
+        if (&entry->res != &thisRes)
+        {
+            entry->res = std::move(thisRes);
+        }
+        entry->completed = true;
+        writeNext();
+    }
+
+    // Writes the response at the front of the pipeline, if it's ready.
+    // Responses go out in the order the requests came in, whatever order
+    // the handlers finish in.
+    void writeNext()
     {
-        res = std::move(thisRes);
+        if (writing || pipeline.empty() || !pipeline.front().completed)
+        {
+            return;
+        }
+        PipelinedRequest& next = pipeline.front();
+        req = std::move(next.req);
+        res = std::move(next.res);
+        keepAlive = next.keepAlive;
+        bmcweb::AllocationStats allocationsAtStart = next.allocationsAtStart;
+        pipeline.pop_front();
+        writing = true;
+
         res.keepAlive(keepAlive);
+        // Requests rejected before they were parsed get a bare response
+        if (req != nullptr)
+        {
+            completeResponseFields(*req, res);
+            res.addHeader(boost::beast::http::field::date, getCachedDateStr());
+        }
 
-        completeResponseFields(*req, res);
-        res.addHeader(boost::beast::http::field::date, getCachedDateStr());
+        if constexpr (logAllocations)
+        {
+            const bmcweb::AllocationStats& stats =
+                bmcweb::threadAllocationStats();
+            BMCWEB_LOG_DEBUG("{} Request made {} allocations, {} bytes",
+                             logPtr(this),
+                             stats.count - allocationsAtStart.count,
+                             stats.bytes - allocationsAtStart.bytes);
+        }
 
         doWrite();
 
@@ -449,7 +695,7 @@ class Connection :
                     "{} Content length {} valid, but greater than logged out"
                     " limit of {}. Setting unauthorized",
                     logPtr(this), *contentLength, loggedOutPostBodyLimit);
-                res.result(boost::beast::http::status::unauthorized);
+                rejectRequest(boost::beast::http::status::unauthorized);
             }
             else
             {
@@ -459,17 +705,133 @@ class Connection :
                     "{} Content length {} was greater than global limit {}."
                     " Setting payload too large",
                     logPtr(this), *contentLength, httpReqBodyLimit);
-                res.result(boost::beast::http::status::payload_too_large);
+                rejectRequest(boost::beast::http::status::payload_too_large);
             }
+            return false;
+        }
+
+        return true;
+    }
 
+    // Answers the request being read with an error, and stops reading from
+    // the connection
+    void rejectRequest(boost::beast::http::status status)
+    {
+        PipelinedRequest& entry = pipeline.back();
+        entry.res.result(status);
+        entry.keepAlive = false;
+        readClosed = true;
+        reading = false;
+        completeRequest(entry.id, entry.res);
+    }
+
+    // The client has stopped sending requests.  Returns true if the
+    // connection can be closed now; otherwise it's closed once the responses
+    // that are still owed have been sent.
+    bool closeAfterPending()
+    {
+        readClosed = true;
+        reading = false;
+        if (!pipeline.empty())
+        {
+            pipeline.back().keepAlive = false;
+            return false;
+        }
+        if (writing)
+        {
             keepAlive = false;
-            doWrite();
             return false;
         }
-
         return true;
     }
 
+    // Requests that can be handled while earlier ones on the connection are
+    // still outstanding.  Anything that changes state, has a body, or takes
+    // over the connection waits for every earlier response to be sent, and
+    // holds back the requests after it until its own response is sent.
+    static bool
+        canPipeline(const boost::beast::http::request_header<>& header,
+                    bool hasBody)
+    {
+        if (header.method() != boost::beast::http::verb::get &&
+            header.method() != boost::beast::http::verb::head)
+        {
+            return false;
+        }
+        if (hasBody ||
+            header.find(boost::beast::http::field::expect) != header.end() ||
+            header.find(boost::beast::http::field::upgrade) != header.end())
+        {
+            return false;
+        }
+        return !isContentTypeAllowed(header[boost::beast::http::field::accept],
+                                     http_helpers::ContentType::EventStream,
+                                     false);
+    }
+
+    // Starts reading the next request, unless the connection is closing, the
+    // pipeline is full, or the last request has to finish first
+    void readNextRequest()
+    {
+        if (reading || readClosed)
+        {
+            return;
+        }
+        bool idle = pipeline.empty() && !writing;
+        if (exclusive && !idle)
+        {
+            return;
+        }
+        size_t outstanding = pipeline.size() + (writing ? 1U : 0U);
+        if (outstanding >= httpPipelineDepth)
+        {
+            return;
+        }
+        exclusive = false;
+        reading = true;
+        userSession = nullptr;
+        if constexpr (std::is_same_v<Adaptor, boost::asio::ip::tcp::socket>)
+        {
+            // Nothing is left over from the last request, so hold no buffer
+            // or parser until the client sends the next one, and no arena if
+            // nothing else is outstanding.  TLS streams can have data
+            // decrypted but not yet read, so they can't wait on the socket.
+            if (buffer.size() == 0)
+            {
+                if (idle)
+                {
+                    bmcweb::RequestArena::release(std::move(arena));
+                }
+                waitForRequest();
+                return;
+            }
+        }
+        initParser();
+        doReadHeaders();
+    }
+
+    void waitForRequest()
+    {
+        BMCWEB_LOG_DEBUG("{} Waiting for the next request", logPtr(this));
+        adaptor.async_wait(
+            boost::asio::socket_base::wait_read,
+            [this,
+             self(shared_from_this())](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                BMCWEB_LOG_DEBUG("{} Wait for request failed {}", logPtr(this),
+                                 ec.message());
+                if (closeAfterPending())
+                {
+                    hardClose();
+                }
+                return;
+            }
+            initParser();
+            doReadHeaders();
+        });
+    }
+
     void doReadHeaders()
     {
         BMCWEB_LOG_DEBUG("{} doReadHeaders", logPtr(this));
@@ -478,6 +840,7 @@ class Connection :
             BMCWEB_LOG_CRITICAL("Parser was not initialized.");
             return;
         }
+        buffer.acquire();
         // Clean up any previous Connection.
         boost::beast::http::async_read_header(
             adaptor, buffer, *parser,
@@ -489,31 +852,51 @@ class Connection :
 
             if (ec)
             {
-                cancelDeadlineTimer();
+                // The deadline belongs to the response being written, if
+                // there is one
+                if (!writing)
+                {
+                    cancelDeadlineTimer();
+                }
 
                 if (ec == boost::beast::http::error::header_limit)
                 {
                     BMCWEB_LOG_ERROR("{} Header field too large, closing",
                                      logPtr(this), ec.message());
 
-                    res.result(boost::beast::http::status::
-                                   request_header_fields_too_large);
-                    keepAlive = false;
-                    doWrite();
+                    addRequest();
+                    rejectRequest(boost::beast::http::status::
+                                      request_header_fields_too_large);
                     return;
                 }
                 if (ec == boost::beast::http::error::end_of_stream)
                 {
                     BMCWEB_LOG_WARNING("{} End of stream, closing {}",
                                        logPtr(this), ec);
-                    hardClose();
+                    if (closeAfterPending())
+                    {
+                        hardClose();
+                    }
                     return;
                 }
 
                 BMCWEB_LOG_DEBUG("{} Closing socket due to read error {}",
                                  logPtr(this), ec.message());
-                gracefulClose();
+                if (closeAfterPending())
+                {
+                    gracefulClose();
+                }
+
+                return;
+            }
+
+            PipelinedRequest& entry = addRequest();
 
+            // Connections over the limit are only answered with an error, so
+            // don't spend time authenticating them
+            if (!connectionTicket.admitted())
+            {
+                afterReadHeaders();
                 return;
             }
 
@@ -521,36 +904,157 @@ class Connection :
             {
                 if constexpr (!BMCWEB_INSECURE_DISABLE_AUTH)
                 {
-                    boost::beast::http::verb method = parser->get().method();
-                    userSession = crow::authentication::authenticate(
-                        ip, res, method, parser->get().base(), mtlsSession);
+                    if constexpr (BMCWEB_HTTP_THREADS > 1)
+                    {
+                        // The handler thread only gets copies, and hands
+                        // back what it found, so that connection members
+                        // are only ever touched from this thread
+                        boost::asio::post(
+                            handlerIoContext(),
+                            [self(shared_from_this()), id(entry.id),
+                             socketContext(&socketIoContext()), clientIp(ip),
+                             method(parser->get().method()),
+                             header(parser->get().base()),
+                             session(mtlsSession),
+                             username(mtlsUsername)]() mutable {
+                            AuthResult result = authenticateOnHandlerThread(
+                                clientIp, method, header, std::move(session),
+                                username);
+                            boost::asio::post(
+                                *socketContext,
+                                [self, id,
+                                 result(std::move(result))]() mutable {
+                                self->afterAuthenticate(id, std::move(result));
+                            });
+                        });
+                        return;
+                    }
+                    else
+                    {
+                        boost::beast::http::verb method =
+                            parser->get().method();
+                        userSession = crow::authentication::authenticate(
+                            ip, entry.res, method, parser->get().base(),
+                            mtlsSession);
+                    }
                 }
             }
+            afterReadHeaders();
+        });
+    }
 
-            std::string_view expect =
-                parser->get()[boost::beast::http::field::expect];
-            if (bmcweb::asciiIEquals(expect, "100-continue"))
-            {
-                res.result(boost::beast::http::status::continue_);
-                doWrite();
-                return;
-            }
+    PipelinedRequest& addRequest()
+    {
+        PipelinedRequest& entry = pipeline.emplace_back();
+        entry.id = nextRequestId++;
+        return entry;
+    }
 
-            if (!handleContentLengthError())
+    // What authenticating a request came to on the handler io_context
+    struct AuthResult
+    {
+        std::shared_ptr<persistent_data::UserSession> mtlsSession;
+        std::shared_ptr<persistent_data::UserSession> userSession;
+        // Filled in if the request was rejected
+        crow::Response res;
+    };
+
+    // Runs on the handler io_context, which owns the session store.  Only
+    // works on its arguments, since the connection belongs to the socket's
+    // io_context.
+    static AuthResult authenticateOnHandlerThread(
+        const boost::asio::ip::address& ip, boost::beast::http::verb method,
+        const boost::beast::http::header<true>& header,
+        std::shared_ptr<persistent_data::UserSession> mtlsSession,
+        const std::string& mtlsUsername)
+    {
+        AuthResult result;
+        result.mtlsSession = std::move(mtlsSession);
+        if constexpr (BMCWEB_MUTUAL_TLS_AUTH)
+        {
+            if (result.mtlsSession == nullptr && !mtlsUsername.empty() &&
+                persistent_data::SessionStore::getInstance()
+                    .getAuthMethodsConfig()
+                    .tls)
             {
-                return;
+                result.mtlsSession = createMtlsUserSession(ip, mtlsUsername);
             }
+        }
+        result.userSession = crow::authentication::authenticate(
+            ip, result.res, method, header, result.mtlsSession);
+        return result;
+    }
 
-            parser->body_limit(getContentLengthLimit());
+    // Back on the socket's io_context
+    void afterAuthenticate(uint64_t id, AuthResult&& result)
+    {
+        mtlsSession = std::move(result.mtlsSession);
+        mtlsUsername.clear();
+        userSession = std::move(result.userSession);
+        auto entry = std::ranges::find(pipeline, id, &PipelinedRequest::id);
+        if (entry == pipeline.end())
+        {
+            BMCWEB_LOG_CRITICAL("{} Authenticated unknown request {}",
+                                logPtr(this), id);
+            return;
+        }
+        entry->res = std::move(result.res);
+        afterReadHeaders();
+    }
 
-            if (parser->is_done())
+    void afterReadHeaders()
+    {
+        bool pipelinable = canPipeline(parser->get(), !parser->is_done());
+        if (!pipelinable)
+        {
+            if (pipeline.size() > 1 || writing)
             {
-                handle();
+                BMCWEB_LOG_DEBUG(
+                    "{} Waiting for earlier responses before handling request",
+                    logPtr(this));
+                waitingForDrain = true;
                 return;
             }
+            exclusive = true;
+        }
 
-            doRead();
-        });
+        std::string_view expect =
+            parser->get()[boost::beast::http::field::expect];
+        if (bmcweb::asciiIEquals(expect, "100-continue"))
+        {
+            res.result(boost::beast::http::status::continue_);
+            writing = true;
+            doWrite();
+            return;
+        }
+
+        if (!handleContentLengthError())
+        {
+            return;
+        }
+
+        parser->body_limit(getContentLengthLimit());
+
+        if (parser->is_done())
+        {
+            handle();
+            finishReading();
+            return;
+        }
+
+        doRead();
+    }
+
+    // Called once a request has been handed off, to start reading the one
+    // after it
+    void finishReading()
+    {
+        reading = false;
+        // Give back the read buffer, unless the client has already sent part
+        // of the next request
+        parser.reset();
+        buffer.release();
+        readNextRequest();
     }
 
     void doRead()
@@ -560,6 +1064,7 @@ class Connection :
         {
             return;
         }
+        buffer.acquire();
         startDeadline();
         boost::beast::http::async_read_some(
             adaptor, buffer, *parser,
@@ -580,10 +1085,8 @@ class Connection :
                         BMCWEB_LOG_CRITICAL("Body length limit reached, "
                                             "but no content-length "
                                             "available?  Should never happen");
-                        res.result(
+                        rejectRequest(
                             boost::beast::http::status::internal_server_error);
-                        keepAlive = false;
-                        doWrite();
                     }
                     return;
                 }
@@ -607,6 +1110,7 @@ class Connection :
 
             cancelDeadlineTimer();
             handle();
+            finishReading();
         });
     }
 
@@ -631,6 +1135,7 @@ class Connection :
             return;
         }
 
+        writing = false;
         if (res.result() == boost::beast::http::status::continue_)
         {
             // Reset the result to ok
@@ -650,12 +1155,19 @@ class Connection :
 
         BMCWEB_LOG_DEBUG("{} Clearing response", logPtr(this));
         res.clear();
-        initParser();
-
-        userSession = nullptr;
+        if (req != nullptr)
+        {
+            req->clear();
+        }
+        req.reset();
 
-        req->clear();
-        doReadHeaders();
+        if (waitingForDrain && pipeline.size() == 1)
+        {
+            waitingForDrain = false;
+            afterReadHeaders();
+        }
+        writeNext();
+        readNextRequest();
     }
 
     void doWrite()
@@ -664,6 +1176,14 @@ class Connection :
         res.preparePayload();
 
         startDeadline();
+        if constexpr (std::is_same_v<Adaptor, boost::asio::ip::tcp::socket>)
+        {
+            if (canSendFile())
+            {
+                doWriteFileHeader();
+                return;
+            }
+        }
         boost::beast::async_write(
             adaptor,
             boost::beast::http::message_generator(std::move(res.response)),
@@ -671,62 +1191,159 @@ class Connection :
                             shared_from_this()));
     }
 
-    void cancelDeadlineTimer()
+    // Raw files on a plaintext socket are handed to the kernel with
+    // sendfile(2), rather than being read into userspace and written back
+    // out.  TLS streams always go through HttpBody::writer; asio's ssl::stream
+    // encrypts into a memory BIO, so OpenSSL can't use kTLS on it.
+    bool canSendFile()
     {
-        timer.cancel();
+        bmcweb::HttpBody::value_type& body = res.response.body();
+        if (!body.file().is_open() || body.isJson() ||
+            body.encodingType != bmcweb::EncodingType::Raw)
+        {
+            return false;
+        }
+        // Unknown sizes (pipes), multipart/byteranges and bodies that
+        // preparePayload() dropped are left to the writer
+        std::optional<size_t> size = body.payloadSize();
+        if (!size || *size == 0 || res.response.chunked() ||
+            body.ranges().size() > 1)
+        {
+            return false;
+        }
+        using boost::beast::http::status;
+        return boost::beast::http::to_status_class(res.result()) !=
+                   boost::beast::http::status_class::informational &&
+               res.result() != status::no_content &&
+               res.result() != status::not_modified;
     }
 
-    void startDeadline()
+    void doWriteFileHeader()
     {
-        // Timer is already started so no further action is required.
-        if (timerStarted)
+        BMCWEB_LOG_DEBUG("{} Sending file with sendfile", logPtr(this));
+        const bmcweb::HttpBody::value_type& body = res.response.body();
+        sendFileOffset = 0;
+        sendFileEnd = body.payloadSize().value_or(0);
+        if (!body.ranges().empty())
         {
-            return;
+            sendFileOffset = body.ranges().front().offset;
+            sendFileEnd = sendFileOffset + body.ranges().front().length;
         }
+        headerWriter.emplace(res.response.base(), res.response.version(),
+                             res.response.result_int());
+        boost::asio::async_write(
+            adaptor, headerWriter->get(),
+            std::bind_front(&self_type::afterWriteFileHeader, this,
+                            shared_from_this()));
+    }
 
-        std::chrono::seconds timeout(15);
+    void afterWriteFileHeader(const std::shared_ptr<self_type>& self,
+                              const boost::system::error_code& ec,
+                              std::size_t bytesTransferred)
+    {
+        headerWriter.reset();
+        if (ec)
+        {
+            afterDoWrite(self, ec, bytesTransferred);
+            return;
+        }
+        boost::system::error_code nonBlockEc;
+        adaptor.native_non_blocking(true, nonBlockEc);
+        if (nonBlockEc)
+        {
+            afterDoWrite(self, nonBlockEc, bytesTransferred);
+            return;
+        }
+        doSendFile(self);
+    }
 
-        std::weak_ptr<Connection<Adaptor, Handler>> weakSelf = weak_from_this();
-        timer.expires_after(timeout);
-        timer.async_wait([weakSelf](const boost::system::error_code& ec) {
-            // Note, we are ignoring other types of errors here;  If the timer
-            // failed for any reason, we should still close the connection
-            std::shared_ptr<Connection<Adaptor, Handler>> self =
-                weakSelf.lock();
-            if (!self)
+    void doSendFile(const std::shared_ptr<self_type>& self)
+    {
+        int socketFd = adaptor.native_handle();
+        int fileFd = res.response.body().file().native_handle();
+        // Stop after a chunk so one large file doesn't hold up every other
+        // connection on this thread
+        size_t chunkEnd = std::min(sendFileEnd,
+                                   sendFileOffset + sendFileChunkSize);
+        while (sendFileOffset < chunkEnd)
+        {
+            off_t offset = static_cast<off_t>(sendFileOffset);
+            ssize_t sent = sendfile(socketFd, fileFd, &offset,
+                                    chunkEnd - sendFileOffset);
+            if (sent < 0 && errno == EINTR)
             {
-                if (ec == boost::asio::error::operation_aborted)
-                {
-                    BMCWEB_LOG_DEBUG(
-                        "{} Timer canceled on connection being destroyed",
-                        logPtr(self.get()));
-                    return;
-                }
-                BMCWEB_LOG_CRITICAL("{} Failed to capture connection",
-                                    logPtr(self.get()));
+                continue;
+            }
+            if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+            if (sent <= 0)
+            {
+                // sendfile returns 0 if the file shrank after Content-Length
+                // was sent; there's no way to recover the response then
+                boost::system::error_code ec =
+                    sent < 0 ? boost::system::error_code(
+                                   errno, boost::system::system_category())
+                             : boost::system::errc::make_error_code(
+                                   boost::system::errc::io_error);
+                BMCWEB_LOG_ERROR("{} sendfile failed at offset {}: {}",
+                                 logPtr(this), sendFileOffset, ec.message());
+                afterDoWrite(self, ec, sendFileOffset);
                 return;
             }
-
-            self->timerStarted = false;
-
+            sendFileOffset += static_cast<size_t>(sent);
+        }
+        if (sendFileOffset == sendFileEnd)
+        {
+            afterDoWrite(self, {}, sendFileOffset);
+            return;
+        }
+        adaptor.async_wait(
+            boost::asio::socket_base::wait_write,
+            [self](const boost::system::error_code& ec) {
             if (ec)
             {
-                if (ec == boost::asio::error::operation_aborted)
+                self->afterDoWrite(self, ec, self->sendFileOffset);
+                return;
+            }
+            self->doSendFile(self);
+        });
+    }
+
+    void cancelDeadlineTimer()
+    {
+        deadline.cancel();
+    }
+
+    void startDeadline()
+    {
+        // Timer is already started so no further action is required.
+        if (deadline.isArmed())
+        {
+            return;
+        }
+        if (!deadline.hasCallback())
+        {
+            deadline.setCallback([weakSelf(weak_from_this())]() {
+                std::shared_ptr<Connection<Adaptor, Handler>> self =
+                    weakSelf.lock();
+                if (!self)
                 {
-                    BMCWEB_LOG_DEBUG("{} Timer canceled", logPtr(self.get()));
+                    BMCWEB_LOG_DEBUG(
+                        "Timer fired on connection being destroyed");
                     return;
                 }
-                BMCWEB_LOG_CRITICAL("{} Timer failed {}", logPtr(self.get()),
-                                    ec);
-            }
-
-            BMCWEB_LOG_WARNING("{} Connection timed out, hard closing",
-                               logPtr(self.get()));
+                BMCWEB_LOG_WARNING("{} Connection timed out, hard closing",
+                                   logPtr(self.get()));
 
-            self->hardClose();
-        });
+                self->hardClose();
+            });
+        }
 
-        timerStarted = true;
+        std::chrono::seconds timeout(15);
+        deadline.arm(bmcweb::TimerWheel::getInstance(socketIoContext()),
+                     timeout);
         BMCWEB_LOG_DEBUG("{} timer started", logPtr(this));
     }
 
@@ -739,19 +1356,50 @@ class Connection :
     // re-created on Connection reset
     std::optional<boost::beast::http::request_parser<bmcweb::HttpBody>> parser;
 
-    boost::beast::flat_static_buffer<8192> buffer;
+    bmcweb::PooledFlatBuffer<httpReadBufferSize> buffer;
+
+    // Holds the Request, AsyncResp and response headers of each request.
+    // Taken from the thread's pool when a request arrives, and given back
+    // while the connection is idle.
+    std::shared_ptr<bmcweb::RequestArena> arena;
+    // Requests that are being handled, or whose responses are waiting on an
+    // earlier one, in the order they were read.  Responses leave from the
+    // front as they're written.
+    std::deque<PipelinedRequest> pipeline;
+    uint64_t nextRequestId = 0;
 
+    // The request and response being written
     std::shared_ptr<crow::Request> req;
     crow::Response res;
+    bool keepAlive = true;
+    bool writing = false;
+
+    // A request is being read; true to begin with, as start() reads the first
+    bool reading = true;
+    // No more requests will be read from the connection
+    bool readClosed = false;
+    // The last request handled can't run alongside others, so nothing more
+    // is read until its response has been sent
+    bool exclusive = false;
+    // A request has been read that can't run alongside others, and is
+    // waiting for the responses before it to be sent
+    bool waitingForDrain = false;
+
+    // State of a response body being sent with sendfile(2)
+    static constexpr size_t sendFileChunkSize = 1024UL * 1024UL;
+    std::optional<crow::Response::Fields::writer> headerWriter;
+    size_t sendFileOffset = 0;
+    size_t sendFileEnd = 0;
+
+    AdmissionControl::Ticket connectionTicket;
 
     std::shared_ptr<persistent_data::UserSession> userSession;
     std::shared_ptr<persistent_data::UserSession> mtlsSession;
+    // Verified client certificate user, pending session creation on the
+    // handler thread.  Only used with more than one HTTP thread.
+    std::string mtlsUsername;
 
-    boost::asio::steady_timer timer;
-
-    bool keepAlive = true;
-
-    bool timerStarted = false;
+    bmcweb::Deadline deadline;
 
     std::function<std::string()>& getCachedDateStr;
 
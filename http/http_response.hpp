@@ -1,17 +1,26 @@
 #pragma once
 #include "http_body.hpp"
+#include "http_utility.hpp"
+#include "json_serializer.hpp"
 #include "logging.hpp"
+#include "ossl_random.hpp"
+#include "request_arena.hpp"
 #include "utils/hex_utils.hpp"
 
 #include <fcntl.h>
 
+#include <boost/beast/http/fields.hpp>
 #include <boost/beast/http/message.hpp>
 #include <nlohmann/json.hpp>
 
+#include <format>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace crow
 {
@@ -26,10 +35,14 @@ struct Response
     template <typename Adaptor, typename Handler>
     friend class crow::Connection;
 
-    http::response<bmcweb::HttpBody> response;
+    // Headers are allocated from the arena of the request being answered,
+    // when there is one
+    using Fields = http::basic_fields<bmcweb::ArenaAllocator<char>>;
+    using response_type = http::response<bmcweb::HttpBody, Fields>;
+    response_type response;
 
     nlohmann::json jsonValue;
-    using fields_type = http::header<false, http::fields>;
+    using fields_type = http::header<false, Fields>;
     fields_type& fields()
     {
         return response.base();
@@ -56,6 +69,10 @@ struct Response
     }
 
     Response() = default;
+    explicit Response(const bmcweb::ArenaAllocator<char>& fieldsAlloc) :
+        response(std::piecewise_construct, std::make_tuple(),
+                 std::make_tuple(fieldsAlloc))
+    {}
     Response(Response&& res) noexcept :
         response(std::move(res.response)), jsonValue(std::move(res.jsonValue)),
         completed(res.completed)
@@ -227,9 +244,43 @@ struct Response
 
     void write(std::string&& bodyPart)
     {
+        response.body().shared(nullptr);
         response.body().str() = std::move(bodyPart);
     }
 
+    // Sends data that outlives the response, and may be shared between
+    // several responses at once, without copying it
+    void writeShared(std::shared_ptr<const std::string> data)
+    {
+        response.body().str().clear();
+        response.body().shared(std::move(data));
+    }
+
+    // Serializes jsonValue into the body.  Documents that fit in a single
+    // chunk are written immediately, so they're sent with a Content-Length.
+    // Larger ones are moved into the body and serialized as they're sent, so
+    // the document is never held in memory as a complete string.
+    void writeJson(int indent)
+    {
+        // Moved to the heap first, so that a larger document can be handed to
+        // the body along with the serializer, which carries on from the first
+        // chunk rather than starting again
+        auto document = std::make_unique<nlohmann::json>(std::move(jsonValue));
+        jsonValue = nullptr;
+        std::string out;
+        bmcweb::JsonSerializer serializer(*document, indent);
+        serializer.fill(out);
+        if (serializer.done())
+        {
+            jsonValue = std::move(*document);
+            write(std::move(out));
+            return;
+        }
+        BMCWEB_LOG_DEBUG("{} Streaming json response", logPtr(this));
+        response.body().json(std::move(document), indent,
+                             std::move(serializer), std::move(out));
+    }
+
     void end()
     {
         if (completed)
@@ -275,12 +326,17 @@ struct Response
         }
         size_t hashval = std::hash<nlohmann::json>{}(jsonValue);
         std::string hexVal = "\"" + intToHexString(hashval, 8) + "\"";
-        addHeader(http::field::etag, hexVal);
-        if (expectedHash && hexVal == *expectedHash)
+        // A client holding a compressed copy sent the tag of that coding,
+        // which is still current if the hash is
+        if (expectedHash &&
+            http_helpers::etagMatchesAnyEncoding(*expectedHash, hexVal))
         {
+            addHeader(http::field::etag, *expectedHash);
             jsonValue = nullptr;
             result(http::status::not_modified);
+            return;
         }
+        addHeader(http::field::etag, hexVal);
     }
 
     void setExpectedHash(std::string_view hash)
@@ -321,6 +377,71 @@ struct Response
         return true;
     }
 
+    // Narrows a file body down to the given ranges of its payload, as a 206
+    // Partial Content response; several ranges are sent as
+    // multipart/byteranges.  An empty list means none of the ranges the
+    // client asked for exist, which is a 416.  Returns false, leaving the
+    // response alone, if the body can't be sent in ranges.
+    bool setByteRanges(const std::vector<http_helpers::ByteRange>& ranges)
+    {
+        bmcweb::HttpBody::value_type& body = response.body();
+        std::optional<size_t> size = body.payloadSize();
+        if (!body.file().is_open() || !body.rawFileSize() || !size)
+        {
+            return false;
+        }
+        if (ranges.empty())
+        {
+            body.clear();
+            result(http::status::range_not_satisfiable);
+            addHeader(http::field::content_range,
+                      std::format("bytes */{}", *size));
+            return true;
+        }
+        std::vector<bmcweb::FileRange> fileRanges;
+        std::string trailer;
+        if (ranges.size() == 1)
+        {
+            const http_helpers::ByteRange& range = ranges.front();
+            addHeader(http::field::content_range,
+                      std::format("bytes {}-{}/{}", range.first, range.last,
+                                  *size));
+            fileRanges.push_back(
+                {range.first, range.last - range.first + 1, std::string()});
+        }
+        else
+        {
+            std::string boundary = bmcweb::getRandomIdOfLength(32);
+            if (boundary.empty())
+            {
+                return false;
+            }
+            std::string contentType(
+                getHeaderValue(http::field::content_type));
+            for (const http_helpers::ByteRange& range : ranges)
+            {
+                bmcweb::FileRange& fileRange = fileRanges.emplace_back();
+                fileRange.offset = range.first;
+                fileRange.length = range.last - range.first + 1;
+                fileRange.header = std::format("\r\n--{}\r\n", boundary);
+                if (!contentType.empty())
+                {
+                    fileRange.header += std::format("Content-Type: {}\r\n",
+                                                    contentType);
+                }
+                fileRange.header += std::format(
+                    "Content-Range: bytes {}-{}/{}\r\n\r\n", range.first,
+                    range.last, *size);
+            }
+            trailer = std::format("\r\n--{}--\r\n", boundary);
+            response.set(http::field::content_type,
+                         "multipart/byteranges; boundary=" + boundary);
+        }
+        body.setRanges(std::move(fileRanges), std::move(trailer));
+        result(http::status::partial_content);
+        return true;
+    }
+
   private:
     std::optional<std::string> expectedHash;
     bool completed = false;
@@ -9,7 +9,6 @@
 #include <boost/asio/signal_set.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/stream.hpp>
-#include <boost/asio/steady_timer.hpp>
 
 #include <atomic>
 #include <chrono>
@@ -33,7 +32,7 @@ class Server
            std::shared_ptr<boost::asio::io_context> io) :
         ioService(std::move(io)),
         acceptor(std::move(acceptorIn)),
-        signals(*ioService, SIGINT, SIGTERM, SIGHUP), handler(handlerIn),
+        signals(*ioService), handler(handlerIn),
         adaptorCtx(std::move(adaptorCtxIn))
     {}
 
@@ -50,14 +49,12 @@ class Server
         dateStr.resize(dateStrSz);
     }
 
-    void run()
+    void startDateCache()
     {
-        loadCertificate();
         updateDateStr();
+        lastDateUpdate = std::chrono::steady_clock::now();
 
         getCachedDateStr = [this]() -> std::string {
-            static std::chrono::time_point<std::chrono::steady_clock>
-                lastDateUpdate = std::chrono::steady_clock::now();
             if (std::chrono::steady_clock::now() - lastDateUpdate >=
                 std::chrono::seconds(10))
             {
@@ -66,13 +63,46 @@ class Server
             }
             return dateStr;
         };
+    }
+
+    void run()
+    {
+        loadCertificate();
+        startDateCache();
 
         BMCWEB_LOG_INFO("bmcweb server is running, local endpoint {}",
                         acceptor.local_endpoint().address().to_string());
+        signals.add(SIGINT);
+        signals.add(SIGTERM);
+        signals.add(SIGHUP);
         startAsyncWaitForSignal();
         doAccept();
     }
 
+    // Runs an additional acceptor on a worker io_context.  Workers don't own
+    // signals or certificates; the main server pushes a new TLS context to
+    // them through setSslContext when the certificate is reloaded.
+    void runWorker()
+    {
+        startDateCache();
+
+        BMCWEB_LOG_INFO("bmcweb worker is running, local endpoint {}",
+                        acceptor.local_endpoint().address().to_string());
+        doAccept();
+    }
+
+    void setSslContext(std::shared_ptr<boost::asio::ssl::context> ctx)
+    {
+        adaptorCtx = std::move(ctx);
+        boost::system::error_code ec;
+        acceptor.cancel(ec);
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("Error while canceling async operations:{}",
+                             ec.message());
+        }
+    }
+
     void loadCertificate()
     {
         if constexpr (BMCWEB_INSECURE_DISABLE_SSL)
@@ -130,7 +160,6 @@ class Server
             BMCWEB_LOG_CRITICAL("IoService was null");
             return;
         }
-        boost::asio::steady_timer timer(*ioService);
         std::shared_ptr<Connection<Adaptor, Handler>> connection;
         if constexpr (std::is_same<Adaptor,
                                    boost::asio::ssl::stream<
@@ -143,14 +172,12 @@ class Server
                 return;
             }
             connection = std::make_shared<Connection<Adaptor, Handler>>(
-                handler, std::move(timer), getCachedDateStr,
-                Adaptor(*ioService, *adaptorCtx));
+                handler, getCachedDateStr, Adaptor(*ioService, *adaptorCtx));
         }
         else
         {
             connection = std::make_shared<Connection<Adaptor, Handler>>(
-                handler, std::move(timer), getCachedDateStr,
-                Adaptor(*ioService));
+                handler, getCachedDateStr, Adaptor(*ioService));
         }
         acceptor.async_accept(
             boost::beast::get_lowest_layer(connection->socket()),
@@ -171,6 +198,7 @@ class Server
     boost::asio::signal_set signals;
 
     std::string dateStr;
+    std::chrono::time_point<std::chrono::steady_clock> lastDateUpdate;
 
     Handler* handler;
 
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace bmcweb
+{
+
+// Incremental equivalent of
+// nlohmann::json::dump(indent, ' ', true, error_handler_t::replace).
+// Each call to fill() appends roughly chunkSize bytes of the document, so
+// large responses can be sent while they're being serialized, rather than
+// being fully materialized in a string first.
+class JsonSerializer
+{
+  public:
+    // Large enough that most responses are serialized in a single pass.
+    // Nginx uses 16-32KB chunks for similar purposes.
+    static constexpr size_t chunkSize = 1024UL * 16UL;
+
+    JsonSerializer(const nlohmann::json& rootIn, int indentIn) :
+        root(rootIn), indent(indentIn)
+    {}
+
+    // Appends output to out until at least minBytes have been written, or the
+    // document is complete.  A single scalar value is never split, so a call
+    // may return more than minBytes.
+    void fill(std::string& out, size_t minBytes = chunkSize)
+    {
+        size_t start = out.size();
+        if (!started)
+        {
+            started = true;
+            writeValue(root, out);
+        }
+        while (!stack.empty() && out.size() - start < minBytes)
+        {
+            Frame& frame = stack.back();
+            if (frame.it == frame.value->cend())
+            {
+                bool isObject = frame.value->is_object();
+                stack.pop_back();
+                writeNewline(out, stack.size());
+                out += isObject ? '}' : ']';
+                continue;
+            }
+            if (!frame.first)
+            {
+                out += ',';
+            }
+            frame.first = false;
+            writeNewline(out, stack.size());
+            if (frame.value->is_object())
+            {
+                writeString(frame.it.key(), out);
+                out += indent >= 0 ? ": " : ":";
+            }
+            const nlohmann::json& child = *frame.it;
+            // Advance before writing, as writing may grow the stack and
+            // invalidate frame
+            ++frame.it;
+            writeValue(child, out);
+        }
+    }
+
+    bool done() const
+    {
+        return started && stack.empty();
+    }
+
+  private:
+    struct Frame
+    {
+        const nlohmann::json* value;
+        nlohmann::json::const_iterator it;
+        bool first = true;
+    };
+
+    void writeNewline(std::string& out, size_t depth) const
+    {
+        if (indent < 0)
+        {
+            return;
+        }
+        out += '\n';
+        out.append(depth * static_cast<size_t>(indent), ' ');
+    }
+
+    void writeValue(const nlohmann::json& value, std::string& out)
+    {
+        if (value.is_object() || value.is_array())
+        {
+            if (value.empty())
+            {
+                out += value.is_object() ? "{}" : "[]";
+                return;
+            }
+            out += value.is_object() ? '{' : '[';
+            stack.emplace_back(Frame{&value, value.cbegin()});
+            return;
+        }
+        // Scalars other than floats are written directly, rather than
+        // through a temporary string from dump()
+        switch (value.type())
+        {
+            case nlohmann::json::value_t::string:
+                writeString(*value.get_ptr<const std::string*>(), out);
+                return;
+            case nlohmann::json::value_t::boolean:
+                out += *value.get_ptr<const bool*>() ? "true" : "false";
+                return;
+            case nlohmann::json::value_t::null:
+                out += "null";
+                return;
+            case nlohmann::json::value_t::number_integer:
+                std::format_to(std::back_inserter(out), "{}",
+                               *value.get_ptr<const int64_t*>());
+                return;
+            case nlohmann::json::value_t::number_unsigned:
+                std::format_to(std::back_inserter(out), "{}",
+                               *value.get_ptr<const uint64_t*>());
+                return;
+            default:
+                break;
+        }
+        out += value.dump(-1, ' ', true,
+                          nlohmann::json::error_handler_t::replace);
+    }
+
+    static void writeString(std::string_view str, std::string& out)
+    {
+        // Most keys and values are plain ASCII and need no escaping; let
+        // nlohmann handle anything else so the output is identical to dump()
+        for (char c : str)
+        {
+            if (c < 0x20 || c > 0x7E || c == '"' || c == '\\')
+            {
+                out += nlohmann::json(str).dump(
+                    -1, ' ', true, nlohmann::json::error_handler_t::replace);
+                return;
+            }
+        }
+        out += '"';
+        out += str;
+        out += '"';
+    }
+
+    const nlohmann::json& root;
+    int indent;
+    bool started = false;
+    // Deep enough for nearly every Redfish resource without allocating
+    boost::container::small_vector<Frame, 8> stack;
+};
+
+} // namespace bmcweb
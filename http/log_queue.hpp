@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace crow
+{
+
+// One log line, formatted straight into its slot in the LogQueue.  Lines
+// that don't fit in the slot spill over into a string, which is the only
+// time logging allocates.
+class LogMessage
+{
+  public:
+    static constexpr size_t inlineSize = 496;
+
+    template <typename... Args>
+    void format(std::format_string<Args...> fmt, Args&&... args)
+    {
+        if (overflow.empty())
+        {
+            size_t remaining = data.size() - size;
+            auto result = std::format_to_n(
+                std::next(data.begin(), static_cast<std::ptrdiff_t>(size)),
+                static_cast<std::ptrdiff_t>(remaining), fmt,
+                std::forward<Args>(args)...);
+            if (static_cast<size_t>(result.size) <= remaining)
+            {
+                size += static_cast<size_t>(result.size);
+                return;
+            }
+            overflow.assign(data.data(), size);
+        }
+        // The format functions only ever read their arguments, so they can
+        // be passed again
+        // NOLINTNEXTLINE(bugprone-use-after-move)
+        std::format_to(std::back_inserter(overflow), fmt,
+                       std::forward<Args>(args)...);
+    }
+
+    void append(char c)
+    {
+        if (overflow.empty() && size < data.size())
+        {
+            data[size++] = c;
+            return;
+        }
+        if (overflow.empty())
+        {
+            overflow.assign(data.data(), size);
+        }
+        overflow += c;
+    }
+
+    std::string_view view() const
+    {
+        if (!overflow.empty())
+        {
+            return overflow;
+        }
+        return {data.data(), size};
+    }
+
+    void clear()
+    {
+        size = 0;
+        overflow.clear();
+        overflow.shrink_to_fit();
+    }
+
+  private:
+    std::array<char, inlineSize> data{};
+    size_t size = 0;
+    std::string overflow;
+};
+
+// A bounded, lock free queue of log lines, written out by a background
+// thread, so that logging never waits on stdout.  Any number of threads can
+// push; a push that finds the queue full drops the line, and the drop is
+// reported the next time the queue is written out.
+//
+// Slots carry a sequence number, so producers claim a slot with a single
+// compare and swap on the tail, and the writer can tell a claimed slot that
+// isn't finished yet from one that is.
+class LogQueue
+{
+  public:
+    using Sink = void (*)(std::string_view);
+
+    LogQueue(size_t capacityIn, Sink sinkIn) :
+        capacity(std::bit_ceil(std::max<size_t>(capacityIn, 2))),
+        mask(capacity - 1), slots(std::make_unique<Slot[]>(capacity)),
+        sink(sinkIn)
+    {
+        for (size_t i = 0; i < capacity; i++)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~LogQueue()
+    {
+        stop();
+    }
+
+    LogQueue(const LogQueue&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+    LogQueue(LogQueue&&) = delete;
+    LogQueue& operator=(LogQueue&&) = delete;
+
+    // The queue that BMCWEB_LOG_* writes to, when async-logging is enabled.
+    // It's never destroyed, so that logging from static destructors is
+    // still safe; whatever is left is written out at exit.
+    static LogQueue& getInstance(size_t capacityIn)
+    {
+        static LogQueue* queue = [capacityIn]() {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            LogQueue* newQueue = new LogQueue(capacityIn, &writeStdout);
+            newQueue->start();
+            std::atexit([]() { getInstance(0).flush(); });
+            return newQueue;
+        }();
+        return *queue;
+    }
+
+    // Claims a slot, and calls writeMessage(LogMessage&) to fill it.  Returns
+    // false, without calling writeMessage, if the queue is full.
+    template <typename Writer>
+    bool push(Writer&& writeMessage) noexcept
+    {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &slots[pos & mask];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence == pos)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (sequence < pos)
+            {
+                // The writer hasn't got to this slot since the last lap
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        try
+        {
+            writeMessage(slot->message);
+        }
+        catch (...)
+        {
+            slot->message.clear();
+            slot->message.format("Failed to format\n");
+        }
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        generation.fetch_add(1, std::memory_order_seq_cst);
+        if (writerWaiting.load(std::memory_order_seq_cst))
+        {
+            generation.notify_one();
+        }
+        return true;
+    }
+
+    // Writes out everything queued so far on the calling thread
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        drain();
+    }
+
+    void start()
+    {
+        if (writer.joinable())
+        {
+            return;
+        }
+        stopping.store(false);
+        writer = std::thread([this]() { run(); });
+    }
+
+    // Stops the background thread, once it has written out the queue
+    void stop()
+    {
+        if (!writer.joinable())
+        {
+            return;
+        }
+        stopping.store(true);
+        generation.fetch_add(1);
+        generation.notify_one();
+        writer.join();
+    }
+
+    uint64_t getDropped() const
+    {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    size_t getCapacity() const
+    {
+        return capacity;
+    }
+
+  private:
+    struct alignas(64) Slot
+    {
+        std::atomic<size_t> sequence = 0;
+        LogMessage message;
+    };
+
+    static void writeStdout(std::string_view line)
+    {
+        // Intentionally ignore error return.
+        fwrite(line.data(), sizeof(char), line.size(), stdout);
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            uint32_t seen = generation.load();
+            {
+                std::lock_guard<std::mutex> lock(writerMutex);
+                drain();
+            }
+            if (stopping.load())
+            {
+                std::lock_guard<std::mutex> lock(writerMutex);
+                drain();
+                return;
+            }
+            writerWaiting.store(true);
+            generation.wait(seen);
+            writerWaiting.store(false);
+        }
+    }
+
+    // Must hold writerMutex
+    void drain()
+    {
+        bool wrote = false;
+        while (true)
+        {
+            Slot& slot = slots[head & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            {
+                break;
+            }
+            sink(slot.message.view());
+            slot.message.clear();
+            slot.sequence.store(head + capacity, std::memory_order_release);
+            head++;
+            wrote = true;
+        }
+        uint64_t droppedNow = dropped.load(std::memory_order_relaxed);
+        if (droppedNow != reportedDropped)
+        {
+            std::array<char, 64> notice{};
+            auto result = std::format_to_n(
+                notice.begin(), notice.size(),
+                "[WARNING log_queue.hpp] {} log lines dropped\n",
+                droppedNow - reportedDropped);
+            sink({notice.data(), static_cast<size_t>(result.out -
+                                                     notice.begin())});
+            reportedDropped = droppedNow;
+            wrote = true;
+        }
+        if (wrote && sink == &writeStdout)
+        {
+            fflush(stdout);
+        }
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::unique_ptr<Slot[]> slots;
+    const Sink sink;
+
+    alignas(64) std::atomic<size_t> tail = 0;
+    alignas(64) std::atomic<uint64_t> dropped = 0;
+    std::atomic<uint32_t> generation = 0;
+    std::atomic<bool> writerWaiting = false;
+    std::atomic<bool> stopping = false;
+
+    // Only the writer side locks, so that a flush at exit can't race the
+    // background thread
+    std::mutex writerMutex;
+    size_t head = 0;
+    uint64_t reportedDropped = 0;
+    std::thread writer;
+};
+
+} // namespace crow
@@ -1,10 +1,16 @@
 #pragma once
 
 #include "bmcweb_config.h"
+#include "log_queue.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <bit>
 #include <format>
 #include <iostream>
+#include <mutex>
+#include <optional>
 #include <source_location>
 #include <string_view>
 #include <system_error>
@@ -52,10 +58,175 @@ constexpr crow::LogLevel getLogLevelFromName(std::string_view name)
     return crow::LogLevel::Disabled;
 }
 
-// configured bmcweb LogLevel
+// configured bmcweb LogLevel, that logging starts out at
 constexpr crow::LogLevel bmcwebCurrentLoggingLevel =
     getLogLevelFromName(BMCWEB_LOGGING_LEVEL);
 
+// Highest LogLevel compiled in.  Logging can be turned up to this at runtime;
+// anything above it is compiled out.
+constexpr crow::LogLevel bmcwebMaxLoggingLevel =
+    std::max(bmcwebCurrentLoggingLevel,
+             getLogLevelFromName(BMCWEB_LOGGING_MAX_LEVEL));
+
+// Parts of bmcweb whose logging can be turned up or down on its own.  Each
+// log line belongs to the category of the file it's logged from, unless the
+// call site names one with the BMCWEB_LOG_*_CAT macros.
+enum class LogCategory
+{
+    Http = 0,
+    Routing,
+    Dbus,
+    EventService,
+    Aggregation,
+    Sensors,
+    Redfish,
+    Other,
+};
+
+constexpr std::array<std::string_view, 8> mapLogCategoryFromName{
+    "http",    "routing", "dbus",    "eventservice", "aggregation",
+    "sensors", "redfish", "other"};
+
+constexpr std::optional<LogCategory> getLogCategoryFromName(
+    std::string_view name)
+{
+    const auto* iter = std::ranges::find(mapLogCategoryFromName, name);
+    if (iter != mapLogCategoryFromName.end())
+    {
+        return static_cast<LogCategory>(iter - mapLogCategoryFromName.begin());
+    }
+    return std::nullopt;
+}
+
+constexpr LogCategory getLogCategoryFromPath(std::string_view path)
+{
+    std::string_view filename = path.substr(path.rfind('/') + 1);
+    if (path.find("/routing") != std::string_view::npos ||
+        filename.starts_with("router"))
+    {
+        return LogCategory::Routing;
+    }
+    if (filename.find("aggregat") != std::string_view::npos)
+    {
+        return LogCategory::Aggregation;
+    }
+    if (filename.find("event") != std::string_view::npos)
+    {
+        return LogCategory::EventService;
+    }
+    for (std::string_view sensorFile : {"sensor", "thermal", "power", "fan"})
+    {
+        if (filename.find(sensorFile) != std::string_view::npos)
+        {
+            return LogCategory::Sensors;
+        }
+    }
+    if (filename.find("dbus") != std::string_view::npos)
+    {
+        return LogCategory::Dbus;
+    }
+    if (path.find("http/") != std::string_view::npos)
+    {
+        return LogCategory::Http;
+    }
+    // Any other Redfish resource
+    if (path.find("redfish-core/") != std::string_view::npos)
+    {
+        return LogCategory::Redfish;
+    }
+    return LogCategory::Other;
+}
+
+// The levels logging is currently at.  Reading them is a relaxed atomic load,
+// so that a call site that's turned off costs one compare.
+class RuntimeLogLevels
+{
+  public:
+    static RuntimeLogLevels& getInstance();
+
+    // Highest level of any category; nothing above it is logged
+    LogLevel getMax() const
+    {
+        return maxLevel.load(std::memory_order_relaxed);
+    }
+
+    // Whether every category is at the same level, so that lines don't need
+    // to be checked against their own category
+    bool isUniform() const
+    {
+        return uniform.load(std::memory_order_relaxed);
+    }
+
+    LogLevel get(LogCategory category) const
+    {
+        return levels[static_cast<size_t>(category)].load(
+            std::memory_order_relaxed);
+    }
+
+    // Levels above bmcwebMaxLoggingLevel are lowered to it.  Returns the
+    // level that was set.
+    LogLevel set(LogCategory category, LogLevel level)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        level = std::min(level, bmcwebMaxLoggingLevel);
+        levels[static_cast<size_t>(category)].store(level,
+                                                    std::memory_order_relaxed);
+        update();
+        return level;
+    }
+
+    // Sets every category
+    LogLevel set(LogLevel level)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        level = std::min(level, bmcwebMaxLoggingLevel);
+        for (std::atomic<LogLevel>& categoryLevel : levels)
+        {
+            categoryLevel.store(level, std::memory_order_relaxed);
+        }
+        update();
+        return level;
+    }
+
+  private:
+    constexpr RuntimeLogLevels() = default;
+
+    // Must hold mutex
+    void update()
+    {
+        LogLevel highest = LogLevel::Disabled;
+        bool same = true;
+        for (const std::atomic<LogLevel>& categoryLevel : levels)
+        {
+            LogLevel level = categoryLevel.load(std::memory_order_relaxed);
+            same = same && level == levels[0].load(std::memory_order_relaxed);
+            highest = std::max(highest, level);
+        }
+        uniform.store(same, std::memory_order_relaxed);
+        maxLevel.store(highest, std::memory_order_relaxed);
+    }
+
+    static RuntimeLogLevels instance;
+
+    std::array<std::atomic<LogLevel>, mapLogCategoryFromName.size()> levels{
+        bmcwebCurrentLoggingLevel, bmcwebCurrentLoggingLevel,
+        bmcwebCurrentLoggingLevel, bmcwebCurrentLoggingLevel,
+        bmcwebCurrentLoggingLevel, bmcwebCurrentLoggingLevel,
+        bmcwebCurrentLoggingLevel, bmcwebCurrentLoggingLevel};
+    std::atomic<LogLevel> maxLevel = bmcwebCurrentLoggingLevel;
+    std::atomic<bool> uniform = true;
+    std::mutex mutex;
+};
+
+// Constant initialized, so that getting at it needs no guard
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+constinit inline RuntimeLogLevels RuntimeLogLevels::instance;
+
+inline RuntimeLogLevels& RuntimeLogLevels::getInstance()
+{
+    return instance;
+}
+
 template <typename T>
 const void* logPtr(T p)
 {
@@ -64,11 +235,22 @@ const void* logPtr(T p)
     return std::bit_cast<const void*>(p);
 }
 
-template <LogLevel level, typename... Args>
-inline void vlog(std::format_string<Args...>&& format, Args&&... args,
-                 const std::source_location& loc) noexcept
+// Called through the BMCWEB_LOG_* macros, which work out the category of the
+// call site at compile time
+template <LogLevel level, LogCategory category, typename... Args>
+inline void vlog(const std::source_location& loc,
+                 std::format_string<Args...> format, Args&&... args) noexcept
 {
-    if constexpr (bmcwebCurrentLoggingLevel < level)
+    if constexpr (bmcwebMaxLoggingLevel < level)
+    {
+        return;
+    }
+    RuntimeLogLevels& runtimeLevels = RuntimeLogLevels::getInstance();
+    if (runtimeLevels.getMax() < level)
+    {
+        return;
+    }
+    if (!runtimeLevels.isUniform() && runtimeLevels.get(category) < level)
     {
         return;
     }
@@ -78,6 +260,18 @@ inline void vlog(std::format_string<Args...>&& format, Args&&... args,
     constexpr std::string_view levelString = mapLogLevelFromName[stringIndex];
     std::string_view filename = loc.file_name();
     filename = filename.substr(filename.rfind('/') + 1);
+    if constexpr (BMCWEB_ASYNC_LOGGING)
+    {
+        // Formatted straight into the queue; a full queue drops the line
+        LogQueue::getInstance(BMCWEB_ASYNC_LOGGING_QUEUE_SIZE)
+            .push([&](LogMessage& message) {
+                message.format("[{} {}:{}] ", levelString, filename,
+                               loc.line());
+                message.format(std::move(format), std::forward<Args>(args)...);
+                message.append('\n');
+            });
+        return;
+    }
     std::string logLocation;
     try
     {
@@ -103,87 +297,59 @@ inline void vlog(std::format_string<Args...>&& format, Args&&... args,
 }
 } // namespace crow
 
-template <typename... Args>
-struct BMCWEB_LOG_CRITICAL
-{
-    // NOLINTNEXTLINE(google-explicit-constructor)
-    BMCWEB_LOG_CRITICAL(std::format_string<Args...> format, Args&&... args,
-                        const std::source_location& loc =
-                            std::source_location::current()) noexcept
-    {
-        crow::vlog<crow::LogLevel::Critical, Args...>(
-            std::move(format), std::forward<Args>(args)..., loc);
-    }
-};
+// Macros rather than functions, so that the file a line is logged from is
+// known at compile time, and its category with it
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define BMCWEB_LOG_CRITICAL(...)                                               \
+    crow::vlog<crow::LogLevel::Critical,                                       \
+               crow::getLogCategoryFromPath(                                   \
+                   std::source_location::current().file_name())>(              \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-struct BMCWEB_LOG_ERROR
-{
-    // NOLINTNEXTLINE(google-explicit-constructor)
-    BMCWEB_LOG_ERROR(std::format_string<Args...> format, Args&&... args,
-                     const std::source_location& loc =
-                         std::source_location::current()) noexcept
-    {
-        crow::vlog<crow::LogLevel::Error, Args...>(
-            std::move(format), std::forward<Args>(args)..., loc);
-    }
-};
+#define BMCWEB_LOG_ERROR(...)                                                  \
+    crow::vlog<crow::LogLevel::Error,                                          \
+               crow::getLogCategoryFromPath(                                   \
+                   std::source_location::current().file_name())>(              \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-struct BMCWEB_LOG_WARNING
-{
-    // NOLINTNEXTLINE(google-explicit-constructor)
-    BMCWEB_LOG_WARNING(std::format_string<Args...> format, Args&&... args,
-                       const std::source_location& loc =
-                           std::source_location::current()) noexcept
-    {
-        crow::vlog<crow::LogLevel::Warning, Args...>(
-            std::move(format), std::forward<Args>(args)..., loc);
-    }
-};
+#define BMCWEB_LOG_WARNING(...)                                                \
+    crow::vlog<crow::LogLevel::Warning,                                        \
+               crow::getLogCategoryFromPath(                                   \
+                   std::source_location::current().file_name())>(              \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-struct BMCWEB_LOG_INFO
-{
-    // NOLINTNEXTLINE(google-explicit-constructor)
-    BMCWEB_LOG_INFO(std::format_string<Args...> format, Args&&... args,
-                    const std::source_location& loc =
-                        std::source_location::current()) noexcept
-    {
-        crow::vlog<crow::LogLevel::Info, Args...>(
-            std::move(format), std::forward<Args>(args)..., loc);
-    }
-};
+#define BMCWEB_LOG_INFO(...)                                                   \
+    crow::vlog<crow::LogLevel::Info,                                           \
+               crow::getLogCategoryFromPath(                                   \
+                   std::source_location::current().file_name())>(              \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-struct BMCWEB_LOG_DEBUG
-{
-    // NOLINTNEXTLINE(google-explicit-constructor)
-    BMCWEB_LOG_DEBUG(std::format_string<Args...> format, Args&&... args,
-                     const std::source_location& loc =
-                         std::source_location::current()) noexcept
-    {
-        crow::vlog<crow::LogLevel::Debug, Args...>(
-            std::move(format), std::forward<Args>(args)..., loc);
-    }
-};
+#define BMCWEB_LOG_DEBUG(...)                                                  \
+    crow::vlog<crow::LogLevel::Debug,                                          \
+               crow::getLogCategoryFromPath(                                   \
+                   std::source_location::current().file_name())>(              \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-BMCWEB_LOG_CRITICAL(std::format_string<Args...>, Args&&...)
-    -> BMCWEB_LOG_CRITICAL<Args...>;
+// For lines that belong to another category than the rest of their file, such
+// as a D-Bus error reported by a Redfish handler:
+// BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
+#define BMCWEB_LOG_CRITICAL_CAT(category, ...)                                 \
+    crow::vlog<crow::LogLevel::Critical, crow::LogCategory::category>(         \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-BMCWEB_LOG_ERROR(std::format_string<Args...>, Args&&...)
-    -> BMCWEB_LOG_ERROR<Args...>;
+#define BMCWEB_LOG_ERROR_CAT(category, ...)                                    \
+    crow::vlog<crow::LogLevel::Error, crow::LogCategory::category>(            \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-BMCWEB_LOG_WARNING(std::format_string<Args...>, Args&&...)
-    -> BMCWEB_LOG_WARNING<Args...>;
+#define BMCWEB_LOG_WARNING_CAT(category, ...)                                  \
+    crow::vlog<crow::LogLevel::Warning, crow::LogCategory::category>(          \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-BMCWEB_LOG_INFO(std::format_string<Args...>, Args&&...)
-    -> BMCWEB_LOG_INFO<Args...>;
+#define BMCWEB_LOG_INFO_CAT(category, ...)                                     \
+    crow::vlog<crow::LogLevel::Info, crow::LogCategory::category>(             \
+        std::source_location::current(), __VA_ARGS__)
 
-template <typename... Args>
-BMCWEB_LOG_DEBUG(std::format_string<Args...>, Args&&...)
-    -> BMCWEB_LOG_DEBUG<Args...>;
+#define BMCWEB_LOG_DEBUG_CAT(category, ...)                                    \
+    crow::vlog<crow::LogLevel::Debug, crow::LogCategory::category>(            \
+        std::source_location::current(), __VA_ARGS__)
+// NOLINTEND(cppcoreguidelines-macro-usage)
@@ -15,25 +15,67 @@ extern "C"
 
 #include <memory>
 #include <span>
+#include <string>
+#include <string_view>
 
-inline std::shared_ptr<persistent_data::UserSession>
-    verifyMtlsUser(const boost::asio::ip::address& clientIp,
-                   boost::asio::ssl::verify_context& ctx)
+// Returns the user name from the CommonName of a verified client
+// certificate, or an empty string if it can't be used for authentication
+inline std::string getMtlsUsernameFromCert(X509* peerCert)
 {
-    // do nothing if TLS is disabled
-    if (!persistent_data::SessionStore::getInstance()
-             .getAuthMethodsConfig()
-             .tls)
+    if (X509_check_purpose(peerCert, X509_PURPOSE_SSL_CLIENT, 0) != 1)
     {
-        BMCWEB_LOG_DEBUG("TLS auth_config is disabled");
-        return nullptr;
+        BMCWEB_LOG_DEBUG(
+            "Chain does not allow certificate to be used for SSL client authentication");
+        return "";
+    }
+
+    std::string sslUser;
+    // Extract username contained in CommonName
+    sslUser.resize(256, '\0');
+
+    int status = X509_NAME_get_text_by_NID(X509_get_subject_name(peerCert),
+                                           NID_commonName, sslUser.data(),
+                                           static_cast<int>(sslUser.size()));
+
+    if (status == -1)
+    {
+        BMCWEB_LOG_DEBUG("TLS cannot get username to create session");
+        return "";
+    }
+
+    size_t lastChar = sslUser.find('\0');
+    if (lastChar == std::string::npos || lastChar == 0)
+    {
+        BMCWEB_LOG_DEBUG("Invalid TLS user name");
+        return "";
     }
+    sslUser.resize(lastChar);
 
+    // Meta Inc. CommonName parsing
+    if constexpr (BMCWEB_MUTUAL_TLS_COMMON_NAME_PARSING == "meta")
+    {
+        std::optional<std::string_view> sslUserMeta =
+            mtlsMetaParseSslUser(sslUser);
+        if (!sslUserMeta)
+        {
+            return "";
+        }
+        sslUser = *sslUserMeta;
+    }
+
+    return sslUser;
+}
+
+// Returns the user name from a verified client certificate, or an empty
+// string if the certificate can't be used for authentication.  Doesn't touch
+// the session store, so it's safe to call from any thread.
+inline std::string getMtlsUsername(boost::asio::ssl::verify_context& ctx)
+{
     X509_STORE_CTX* cts = ctx.native_handle();
     if (cts == nullptr)
     {
         BMCWEB_LOG_DEBUG("Cannot get native TLS handle.");
-        return nullptr;
+        return "";
     }
 
     // Get certificate
@@ -41,7 +83,7 @@ inline std::shared_ptr<persistent_data::UserSession>
     if (peerCert == nullptr)
     {
         BMCWEB_LOG_DEBUG("Cannot get current TLS certificate.");
-        return nullptr;
+        return "";
     }
 
     // Check if certificate is OK
@@ -49,7 +91,7 @@ inline std::shared_ptr<persistent_data::UserSession>
     if (ctxError != X509_V_OK)
     {
         BMCWEB_LOG_INFO("Last TLS error is: {}", ctxError);
-        return nullptr;
+        return "";
     }
 
     // Check that we have reached final certificate in chain
@@ -59,54 +101,69 @@ inline std::shared_ptr<persistent_data::UserSession>
         BMCWEB_LOG_DEBUG(
             "Certificate verification in progress (depth {}), waiting to reach final depth",
             depth);
-        return nullptr;
+        return "";
     }
 
     BMCWEB_LOG_DEBUG("Certificate verification of final depth");
 
-    if (X509_check_purpose(peerCert, X509_PURPOSE_SSL_CLIENT, 0) != 1)
-    {
-        BMCWEB_LOG_DEBUG(
-            "Chain does not allow certificate to be used for SSL client authentication");
-        return nullptr;
-    }
-
-    std::string sslUser;
-    // Extract username contained in CommonName
-    sslUser.resize(256, '\0');
-
-    int status = X509_NAME_get_text_by_NID(X509_get_subject_name(peerCert),
-                                           NID_commonName, sslUser.data(),
-                                           static_cast<int>(sslUser.size()));
+    return getMtlsUsernameFromCert(peerCert);
+}
 
-    if (status == -1)
+// Returns the user name for a TLS session that was resumed, and so skipped
+// certificate verification, from the certificate that the client verified
+// with when the session was first made.
+inline std::string getResumedMtlsUsername(SSL* ssl)
+{
+    if (SSL_get_verify_result(ssl) != X509_V_OK)
     {
-        BMCWEB_LOG_DEBUG("TLS cannot get username to create session");
-        return nullptr;
+        return "";
     }
-
-    size_t lastChar = sslUser.find('\0');
-    if (lastChar == std::string::npos || lastChar == 0)
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+    X509* peerCert = SSL_get0_peer_certificate(ssl);
+    if (peerCert == nullptr)
     {
-        BMCWEB_LOG_DEBUG("Invalid TLS user name");
-        return nullptr;
+        return "";
     }
-    sslUser.resize(lastChar);
-
-    // Meta Inc. CommonName parsing
-    if constexpr (BMCWEB_MUTUAL_TLS_COMMON_NAME_PARSING == "meta")
+    return getMtlsUsernameFromCert(peerCert);
+#else
+    X509* peerCert = SSL_get_peer_certificate(ssl);
+    if (peerCert == nullptr)
     {
-        std::optional<std::string_view> sslUserMeta =
-            mtlsMetaParseSslUser(sslUser);
-        if (!sslUserMeta)
-        {
-            return nullptr;
-        }
-        sslUser = *sslUserMeta;
+        return "";
     }
+    std::string sslUser = getMtlsUsernameFromCert(peerCert);
+    X509_free(peerCert);
+    return sslUser;
+#endif
+}
 
+inline std::shared_ptr<persistent_data::UserSession>
+    createMtlsUserSession(const boost::asio::ip::address& clientIp,
+                          std::string_view sslUser)
+{
     std::string unsupportedClientId;
     return persistent_data::SessionStore::getInstance().generateUserSession(
         sslUser, clientIp, unsupportedClientId,
         persistent_data::PersistenceType::TIMEOUT);
 }
+
+inline std::shared_ptr<persistent_data::UserSession>
+    verifyMtlsUser(const boost::asio::ip::address& clientIp,
+                   boost::asio::ssl::verify_context& ctx)
+{
+    // do nothing if TLS is disabled
+    if (!persistent_data::SessionStore::getInstance()
+             .getAuthMethodsConfig()
+             .tls)
+    {
+        BMCWEB_LOG_DEBUG("TLS auth_config is disabled");
+        return nullptr;
+    }
+
+    std::string sslUser = getMtlsUsername(ctx);
+    if (sslUser.empty())
+    {
+        return nullptr;
+    }
+    return createMtlsUserSession(clientIp, sslUser);
+}
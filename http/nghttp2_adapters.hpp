@@ -151,9 +151,21 @@ struct nghttp2_session
     {
         const uint8_t* bytes = nullptr;
         ssize_t size = nghttp2_session_mem_send(ptr, &bytes);
+        if (size < 0)
+        {
+            BMCWEB_LOG_ERROR("nghttp2_session_mem_send failed: {}",
+                             nghttp2_strerror(static_cast<int>(size)));
+            return {};
+        }
         return {bytes, static_cast<size_t>(size)};
     }
 
+    int setLocalWindowSize(int32_t streamId, int32_t windowSize)
+    {
+        return nghttp2_session_set_local_window_size(ptr, NGHTTP2_FLAG_NONE,
+                                                     streamId, windowSize);
+    }
+
     int submitResponse(int32_t streamId, std::span<const nghttp2_nv> headers,
                        const nghttp2_data_provider* dataPrd)
     {
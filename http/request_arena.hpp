@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bmcweb
+{
+
+// Memory for the objects that only live as long as one request.  Allocations
+// are carved out of a buffer that is reused from one request to the next, and
+// are all released at once when nothing from the request is still alive.
+class RequestArena
+{
+  public:
+    // Enough for the Request and AsyncResp objects, and the response headers,
+    // of a typical request
+    static constexpr size_t bufferSize = 4096;
+
+    // Arenas that connections have finished with are kept for the next one,
+    // up to this many per thread
+    static constexpr size_t maxFreeArenas = 16;
+
+    RequestArena() = default;
+    ~RequestArena() = default;
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+    RequestArena(RequestArena&&) = delete;
+    RequestArena& operator=(RequestArena&&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment)
+    {
+        liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        return resource.allocate(bytes, alignment);
+    }
+
+    // Memory is only reclaimed by reset(); this just tracks that the
+    // allocation is no longer in use.  Can be called from any thread.
+    void deallocate()
+    {
+        liveAllocations.fetch_sub(1, std::memory_order_release);
+    }
+
+    // Releases every allocation so the buffer can be reused.  Returns false,
+    // and leaves the arena alone, if anything from the previous request is
+    // still alive.
+    bool reset()
+    {
+        if (liveAllocations.load(std::memory_order_acquire) != 0)
+        {
+            return false;
+        }
+        resource.release();
+        return true;
+    }
+
+    // Returns an empty arena, reusing one from this thread's pool if any of
+    // them is free.  An arena that anything else still refers to is skipped,
+    // even if it holds no allocations, as a container with a copy of its
+    // allocator could allocate from it again, possibly on another thread.
+    static std::shared_ptr<RequestArena> acquire()
+    {
+        std::vector<std::shared_ptr<RequestArena>>& pool = freeArenas();
+        for (std::shared_ptr<RequestArena>& arena : pool)
+        {
+            if (arena.use_count() == 1 && arena->reset())
+            {
+                std::swap(arena, pool.back());
+                std::shared_ptr<RequestArena> ret = std::move(pool.back());
+                pool.pop_back();
+                return ret;
+            }
+        }
+        return std::make_shared<RequestArena>();
+    }
+
+    // Gives an arena back to this thread's pool.  It doesn't need to be free
+    // yet; acquire() only hands it out again once it is.
+    static void release(std::shared_ptr<RequestArena>&& arena)
+    {
+        if (arena == nullptr)
+        {
+            return;
+        }
+        std::vector<std::shared_ptr<RequestArena>>& pool = freeArenas();
+        if (pool.size() < maxFreeArenas)
+        {
+            pool.emplace_back(std::move(arena));
+        }
+        arena = nullptr;
+    }
+
+    static size_t getFreeArenas()
+    {
+        return freeArenas().size();
+    }
+
+  private:
+    static std::vector<std::shared_ptr<RequestArena>>& freeArenas()
+    {
+        static thread_local std::vector<std::shared_ptr<RequestArena>> pool;
+        return pool;
+    }
+
+    alignas(std::max_align_t) std::array<std::byte, bufferSize> buffer{};
+    std::pmr::monotonic_buffer_resource resource{
+        buffer.data(), buffer.size(), std::pmr::new_delete_resource()};
+    std::atomic<size_t> liveAllocations = 0;
+};
+
+// Allocator for std::allocate_shared, and for containers that live no longer
+// than a request, such as the response headers.  Every copy keeps the arena
+// alive, so it stays around until everything allocated from it is gone, even
+// if the connection that owns it is not.  One made without an arena uses the
+// heap.
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    using value_type = T;
+    // A container that is moved or swapped takes its allocator along, so its
+    // elements are always given back to the arena they came from
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() = default;
+
+    explicit ArenaAllocator(std::shared_ptr<RequestArena> arenaIn) :
+        arena(std::move(arenaIn))
+    {}
+
+    // Implicit, as containers convert between element types by copy
+    // initialization, as they can with std::allocator
+    template <typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    ArenaAllocator(const ArenaAllocator<U>& other) :
+        arena(other.arena)
+    {}
+
+    ~ArenaAllocator() = default;
+    ArenaAllocator(const ArenaAllocator&) = default;
+    ArenaAllocator& operator=(const ArenaAllocator&) = default;
+
+    // Moving copies, so a moved-from container can still free anything it
+    // holds
+    // NOLINTNEXTLINE(performance-move-constructor-init)
+    ArenaAllocator(ArenaAllocator&& other) noexcept : arena(other.arena) {}
+    ArenaAllocator& operator=(ArenaAllocator&& other) noexcept
+    {
+        arena = other.arena;
+        return *this;
+    }
+
+    T* allocate(size_t count)
+    {
+        if (arena == nullptr)
+        {
+            return std::allocator<T>().allocate(count);
+        }
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t count)
+    {
+        if (arena == nullptr)
+        {
+            std::allocator<T>().deallocate(ptr, count);
+            return;
+        }
+        arena->deallocate();
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return arena == other.arena;
+    }
+
+  private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    std::shared_ptr<RequestArena> arena;
+};
+
+} // namespace bmcweb
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "async_resp.hpp"
+#include "dbus_call_trace.hpp"
 #include "dbus_privileges.hpp"
 #include "dbus_utility.hpp"
 #include "error_messages.hpp"
@@ -23,6 +24,8 @@
 #include <boost/container/small_vector.hpp>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cerrno>
 #include <cstdint>
 #include <cstdlib>
@@ -30,19 +33,36 @@
 #include <memory>
 #include <optional>
 #include <string_view>
-#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace crow
 {
 
+// Every route table lives in the same trie.  Each HttpVerb has its own
+// table, followed by the tables for special purpose routes.
+static constexpr size_t notFoundTable = static_cast<size_t>(HttpVerb::Max);
+static constexpr size_t methodNotAllowedTable = notFoundTable + 1U;
+static constexpr size_t upgradeTable = notFoundTable + 2U;
+static constexpr size_t routeTableCount = upgradeTable + 1U;
+
 class Trie
 {
   public:
+    using TableBits = uint16_t;
+    static_assert(routeTableCount <= std::numeric_limits<TableBits>::digits);
+
+    static constexpr TableBits tableBit(size_t table)
+    {
+        return static_cast<TableBits>(1U << table);
+    }
+
     struct Node
     {
-        unsigned ruleIndex = 0U;
+        // Index of the rule for each table at this node, 0 if there is none
+        std::array<unsigned, routeTableCount> ruleIndexes{};
+        // Tables with a rule at this node or below it
+        TableBits subtreeTables = 0U;
 
         size_t stringParamChild = 0U;
         size_t pathParamChild = 0U;
@@ -53,28 +73,86 @@ class Trie
                                            1>>;
         ChildMap children;
 
+        bool hasRule() const
+        {
+            return std::ranges::any_of(
+                ruleIndexes, [](unsigned index) { return index != 0U; });
+        }
+
         bool isSimpleNode() const
         {
-            return ruleIndex == 0 && stringParamChild == 0 &&
-                   pathParamChild == 0;
+            return !hasRule() && stringParamChild == 0 && pathParamChild == 0;
         }
     };
 
     Trie() : nodes(1) {}
 
   private:
-    void optimizeNode(Node& node)
+    // Merging simple nodes can produce the same fragment twice when rules are
+    // added after a previous optimize(), so combine the two subtrees rather
+    // than dropping one of them.
+    void addChild(Node::ChildMap& children, const std::string& fragment,
+                  unsigned nodeIndex)
     {
-        if (node.stringParamChild != 0U)
+        auto [it, inserted] = children.try_emplace(fragment, nodeIndex);
+        if (!inserted && it->second != nodeIndex)
+        {
+            mergeNodes(it->second, nodeIndex);
+        }
+    }
+
+    void mergeNodes(size_t dstIndex, size_t srcIndex)
+    {
+        Node& dst = nodes[dstIndex];
+        const Node& src = nodes[srcIndex];
+        for (size_t table = 0; table < routeTableCount; table++)
+        {
+            if (dst.ruleIndexes[table] == 0U)
+            {
+                dst.ruleIndexes[table] = src.ruleIndexes[table];
+            }
+        }
+        dst.subtreeTables |= src.subtreeTables;
+        if (src.stringParamChild != 0U)
+        {
+            if (dst.stringParamChild == 0U)
+            {
+                dst.stringParamChild = src.stringParamChild;
+            }
+            else
+            {
+                mergeNodes(dst.stringParamChild, src.stringParamChild);
+            }
+        }
+        if (src.pathParamChild != 0U)
         {
-            optimizeNode(nodes[node.stringParamChild]);
+            if (dst.pathParamChild == 0U)
+            {
+                dst.pathParamChild = src.pathParamChild;
+            }
+            else
+            {
+                mergeNodes(dst.pathParamChild, src.pathParamChild);
+            }
         }
-        if (node.pathParamChild != 0U)
+        for (const Node::ChildMap::value_type& kv : src.children)
         {
-            optimizeNode(nodes[node.pathParamChild]);
+            addChild(dst.children, kv.first, kv.second);
         }
+    }
 
-        if (node.children.empty())
+    void optimizeNode(size_t nodeIndex)
+    {
+        if (nodes[nodeIndex].stringParamChild != 0U)
+        {
+            optimizeNode(nodes[nodeIndex].stringParamChild);
+        }
+        if (nodes[nodeIndex].pathParamChild != 0U)
+        {
+            optimizeNode(nodes[nodeIndex].pathParamChild);
+        }
+
+        if (nodes[nodeIndex].children.empty())
         {
             return;
         }
@@ -82,7 +160,8 @@ class Trie
         {
             bool didMerge = false;
             Node::ChildMap merged;
-            for (const Node::ChildMap::value_type& kv : node.children)
+            for (const Node::ChildMap::value_type& kv :
+                 nodes[nodeIndex].children)
             {
                 Node& child = nodes[kv.second];
                 if (child.isSimpleNode())
@@ -90,31 +169,32 @@ class Trie
                     for (const Node::ChildMap::value_type& childKv :
                          child.children)
                     {
-                        merged[kv.first + childKv.first] = childKv.second;
+                        addChild(merged, kv.first + childKv.first,
+                                 childKv.second);
                         didMerge = true;
                     }
                 }
                 else
                 {
-                    merged[kv.first] = kv.second;
+                    addChild(merged, kv.first, kv.second);
                 }
             }
-            node.children = std::move(merged);
+            nodes[nodeIndex].children = std::move(merged);
             if (!didMerge)
             {
                 break;
             }
         }
 
-        for (const Node::ChildMap::value_type& kv : node.children)
+        for (const Node::ChildMap::value_type& kv : nodes[nodeIndex].children)
         {
-            optimizeNode(nodes[kv.second]);
+            optimizeNode(kv.second);
         }
     }
 
     void optimize()
     {
-        optimizeNode(head());
+        optimizeNode(0U);
     }
 
   public:
@@ -133,9 +213,15 @@ class Trie
             const Node& child = nodes[kv.second];
             if (reqUrl.empty())
             {
-                if (child.ruleIndex != 0 && fragment != "/")
+                if (fragment != "/")
                 {
-                    routeIndexes.push_back(child.ruleIndex);
+                    for (size_t verb = 0; verb <= maxVerbIndex; verb++)
+                    {
+                        if (child.ruleIndexes[verb] != 0U)
+                        {
+                            routeIndexes.push_back(child.ruleIndexes[verb]);
+                        }
+                    }
                 }
                 findRouteIndexesHelper(reqUrl, routeIndexes, child);
             }
@@ -158,52 +244,97 @@ class Trie
 
     struct FindResult
     {
-        unsigned ruleIndex;
-        std::vector<std::string> params;
+        // First matching rule in each table, 0 if none matched
+        std::array<unsigned, routeTableCount> ruleIndexes{};
+        // Parameters of each match, only filled in for the requested tables
+        std::array<RouteParams, routeTableCount> params;
+    };
+
+    struct FindState
+    {
+        TableBits paramTables = 0U;
+        TableBits found = 0U;
+        RouteParams params;
+        FindResult result;
     };
 
+    static bool canMatch(TableBits subtreeTables, const FindState& state)
+    {
+        return (subtreeTables & ~state.found) != 0U;
+    }
+
+    // Records the rules at a node that the url ended on, for every table that
+    // hasn't matched yet
+    static void
+        recordMatches(const std::array<unsigned, routeTableCount>& ruleIndexes,
+                      FindState& state)
+    {
+        for (size_t table = 0; table < routeTableCount; table++)
+        {
+            TableBits bit = tableBit(table);
+            if (ruleIndexes[table] == 0U || (state.found & bit) != 0U)
+            {
+                continue;
+            }
+            state.found |= bit;
+            state.result.ruleIndexes[table] = ruleIndexes[table];
+            if ((state.paramTables & bit) != 0U)
+            {
+                state.result.params[table] = state.params;
+            }
+        }
+    }
+
   private:
-    FindResult findHelper(const std::string_view reqUrl, const Node& node,
-                          std::vector<std::string>& params) const
+    static bool canMatch(const Node& node, const FindState& state)
+    {
+        return canMatch(node.subtreeTables, state);
+    }
+
+    // Searches in the same order for every table: string parameters, then
+    // path parameters, then literal fragments.  Each table takes the first
+    // rule it finds, so the result matches what a separate trie per table
+    // would give, from one descent.  Returns true once every table in the
+    // trie has matched.
+    bool findHelper(std::string_view reqUrl, const Node& node,
+                    FindState& state) const
     {
         if (reqUrl.empty())
         {
-            return {node.ruleIndex, params};
+            recordMatches(node.ruleIndexes, state);
+            return !canMatch(head(), state);
         }
 
-        if (node.stringParamChild != 0U)
+        if (node.stringParamChild != 0U &&
+            canMatch(nodes[node.stringParamChild], state))
         {
-            size_t epos = 0;
-            for (; epos < reqUrl.size(); epos++)
+            size_t epos = reqUrl.find('/');
+            if (epos == std::string_view::npos)
             {
-                if (reqUrl[epos] == '/')
-                {
-                    break;
-                }
+                epos = reqUrl.size();
             }
 
             if (epos != 0)
             {
-                params.emplace_back(reqUrl.substr(0, epos));
-                FindResult ret = findHelper(
-                    reqUrl.substr(epos), nodes[node.stringParamChild], params);
-                if (ret.ruleIndex != 0U)
+                state.params.emplace_back(reqUrl.substr(0, epos));
+                if (findHelper(reqUrl.substr(epos),
+                               nodes[node.stringParamChild], state))
                 {
-                    return {ret.ruleIndex, std::move(ret.params)};
+                    return true;
                 }
-                params.pop_back();
+                state.params.pop_back();
             }
         }
 
-        if (node.pathParamChild != 0U)
+        if (node.pathParamChild != 0U &&
+            canMatch(nodes[node.pathParamChild], state))
         {
-            params.emplace_back(reqUrl);
-            FindResult ret = findHelper("", nodes[node.pathParamChild], params);
-            if (ret.ruleIndex != 0U)
+            state.params.emplace_back(reqUrl);
+            if (findHelper("", nodes[node.pathParamChild], state))
             {
-                return {ret.ruleIndex, std::move(ret.params)};
+                return true;
             }
-            params.pop_back();
+            state.params.pop_back();
         }
 
         for (const Node::ChildMap::value_type& kv : node.children)
@@ -211,28 +342,31 @@ class Trie
             const std::string& fragment = kv.first;
             const Node& child = nodes[kv.second];
 
-            if (reqUrl.starts_with(fragment))
+            if (reqUrl.starts_with(fragment) && canMatch(child, state))
             {
-                FindResult ret = findHelper(reqUrl.substr(fragment.size()),
-                                            child, params);
-                if (ret.ruleIndex != 0U)
+                if (findHelper(reqUrl.substr(fragment.size()), child, state))
                 {
-                    return {ret.ruleIndex, std::move(ret.params)};
+                    return true;
                 }
             }
         }
 
-        return {0U, std::vector<std::string>()};
+        return false;
     }
 
   public:
-    FindResult find(const std::string_view reqUrl) const
+    // paramTables selects which tables' matches should have their parameters
+    // captured; the rest only report the rule index.  Parameters are views
+    // into reqUrl.
+    FindResult find(std::string_view reqUrl, TableBits paramTables) const
     {
-        std::vector<std::string> start;
-        return findHelper(reqUrl, head(), start);
+        FindState state;
+        state.paramTables = paramTables;
+        findHelper(reqUrl, head(), state);
+        return std::move(state.result);
     }
 
-    void add(std::string_view urlIn, unsigned ruleIndex)
+    void add(std::string_view urlIn, size_t table, unsigned ruleIndex)
     {
         size_t idx = 0;
 
@@ -240,6 +374,7 @@ class Trie
 
         while (!url.empty())
         {
+            nodes[idx].subtreeTables |= tableBit(table);
             char c = url[0];
             if (c == '<')
             {
@@ -252,17 +387,24 @@ class Trie
                         continue;
                     }
                     found = true;
-                    Node& node = nodes[idx];
-                    size_t* param = &node.stringParamChild;
-                    if (str1 == "<path>")
-                    {
-                        param = &node.pathParamChild;
-                    }
-                    if (*param == 0U)
+                    bool isPath = str1 == "<path>";
+                    size_t child = isPath ? nodes[idx].pathParamChild
+                                          : nodes[idx].stringParamChild;
+                    if (child == 0U)
                     {
-                        *param = newNode();
+                        // newNode() can reallocate nodes, so look the parent
+                        // up again afterwards
+                        child = newNode();
+                        if (isPath)
+                        {
+                            nodes[idx].pathParamChild = child;
+                        }
+                        else
+                        {
+                            nodes[idx].stringParamChild = child;
+                        }
                     }
-                    idx = *param;
+                    idx = child;
 
                     url.remove_prefix(str1.size());
                     break;
@@ -285,13 +427,14 @@ class Trie
             url.remove_prefix(1);
         }
         Node& node = nodes[idx];
-        if (node.ruleIndex != 0U)
+        node.subtreeTables |= tableBit(table);
+        if (node.ruleIndexes[table] != 0U)
         {
             BMCWEB_LOG_CRITICAL("handler already exists for \"{}\"", urlIn);
             throw std::runtime_error(
                 std::format("handler already exists for \"{}\"", urlIn));
         }
-        node.ruleIndex = ruleIndex;
+        node.ruleIndexes[table] = ruleIndex;
     }
 
   private:
@@ -341,6 +484,310 @@ class Trie
     std::vector<Node> nodes;
 };
 
+// Read-only form of Trie keyed by whole path segments rather than by
+// characters.  Each node finds its literal children through a perfect hash,
+// so a lookup does one hash and one compare per segment, and only <str> and
+// <path> parameters can cause any backtracking.  Lookups follow the same
+// order as Trie::find, and give the same results.
+//
+// Rules are added while the router is being set up, then compile() lays the
+// literal children out in flat arrays.  Parameters have to span a complete
+// segment; add() returns false for any other route, and the router falls
+// back to Trie.
+class RouteTable
+{
+  public:
+    using TableBits = Trie::TableBits;
+
+    RouteTable() : nodes(1), literals(1) {}
+
+    static constexpr uint32_t hashSegment(std::string_view segment,
+                                          uint32_t seed)
+    {
+        // FNV-1a, with the seed mixed into the offset basis
+        uint32_t hash = 2166136261U ^ (seed * 0x9E3779B9U);
+        for (char c : segment)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619U;
+        }
+        return hash ^ (hash >> 16U);
+    }
+
+    bool add(std::string_view urlIn, size_t table, unsigned ruleIndex)
+    {
+        if (!utility::isSegmentRoute(urlIn))
+        {
+            return false;
+        }
+        compiled = false;
+        size_t idx = 0;
+        std::string_view url = urlIn;
+        while (!url.empty())
+        {
+            nodes[idx].subtreeTables |= Trie::tableBit(table);
+            url.remove_prefix(1);
+            size_t end = url.find('/');
+            if (end == std::string_view::npos)
+            {
+                end = url.size();
+            }
+            std::string_view segment = url.substr(0, end);
+            url.remove_prefix(end);
+
+            if (segment == "<str>" || segment == "<string>")
+            {
+                if (nodes[idx].stringParamChild == 0U)
+                {
+                    // newNode() can reallocate nodes, so look the parent up
+                    // again afterwards
+                    unsigned child = newNode();
+                    nodes[idx].stringParamChild = child;
+                }
+                idx = nodes[idx].stringParamChild;
+                continue;
+            }
+            if (segment == "<path>")
+            {
+                if (nodes[idx].pathParamChild == 0U)
+                {
+                    unsigned child = newNode();
+                    nodes[idx].pathParamChild = child;
+                }
+                idx = nodes[idx].pathParamChild;
+                continue;
+            }
+            LiteralMap::iterator it = literals[idx].find(segment);
+            if (it == literals[idx].end())
+            {
+                unsigned child = newNode();
+                it = literals[idx].emplace(std::string(segment), child).first;
+            }
+            idx = it->second;
+        }
+        Node& node = nodes[idx];
+        node.subtreeTables |= Trie::tableBit(table);
+        if (node.ruleIndexes[table] != 0U)
+        {
+            BMCWEB_LOG_CRITICAL("handler already exists for \"{}\"", urlIn);
+            throw std::runtime_error(
+                std::format("handler already exists for \"{}\"", urlIn));
+        }
+        node.ruleIndexes[table] = ruleIndex;
+        return true;
+    }
+
+    // Builds the perfect hash for the literal children of every node.
+    // Returns false if no hash could be found, which in practice would take
+    // two segments with colliding hashes under every seed.
+    bool compile()
+    {
+        slots.clear();
+        segments.clear();
+        for (size_t idx = 0; idx < nodes.size(); idx++)
+        {
+            if (!compileNode(nodes[idx], literals[idx]))
+            {
+                BMCWEB_LOG_CRITICAL("Failed to build route hash");
+                return false;
+            }
+        }
+        compiled = true;
+        return true;
+    }
+
+    bool isCompiled() const
+    {
+        return compiled;
+    }
+
+    Trie::FindResult find(std::string_view reqUrl, TableBits paramTables) const
+    {
+        Trie::FindState state;
+        state.paramTables = paramTables;
+        if (compiled)
+        {
+            findHelper(reqUrl, nodes.front(), state);
+        }
+        return std::move(state.result);
+    }
+
+  private:
+    using LiteralMap = boost::container::flat_map<std::string, unsigned,
+                                                  std::less<>>;
+
+    struct Node
+    {
+        std::array<unsigned, routeTableCount> ruleIndexes{};
+        TableBits subtreeTables = 0U;
+        unsigned stringParamChild = 0U;
+        unsigned pathParamChild = 0U;
+
+        // Literal children live in slots[slotBegin, slotBegin + slotCount),
+        // at hashSegment(segment, seed) & (slotCount - 1)
+        uint32_t seed = 0U;
+        uint32_t slotBegin = 0U;
+        uint32_t slotCount = 0U;
+    };
+
+    struct Slot
+    {
+        uint32_t segmentBegin = 0U;
+        uint32_t segmentSize = 0U;
+        // The root is never a child, so 0 marks an empty slot
+        unsigned child = 0U;
+    };
+
+    // Past this many slots per node, give up looking for a hash
+    static constexpr size_t maxSlots = 1UL << 16U;
+    static constexpr uint32_t seedAttempts = 64U;
+
+    static bool isPerfect(const LiteralMap& children, uint32_t seed,
+                          uint32_t mask, std::vector<bool>& used)
+    {
+        used.assign(static_cast<size_t>(mask) + 1U, false);
+        for (const LiteralMap::value_type& kv : children)
+        {
+            size_t slot = hashSegment(kv.first, seed) & mask;
+            if (used[slot])
+            {
+                return false;
+            }
+            used[slot] = true;
+        }
+        return true;
+    }
+
+    bool compileNode(Node& node, const LiteralMap& children)
+    {
+        node.slotBegin = static_cast<uint32_t>(slots.size());
+        node.seed = 0U;
+        node.slotCount = 0U;
+        if (children.empty())
+        {
+            return true;
+        }
+        std::vector<bool> used;
+        for (size_t size = std::bit_ceil(children.size()); size <= maxSlots;
+             size *= 2U)
+        {
+            uint32_t mask = static_cast<uint32_t>(size - 1U);
+            for (uint32_t seed = 0U; seed < seedAttempts; seed++)
+            {
+                if (!isPerfect(children, seed, mask, used))
+                {
+                    continue;
+                }
+                node.seed = seed;
+                node.slotCount = static_cast<uint32_t>(size);
+                slots.resize(slots.size() + size);
+                for (const LiteralMap::value_type& kv : children)
+                {
+                    Slot& slot = slots[node.slotBegin +
+                                       (hashSegment(kv.first, seed) & mask)];
+                    slot.segmentBegin = static_cast<uint32_t>(segments.size());
+                    slot.segmentSize = static_cast<uint32_t>(kv.first.size());
+                    slot.child = kv.second;
+                    segments += kv.first;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Node* findLiteral(const Node& node, std::string_view segment) const
+    {
+        if (node.slotCount == 0U)
+        {
+            return nullptr;
+        }
+        uint32_t slotIndex = hashSegment(segment, node.seed) &
+                             (node.slotCount - 1U);
+        const Slot& slot = slots[node.slotBegin + slotIndex];
+        if (slot.child == 0U ||
+            std::string_view(segments).substr(slot.segmentBegin,
+                                              slot.segmentSize) != segment)
+        {
+            return nullptr;
+        }
+        return &nodes[slot.child];
+    }
+
+    // Same search order as Trie::findHelper: string parameters, then path
+    // parameters, then the literal segment.
+    bool findHelper(std::string_view reqUrl, const Node& node,
+                    Trie::FindState& state) const
+    {
+        if (reqUrl.empty())
+        {
+            Trie::recordMatches(node.ruleIndexes, state);
+            return !Trie::canMatch(nodes.front().subtreeTables, state);
+        }
+        if (!reqUrl.starts_with('/'))
+        {
+            return false;
+        }
+        reqUrl.remove_prefix(1);
+        size_t end = reqUrl.find('/');
+        if (end == std::string_view::npos)
+        {
+            end = reqUrl.size();
+        }
+        std::string_view segment = reqUrl.substr(0, end);
+
+        if (node.stringParamChild != 0U && !segment.empty())
+        {
+            const Node& child = nodes[node.stringParamChild];
+            if (Trie::canMatch(child.subtreeTables, state))
+            {
+                state.params.emplace_back(segment);
+                if (findHelper(reqUrl.substr(end), child, state))
+                {
+                    return true;
+                }
+                state.params.pop_back();
+            }
+        }
+
+        if (node.pathParamChild != 0U && !reqUrl.empty())
+        {
+            const Node& child = nodes[node.pathParamChild];
+            if (Trie::canMatch(child.subtreeTables, state))
+            {
+                state.params.emplace_back(reqUrl);
+                if (findHelper("", child, state))
+                {
+                    return true;
+                }
+                state.params.pop_back();
+            }
+        }
+
+        const Node* child = findLiteral(node, segment);
+        if (child != nullptr && Trie::canMatch(child->subtreeTables, state))
+        {
+            return findHelper(reqUrl.substr(end), *child, state);
+        }
+        return false;
+    }
+
+    unsigned newNode()
+    {
+        nodes.resize(nodes.size() + 1);
+        literals.resize(literals.size() + 1);
+        return static_cast<unsigned>(nodes.size() - 1);
+    }
+
+    std::vector<Node> nodes;
+    // Literal children of each node, only used while adding rules
+    std::vector<LiteralMap> literals;
+    std::vector<Slot> slots;
+    // Text of every literal segment, referenced by the slots
+    std::string segments;
+    bool compiled = false;
+};
+
 class Router
 {
   public:
@@ -412,61 +859,87 @@ class Router
         static_assert(NumArgs <= 5, "Max number of args supported is 5");
     }
 
-    struct PerMethod
+    // Calls add(url, table) for every url and table that the rule is
+    // registered under
+    template <typename AddFn>
+    static void forEachRoute(std::string_view rule, const BaseRule& ruleObject,
+                             AddFn&& add)
     {
-        std::vector<BaseRule*> rules;
-        Trie trie;
-        // rule index 0 has special meaning; preallocate it to avoid
-        // duplication.
-        PerMethod() : rules(1) {}
-
-        void internalAdd(std::string_view rule, BaseRule* ruleObject)
-        {
-            rules.emplace_back(ruleObject);
-            trie.add(rule, static_cast<unsigned>(rules.size() - 1U));
+        auto addTable = [rule, &add](size_t table) {
+            add(rule, table);
             // directory case:
             //   request to `/about' url matches `/about/' rule
             if (rule.size() > 2 && rule.back() == '/')
             {
-                trie.add(rule.substr(0, rule.size() - 1),
-                         static_cast<unsigned>(rules.size() - 1));
+                add(rule.substr(0, rule.size() - 1), table);
             }
-        }
-    };
-
-    void internalAddRuleObject(const std::string& rule, BaseRule* ruleObject)
-    {
-        if (ruleObject == nullptr)
-        {
-            return;
-        }
+        };
         for (size_t method = 0; method <= maxVerbIndex; method++)
         {
             size_t methodBit = 1 << method;
-            if ((ruleObject->methodsBitfield & methodBit) > 0U)
+            if ((ruleObject.methodsBitfield & methodBit) > 0U)
             {
-                perMethods[method].internalAdd(rule, ruleObject);
+                addTable(method);
             }
         }
 
-        if (ruleObject->isNotFound)
+        if (ruleObject.isNotFound)
+        {
+            addTable(notFoundTable);
+        }
+
+        if (ruleObject.isMethodNotAllowed)
         {
-            notFoundRoutes.internalAdd(rule, ruleObject);
+            addTable(methodNotAllowedTable);
         }
 
-        if (ruleObject->isMethodNotAllowed)
+        if (ruleObject.isUpgrade)
         {
-            methodNotAllowedRoutes.internalAdd(rule, ruleObject);
+            addTable(upgradeTable);
         }
+    }
+
+    void internalAddRuleObject(const std::string& rule, BaseRule* ruleObject)
+    {
+        if (ruleObject == nullptr)
+        {
+            return;
+        }
+        rules.emplace_back(ruleObject);
+        unsigned ruleIndex = static_cast<unsigned>(rules.size() - 1U);
+        forEachRoute(rule, *ruleObject,
+                     [this, ruleIndex](std::string_view url, size_t table) {
+            if (useRouteTable && !routeTable.add(url, table, ruleIndex))
+            {
+                BMCWEB_LOG_DEBUG("Route {} can't use the route table", url);
+                useRouteTable = false;
+            }
+        });
+    }
 
-        if (ruleObject->isUpgrade)
+    // The character trie is only needed for routes the route table can't
+    // represent, and for listing routes, so it's built on demand.
+    void buildTrie()
+    {
+        trie = Trie();
+        for (unsigned ruleIndex = 1U; ruleIndex < rules.size(); ruleIndex++)
         {
-            upgradeRoutes.internalAdd(rule, ruleObject);
+            forEachRoute(rules[ruleIndex]->rule, *rules[ruleIndex],
+                         [this, ruleIndex](std::string_view url, size_t table) {
+                trie.add(url, table, ruleIndex);
+            });
         }
+        trie.validate();
+        trieBuilt = true;
     }
 
     void validate()
     {
+        // Rules can be added after a previous validate(), so start over
+        rules.assign(1U, nullptr);
+        routeTable = RouteTable();
+        useRouteTable = true;
+        trieBuilt = false;
         for (std::unique_ptr<BaseRule>& rule : allRules)
         {
             if (rule)
@@ -480,39 +953,49 @@ class Router
                 internalAddRuleObject(rule->rule, rule.get());
             }
         }
-        for (PerMethod& perMethod : perMethods)
+        if (!useRouteTable || !routeTable.compile())
+        {
+            useRouteTable = false;
+            buildTrie();
+        }
+    }
+
+    Trie::FindResult find(std::string_view url,
+                          Trie::TableBits paramTables) const
+    {
+        if (useRouteTable)
         {
-            perMethod.trie.validate();
+            return routeTable.find(url, paramTables);
         }
+        return trie.find(url, paramTables);
     }
 
     struct FindRoute
     {
         BaseRule* rule = nullptr;
-        std::vector<std::string> params;
+        RouteParams params;
     };
 
     struct FindRouteResponse
     {
         std::string allowHeader;
         FindRoute route;
+        // The 404 route if the url matched no verb, otherwise the 405 route
+        FindRoute fallbackRoute;
     };
 
-    static FindRoute findRouteByPerMethod(std::string_view url,
-                                          const PerMethod& perMethod)
+    FindRoute getRoute(Trie::FindResult& found, size_t table) const
     {
         FindRoute route;
-
-        Trie::FindResult found = perMethod.trie.find(url);
-        if (found.ruleIndex >= perMethod.rules.size())
+        unsigned ruleIndex = found.ruleIndexes[table];
+        if (ruleIndex >= rules.size())
         {
             throw std::runtime_error("Trie internal structure corrupted!");
         }
-        // Found a 404 route, switch that in
-        if (found.ruleIndex != 0U)
+        if (ruleIndex != 0U)
         {
-            route.rule = perMethod.rules[found.ruleIndex];
-            route.params = std::move(found.params);
+            route.rule = rules[ruleIndex];
+            route.params = std::move(found.params[table]);
         }
         return route;
     }
@@ -527,16 +1010,15 @@ class Router
             return findRoute;
         }
         size_t reqMethodIndex = static_cast<size_t>(*verb);
-        // Check to see if this url exists at any verb
-        for (size_t perMethodIndex = 0; perMethodIndex <= maxVerbIndex;
-             perMethodIndex++)
+        // One lookup finds the route for every verb, as well as the 404 and
+        // 405 routes
+        Trie::TableBits paramTables = static_cast<Trie::TableBits>(
+            Trie::tableBit(reqMethodIndex) | Trie::tableBit(notFoundTable) |
+            Trie::tableBit(methodNotAllowedTable));
+        Trie::FindResult found = find(req.url().encoded_path(), paramTables);
+        for (size_t verbIndex = 0; verbIndex <= maxVerbIndex; verbIndex++)
         {
-            // Make sure it's safe to deference the array at that index
-            static_assert(maxVerbIndex <
-                          std::tuple_size_v<decltype(perMethods)>);
-            FindRoute route = findRouteByPerMethod(req.url().encoded_path(),
-                                                   perMethods[perMethodIndex]);
-            if (route.rule == nullptr)
+            if (found.ruleIndexes[verbIndex] == 0U)
             {
                 continue;
             }
@@ -544,12 +1026,15 @@ class Router
             {
                 findRoute.allowHeader += ", ";
             }
-            HttpVerb thisVerb = static_cast<HttpVerb>(perMethodIndex);
+            HttpVerb thisVerb = static_cast<HttpVerb>(verbIndex);
             findRoute.allowHeader += httpVerbToString(thisVerb);
-            if (perMethodIndex == reqMethodIndex)
-            {
-                findRoute.route = route;
-            }
+        }
+        findRoute.route = getRoute(found, reqMethodIndex);
+        if (findRoute.route.rule == nullptr)
+        {
+            findRoute.fallbackRoute = getRoute(
+                found, findRoute.allowHeader.empty() ? notFoundTable
+                                                     : methodNotAllowedTable);
         }
         return findRoute;
     }
@@ -559,12 +1044,8 @@ class Router
                        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                        Adaptor&& adaptor)
     {
-        PerMethod& perMethod = upgradeRoutes;
-        Trie& trie = perMethod.trie;
-        std::vector<BaseRule*>& rules = perMethod.rules;
-
-        Trie::FindResult found = trie.find(req->url().encoded_path());
-        unsigned ruleIndex = found.ruleIndex;
+        Trie::FindResult found = find(req->url().encoded_path(), 0U);
+        unsigned ruleIndex = found.ruleIndexes[upgradeTable];
         if (ruleIndex == 0U)
         {
             BMCWEB_LOG_DEBUG("Cannot match rules {}",
@@ -595,7 +1076,7 @@ class Router
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
     {
         std::optional<HttpVerb> verb = httpVerbFromBoost(req->method());
-        if (!verb || static_cast<size_t>(*verb) >= perMethods.size())
+        if (!verb || static_cast<size_t>(*verb) > maxVerbIndex)
         {
             asyncResp->res.result(boost::beast::http::status::not_found);
             return;
@@ -605,19 +1086,10 @@ class Router
 
         if (foundRoute.route.rule == nullptr)
         {
-            // Couldn't find a normal route with any verb, try looking for a 404
-            // route
-            if (foundRoute.allowHeader.empty())
-            {
-                foundRoute.route = findRouteByPerMethod(
-                    req->url().encoded_path(), notFoundRoutes);
-            }
-            else
-            {
-                // See if we have a method not allowed (405) handler
-                foundRoute.route = findRouteByPerMethod(
-                    req->url().encoded_path(), methodNotAllowedRoutes);
-            }
+            // Couldn't find a normal route for this verb; use the 404 route if
+            // no verb matched, or the method not allowed (405) route if one
+            // did
+            foundRoute.route = std::move(foundRoute.fallbackRoute);
         }
 
         // Fill in the allow header if it's valid
@@ -644,7 +1116,7 @@ class Router
         }
 
         BaseRule& rule = *foundRoute.route.rule;
-        std::vector<std::string> params = std::move(foundRoute.route.params);
+        RouteParams params = std::move(foundRoute.route.params);
 
         BMCWEB_LOG_DEBUG("Matched rule '{}' {} / {}", rule.rule,
                          static_cast<uint32_t>(*verb), rule.getMethods());
@@ -657,41 +1129,58 @@ class Router
         validatePrivilege(
             req, asyncResp, rule,
             [req, asyncResp, &rule, params = std::move(params)]() {
+            startDbusCallTrace(*req, *asyncResp);
+            bmcweb::DbusCallTrace::Scope scope(asyncResp->dbusCallTrace);
             rule.handle(*req, asyncResp, params);
         });
     }
 
     void debugPrint()
     {
-        for (size_t i = 0; i < perMethods.size(); i++)
+        if (!trieBuilt)
         {
-            BMCWEB_LOG_DEBUG("{}", httpVerbToString(static_cast<HttpVerb>(i)));
-            perMethods[i].trie.debugPrint();
+            buildTrie();
         }
+        trie.debugPrint();
     }
 
     std::vector<const std::string*> getRoutes(const std::string& parent)
     {
+        if (!trieBuilt)
+        {
+            buildTrie();
+        }
         std::vector<const std::string*> ret;
 
-        for (const PerMethod& pm : perMethods)
+        std::vector<unsigned> x;
+        trie.findRouteIndexes(parent, x);
+        for (unsigned index : x)
         {
-            std::vector<unsigned> x;
-            pm.trie.findRouteIndexes(parent, x);
-            for (unsigned index : x)
-            {
-                ret.push_back(&pm.rules[index]->rule);
-            }
+            ret.push_back(&rules[index]->rule);
         }
         return ret;
     }
 
-  private:
-    std::array<PerMethod, static_cast<size_t>(HttpVerb::Max)> perMethods;
+    // Every rule, once each, in the order the rule indexes were given out.
+    // Unlike getRoutes(), this includes rules with parameters.
+    std::vector<const BaseRule*> getRules() const
+    {
+        std::vector<const BaseRule*> ret;
+        ret.reserve(rules.size() - 1U);
+        for (size_t ruleIndex = 1U; ruleIndex < rules.size(); ruleIndex++)
+        {
+            ret.push_back(rules[ruleIndex]);
+        }
+        return ret;
+    }
 
-    PerMethod notFoundRoutes;
-    PerMethod upgradeRoutes;
-    PerMethod methodNotAllowedRoutes;
+  private:
+    // rule index 0 has special meaning; preallocate it to avoid duplication.
+    std::vector<BaseRule*> rules{nullptr};
+    RouteTable routeTable;
+    bool useRouteTable = true;
+    Trie trie;
+    bool trieBuilt = false;
 
     std::vector<std::unique_ptr<BaseRule>> allRules;
 };
@@ -7,12 +7,18 @@
 
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
+#include <boost/container/small_vector.hpp>
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace crow
 {
+// Parameters matched from the url, as views into the Request that was routed.
+// Rules take at most 5 parameters, so they never need to allocate.
+using RouteParams = boost::container::small_vector<std::string_view, 5>;
+
 class BaseRule
 {
   public:
@@ -37,7 +43,7 @@ class BaseRule
 
     virtual void handle(const Request& /*req*/,
                         const std::shared_ptr<bmcweb::AsyncResp>&,
-                        const std::vector<std::string>&) = 0;
+                        const RouteParams&) = 0;
     virtual void
         handleUpgrade(const Request& /*req*/,
                       const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
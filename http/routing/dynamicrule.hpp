@@ -8,6 +8,7 @@
 #include <functional>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 namespace crow
@@ -26,9 +27,19 @@ struct Wrapped<Func, std::tuple<ArgsWrapped...>>
 
     std::function<void(ArgsWrapped...)> handler;
 
+    // Converts a url parameter to the type the handler takes, so handlers
+    // taking std::string_view get the view without a copy.
+    template <size_t Index>
+    static auto param(const RouteParams& params)
+    {
+        using ArgType = std::decay_t<
+            std::tuple_element_t<Index + 2, std::tuple<ArgsWrapped...>>>;
+        return ArgType(params[Index]);
+    }
+
     void operator()(const Request& req,
                     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-                    const std::vector<std::string>& params)
+                    const RouteParams& params)
     {
         if constexpr (sizeof...(ArgsWrapped) == 2)
         {
@@ -36,24 +47,26 @@ struct Wrapped<Func, std::tuple<ArgsWrapped...>>
         }
         else if constexpr (sizeof...(ArgsWrapped) == 3)
         {
-            handler(req, asyncResp, params[0]);
+            handler(req, asyncResp, param<0>(params));
         }
         else if constexpr (sizeof...(ArgsWrapped) == 4)
         {
-            handler(req, asyncResp, params[0], params[1]);
+            handler(req, asyncResp, param<0>(params), param<1>(params));
         }
         else if constexpr (sizeof...(ArgsWrapped) == 5)
         {
-            handler(req, asyncResp, params[0], params[1], params[2]);
+            handler(req, asyncResp, param<0>(params), param<1>(params),
+                    param<2>(params));
         }
         else if constexpr (sizeof...(ArgsWrapped) == 6)
         {
-            handler(req, asyncResp, params[0], params[1], params[2], params[3]);
+            handler(req, asyncResp, param<0>(params), param<1>(params),
+                    param<2>(params), param<3>(params));
         }
         else if constexpr (sizeof...(ArgsWrapped) == 7)
         {
-            handler(req, asyncResp, params[0], params[1], params[2], params[3],
-                    params[4]);
+            handler(req, asyncResp, param<0>(params), param<1>(params),
+                    param<2>(params), param<3>(params), param<4>(params));
         }
     }
 };
@@ -74,7 +87,7 @@ class DynamicRule : public BaseRule, public RuleParameterTraits<DynamicRule>
 
     void handle(const Request& req,
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-                const std::vector<std::string>& params) override
+                const RouteParams& params) override
     {
         erasedHandler(req, asyncResp, params);
     }
@@ -89,7 +102,7 @@ class DynamicRule : public BaseRule, public RuleParameterTraits<DynamicRule>
   private:
     std::function<void(const Request&,
                        const std::shared_ptr<bmcweb::AsyncResp>&,
-                       const std::vector<std::string>&)>
+                       const RouteParams&)>
         erasedHandler;
 };
 
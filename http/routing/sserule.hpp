@@ -30,7 +30,7 @@ class SseSocketRule : public BaseRule
 
     void handle(const Request& /*req*/,
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-                const std::vector<std::string>& /*params*/) override
+                const RouteParams& /*params*/) override
     {
         BMCWEB_LOG_ERROR(
             "Handle called on websocket rule.  This should never happen");
@@ -38,7 +38,7 @@ class SseSocketRule : public BaseRule
             boost::beast::http::status::internal_server_error);
     }
 
-    void handleUpgrade(const Request& /*req*/,
+    void handleUpgrade(const Request& req,
                        const std::shared_ptr<bmcweb::AsyncResp>& /*asyncResp*/,
                        boost::asio::ip::tcp::socket&& adaptor) override
     {
@@ -47,9 +47,13 @@ class SseSocketRule : public BaseRule
             myConnection = std::make_shared<
                 crow::sse_socket::ConnectionImpl<boost::asio::ip::tcp::socket>>(
                 std::move(adaptor), openHandler, closeHandler);
+        if (req.ioService != nullptr)
+        {
+            myConnection->setHandlerIoContext(*req.ioService);
+        }
         myConnection->start();
     }
-    void handleUpgrade(const Request& /*req*/,
+    void handleUpgrade(const Request& req,
                        const std::shared_ptr<bmcweb::AsyncResp>& /*asyncResp*/,
                        boost::asio::ssl::stream<boost::asio::ip::tcp::socket>&&
                            adaptor) override
@@ -59,6 +63,10 @@ class SseSocketRule : public BaseRule
             myConnection = std::make_shared<crow::sse_socket::ConnectionImpl<
                 boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>>(
                 std::move(adaptor), openHandler, closeHandler);
+        if (req.ioService != nullptr)
+        {
+            myConnection->setHandlerIoContext(*req.ioService);
+        }
         myConnection->start();
     }
 
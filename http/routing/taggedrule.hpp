@@ -5,9 +5,11 @@
 
 #include <boost/beast/http/verb.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
-#include <vector>
+#include <string_view>
+#include <type_traits>
 
 namespace crow
 {
@@ -43,12 +45,27 @@ class TaggedRule :
                                            Args...>>,
             "Handler function with response argument should have void return type");
 
-        handler = std::forward<Func>(f);
+        if constexpr (std::is_invocable_v<
+                          Func, const crow::Request&,
+                          const std::shared_ptr<bmcweb::AsyncResp>&,
+                          ParamView<Args>...>)
+        {
+            handler = std::forward<Func>(f);
+        }
+        else
+        {
+            handler = [f = std::forward<Func>(f)](
+                          const crow::Request& req,
+                          const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+                          ParamView<Args>... params) mutable {
+                f(req, asyncResp, Args(params)...);
+            };
+        }
     }
 
     void handle(const Request& req,
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-                const std::vector<std::string>& params) override
+                const RouteParams& params) override
     {
         if constexpr (sizeof...(Args) == 0)
         {
@@ -68,19 +85,28 @@ class TaggedRule :
         }
         else if constexpr (sizeof...(Args) == 4)
         {
-            handler(req, asyncResp, params[0], params[1], params[2], params[3]);
+            handler(req, asyncResp, params[0], params[1], params[2],
+                    params[3]);
         }
         else if constexpr (sizeof...(Args) == 5)
         {
-            handler(req, asyncResp, params[0], params[1], params[2], params[3],
-                    params[4]);
+            handler(req, asyncResp, params[0], params[1], params[2],
+                    params[3], params[4]);
         }
         static_assert(sizeof...(Args) <= 5, "More args than are supported");
     }
 
   private:
+    // Url parameters are passed along as views into the request url, so
+    // handlers that take std::string_view get them without a copy.  Handlers
+    // that take std::string are wrapped to make the copy they need.
+    template <typename Arg>
+    using ParamView = std::conditional_t<std::is_same_v<Arg, std::string>,
+                                         std::string_view, Arg>;
+
     std::function<void(const crow::Request&,
-                       const std::shared_ptr<bmcweb::AsyncResp>&, Args...)>
+                       const std::shared_ptr<bmcweb::AsyncResp>&,
+                       ParamView<Args>...)>
         handler;
 };
 } // namespace crow
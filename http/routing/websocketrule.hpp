@@ -27,7 +27,7 @@ class WebSocketRule : public BaseRule
 
     void handle(const Request& /*req*/,
                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-                const std::vector<std::string>& /*params*/) override
+                const RouteParams& /*params*/) override
     {
         BMCWEB_LOG_ERROR(
             "Handle called on websocket rule.  This should never happen");
@@ -46,6 +46,10 @@ class WebSocketRule : public BaseRule
                 crow::websocket::ConnectionImpl<boost::asio::ip::tcp::socket>>(
                 req.url(), req.session, std::move(adaptor), openHandler,
                 messageHandler, messageExHandler, closeHandler, errorHandler);
+        if (req.ioService != nullptr)
+        {
+            myConnection->setHandlerIoContext(*req.ioService);
+        }
         myConnection->start(req);
     }
 
@@ -61,6 +65,10 @@ class WebSocketRule : public BaseRule
                 boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>>(
                 req.url(), req.session, std::move(adaptor), openHandler,
                 messageHandler, messageExHandler, closeHandler, errorHandler);
+        if (req.ioService != nullptr)
+        {
+            myConnection->setHandlerIoContext(*req.ioService);
+        }
         myConnection->start(req);
     }
 
@@ -1,10 +1,14 @@
 #pragma once
+#include "bmcweb_config.h"
+
 #include "http_body.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
+#include "timer_wheel.hpp"
 
 #include <boost/asio/buffer.hpp>
-#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/beast/core/multi_buffer.hpp>
 #include <boost/beast/websocket.hpp>
 
@@ -41,11 +45,8 @@ class ConnectionImpl : public Connection
     ConnectionImpl(Adaptor&& adaptorIn,
                    std::function<void(Connection&)> openHandlerIn,
                    std::function<void(Connection&)> closeHandlerIn) :
-        adaptor(std::move(adaptorIn)),
-        timer(static_cast<boost::asio::io_context&>(
-            adaptor.get_executor().context())),
-        openHandler(std::move(openHandlerIn)),
-        closeHandler(std::move(closeHandlerIn))
+        adaptor(std::move(adaptorIn)), openHandler(std::move(openHandlerIn)),
+        closeHandler(std::move(closeHandlerIn)), handlerIo(&socketIoContext())
 
     {
         BMCWEB_LOG_DEBUG("SseConnectionImpl: SSE constructor {}", logPtr(this));
@@ -62,11 +63,27 @@ class ConnectionImpl : public Connection
     }
 
     boost::asio::io_context& getIoContext() override
+    {
+        return *handlerIo;
+    }
+
+    // See websocket::ConnectionImpl::setHandlerIoContext
+    void setHandlerIoContext(boost::asio::io_context& ioIn)
+    {
+        handlerIo = &ioIn;
+    }
+
+    boost::asio::io_context& socketIoContext()
     {
         return static_cast<boost::asio::io_context&>(
             adaptor.get_executor().context());
     }
 
+    bool onSocketThread()
+    {
+        return socketIoContext().get_executor().running_in_this_thread();
+    }
+
     void start()
     {
         if (!openHandler)
@@ -80,11 +97,30 @@ class ConnectionImpl : public Connection
 
     void close(const std::string_view msg) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()),
+                                   data(std::string(msg))]() { close(data); });
+                return;
+            }
+        }
         BMCWEB_LOG_DEBUG("Closing connection with reason {}", msg);
         // send notification to handler for cleanup
         if (closeHandler)
         {
-            closeHandler(*this);
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                boost::asio::dispatch(
+                    *handlerIo,
+                    [this, self(shared_from_this())]() { closeHandler(*this); });
+            }
+            else
+            {
+                closeHandler(*this);
+            }
         }
         BMCWEB_LOG_DEBUG("Closing SSE connection {} - {}", logPtr(this), msg);
         boost::beast::get_lowest_layer(adaptor).close();
@@ -164,7 +200,7 @@ class ConnectionImpl : public Connection
                          const boost::beast::error_code& ec,
                          size_t bytesTransferred)
     {
-        timer.cancel();
+        deadline.cancel();
         doingWrite = false;
         inputBuffer.consume(bytesTransferred);
 
@@ -189,6 +225,19 @@ class ConnectionImpl : public Connection
 
     void sendEvent(std::string_view id, std::string_view msg) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()),
+                                   idIn(std::string(id)),
+                                   data(std::string(msg))]() {
+                    sendEvent(idIn, data);
+                });
+                return;
+            }
+        }
         if (msg.empty())
         {
             BMCWEB_LOG_DEBUG("Empty data, bailing out.");
@@ -235,33 +284,23 @@ class ConnectionImpl : public Connection
 
     void startTimeout()
     {
-        std::weak_ptr<Connection> weakSelf = weak_from_this();
-        timer.expires_after(std::chrono::seconds(30));
-        timer.async_wait(std::bind_front(&ConnectionImpl::onTimeoutCallback,
-                                         this, weak_from_this()));
+        if (!deadline.hasCallback())
+        {
+            deadline.setCallback(std::bind_front(
+                &ConnectionImpl::onTimeoutCallback, weak_from_this()));
+        }
+        deadline.arm(bmcweb::TimerWheel::getInstance(socketIoContext()),
+                     std::chrono::seconds(30));
     }
 
-    void onTimeoutCallback(const std::weak_ptr<Connection>& weakSelf,
-                           const boost::system::error_code& ec)
+    static void onTimeoutCallback(const std::weak_ptr<Connection>& weakSelf)
     {
         std::shared_ptr<Connection> self = weakSelf.lock();
         if (!self)
         {
-            BMCWEB_LOG_CRITICAL("{} Failed to capture connection",
-                                logPtr(self.get()));
-            return;
-        }
-
-        if (ec == boost::asio::error::operation_aborted)
-        {
-            BMCWEB_LOG_DEBUG("Timer operation aborted");
-            // Canceled wait means the path succeeded.
+            BMCWEB_LOG_DEBUG("Timer fired on connection being destroyed");
             return;
         }
-        if (ec)
-        {
-            BMCWEB_LOG_CRITICAL("{} timer failed {}", logPtr(self.get()), ec);
-        }
 
         BMCWEB_LOG_WARNING("{} Connection timed out, closing",
                            logPtr(self.get()));
@@ -278,11 +317,13 @@ class ConnectionImpl : public Connection
     using BodyType = bmcweb::HttpBody;
     boost::beast::http::response<BodyType> res;
     std::optional<boost::beast::http::response_serializer<BodyType>> serializer;
-    boost::asio::steady_timer timer;
+    bmcweb::Deadline deadline;
     bool doingWrite = false;
 
     std::function<void(Connection&)> openHandler;
     std::function<void(Connection&)> closeHandler;
+
+    boost::asio::io_context* handlerIo;
 };
 } // namespace sse_socket
 } // namespace crow
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "logging.hpp"
+
+#include <boost/asio/execution_context.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace bmcweb
+{
+
+class TimerWheel;
+
+// A timeout that an object re-arms around each of its reads and writes.
+// Arming and cancelling only relink the deadline in its TimerWheel, so they
+// never allocate, and never touch asio's timer queue.
+class Deadline
+{
+  public:
+    Deadline() = default;
+    ~Deadline()
+    {
+        cancel();
+    }
+
+    Deadline(const Deadline&) = delete;
+    Deadline& operator=(const Deadline&) = delete;
+    Deadline(Deadline&&) = delete;
+    Deadline& operator=(Deadline&&) = delete;
+
+    // Called on the wheel's io_context when the deadline passes.  Set once,
+    // up front, so that arming doesn't need to allocate.  The owner can be
+    // destroyed on another thread while the callback runs, so it should hold
+    // a weak_ptr to the owner, rather than a pointer.
+    void setCallback(std::function<void()>&& callbackIn)
+    {
+        callback = std::move(callbackIn);
+    }
+
+    bool hasCallback() const
+    {
+        return static_cast<bool>(callback);
+    }
+
+    // Must be called on the thread that runs the wheel's io_context
+    void arm(TimerWheel& wheelIn, std::chrono::seconds timeout);
+
+    // Can be called from any thread
+    void cancel();
+
+    bool isArmed() const
+    {
+        return wheel.load(std::memory_order_acquire) != nullptr;
+    }
+
+  private:
+    friend class TimerWheel;
+
+    std::atomic<TimerWheel*> wheel = nullptr;
+    Deadline** slot = nullptr;
+    Deadline* prev = nullptr;
+    Deadline* next = nullptr;
+    uint64_t expiry = 0;
+    std::function<void()> callback;
+};
+
+// Runs every Deadline on one io_context off a single asio timer.  Deadlines
+// are kept in two levels of 64 slots; the first covers the next 64 ticks one
+// tick per slot, and the second the next ~4000 ticks, 64 per slot, moving
+// down to the first level as they come close.  A deadline fires up to one
+// tick after it's due.  The timer only runs while a deadline is armed.
+class TimerWheel : public boost::asio::execution_context::service
+{
+  public:
+    static constexpr std::chrono::seconds tick{1};
+    static constexpr size_t slotBits = 6;
+    static constexpr size_t slotCount = size_t{1} << slotBits;
+    static constexpr uint64_t slotMask = slotCount - 1;
+    // Longer timeouts are shortened to this
+    static constexpr uint64_t maxTicks = (slotCount * (slotCount - 1)) - 1;
+
+    using key_type = TimerWheel;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static inline boost::asio::execution_context::id id;
+
+    explicit TimerWheel(boost::asio::execution_context& context) :
+        boost::asio::execution_context::service(context),
+        timer(static_cast<boost::asio::io_context&>(context)),
+        start(std::chrono::steady_clock::now())
+    {}
+
+    ~TimerWheel() override = default;
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    static TimerWheel& getInstance(boost::asio::io_context& context)
+    {
+        return boost::asio::use_service<TimerWheel>(context);
+    }
+
+    // Number of deadlines armed
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return armed;
+    }
+
+  private:
+    friend class Deadline;
+
+    void shutdown() override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::array<Deadline*, slotCount>* level : {&level0, &level1})
+        {
+            for (Deadline*& head : *level)
+            {
+                while (head != nullptr)
+                {
+                    unlink(*head);
+                }
+            }
+        }
+        timer.cancel();
+    }
+
+    uint64_t ticksNow() const
+    {
+        return static_cast<uint64_t>(
+            (std::chrono::steady_clock::now() - start) / tick);
+    }
+
+    void add(Deadline& entry, std::chrono::seconds timeout)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entry.wheel.load(std::memory_order_relaxed) == this)
+        {
+            unlink(entry);
+        }
+        if (armed == 0)
+        {
+            // Nothing to catch up on
+            currentTick = ticksNow();
+        }
+        uint64_t ticks = static_cast<uint64_t>(
+            std::max(timeout, std::chrono::seconds(0)) / tick);
+        if (ticks > maxTicks)
+        {
+            ticks = maxTicks;
+        }
+        // The current tick is already partly gone, so count one more, so
+        // that deadlines are never early
+        entry.expiry = currentTick + ticks + 1;
+        insert(entry);
+        entry.wheel.store(this, std::memory_order_release);
+        armed++;
+        if (!ticking)
+        {
+            ticking = true;
+            scheduleTick();
+        }
+    }
+
+    void remove(Deadline& entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entry.wheel.load(std::memory_order_relaxed) != this)
+        {
+            // Fired or cancelled on another thread first
+            return;
+        }
+        unlink(entry);
+        // Stop ticking once nothing is left to time.  The timer can only be
+        // touched from the thread that runs it; otherwise it stops at the
+        // next tick.
+        if (armed == 0 && ticking &&
+            static_cast<boost::asio::io_context&>(context())
+                .get_executor()
+                .running_in_this_thread())
+        {
+            ticking = false;
+            timer.cancel();
+        }
+    }
+
+    void insert(Deadline& entry)
+    {
+        uint64_t delta = entry.expiry - currentTick;
+        Deadline** head = nullptr;
+        if (delta < slotCount)
+        {
+            head = &level0[entry.expiry & slotMask];
+        }
+        else
+        {
+            head = &level1[(entry.expiry >> slotBits) & slotMask];
+        }
+        entry.slot = head;
+        entry.prev = nullptr;
+        entry.next = *head;
+        if (*head != nullptr)
+        {
+            (*head)->prev = &entry;
+        }
+        *head = &entry;
+    }
+
+    // Takes the deadline out of its slot, and disarms it
+    void unlink(Deadline& entry)
+    {
+        unlinkFromSlot(entry);
+        entry.wheel.store(nullptr, std::memory_order_release);
+        armed--;
+    }
+
+    void unlinkFromSlot(Deadline& entry)
+    {
+        if (entry.prev != nullptr)
+        {
+            entry.prev->next = entry.next;
+        }
+        else
+        {
+            *entry.slot = entry.next;
+        }
+        if (entry.next != nullptr)
+        {
+            entry.next->prev = entry.prev;
+        }
+        entry.slot = nullptr;
+        entry.prev = nullptr;
+        entry.next = nullptr;
+    }
+
+    void scheduleTick()
+    {
+        timer.expires_at(start + (tick * (currentTick + 1)));
+        timer.async_wait([this](const boost::system::error_code& ec) {
+            if (ec == boost::asio::error::operation_aborted)
+            {
+                return;
+            }
+            if (ec)
+            {
+                // Carry on anyway; a deadline that never fires is worse than
+                // one that fires late
+                BMCWEB_LOG_CRITICAL("Timer wheel failed {}", ec.message());
+            }
+            onTick();
+        });
+    }
+
+    void onTick()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t target = ticksNow();
+        while (currentTick < target && armed > 0)
+        {
+            currentTick++;
+            if ((currentTick & slotMask) == 0)
+            {
+                // Move the next 64 ticks worth down to the first level
+                Deadline*& head = level1[(currentTick >> slotBits) & slotMask];
+                while (head != nullptr)
+                {
+                    Deadline& entry = *head;
+                    unlinkFromSlot(entry);
+                    insert(entry);
+                }
+            }
+            Deadline*& head = level0[currentTick & slotMask];
+            while (head != nullptr)
+            {
+                Deadline& entry = *head;
+                unlink(entry);
+                std::function<void()> callback = entry.callback;
+                // The callback can arm or cancel deadlines, including this
+                // one, and its owner can be destroyed once unlocked
+                lock.unlock();
+                if (callback)
+                {
+                    callback();
+                }
+                lock.lock();
+            }
+        }
+        if (armed == 0)
+        {
+            currentTick = target;
+            ticking = false;
+            return;
+        }
+        scheduleTick();
+    }
+
+    boost::asio::steady_timer timer;
+    const std::chrono::steady_clock::time_point start;
+    mutable std::mutex mutex;
+    std::array<Deadline*, slotCount> level0{};
+    std::array<Deadline*, slotCount> level1{};
+    uint64_t currentTick = 0;
+    size_t armed = 0;
+    bool ticking = false;
+};
+
+inline void Deadline::arm(TimerWheel& wheelIn, std::chrono::seconds timeout)
+{
+    TimerWheel* current = wheel.load(std::memory_order_acquire);
+    if (current != nullptr && current != &wheelIn)
+    {
+        current->remove(*this);
+    }
+    wheelIn.add(*this, timeout);
+}
+
+inline void Deadline::cancel()
+{
+    TimerWheel* current = wheel.load(std::memory_order_acquire);
+    if (current != nullptr)
+    {
+        current->remove(*this);
+    }
+}
+
+} // namespace bmcweb
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "base64_kernels.hpp"
 #include "bmcweb_config.h"
 
 extern "C"
@@ -78,6 +79,49 @@ constexpr uint64_t getParameterTag(std::string_view url)
     return tagValue;
 }
 
+// Returns true if every parameter in the route spans a complete path segment,
+// and <path> only appears as the last one.  These are the routes that
+// crow::RouteTable can represent.
+constexpr bool isSegmentRoute(std::string_view url)
+{
+    if (url.empty())
+    {
+        return true;
+    }
+    if (!url.starts_with('/'))
+    {
+        return false;
+    }
+    while (!url.empty())
+    {
+        url.remove_prefix(1);
+        size_t end = url.find('/');
+        if (end == std::string_view::npos)
+        {
+            end = url.size();
+        }
+        std::string_view segment = url.substr(0, end);
+        url.remove_prefix(end);
+        if (segment == "<path>")
+        {
+            if (!url.empty())
+            {
+                return false;
+            }
+            continue;
+        }
+        if (segment == "<str>" || segment == "<string>")
+        {
+            continue;
+        }
+        if (segment.find_first_of("<>") != std::string_view::npos)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 class Base64Encoder
 {
     char overflow1 = '\0';
@@ -138,6 +182,18 @@ class Base64Encoder
             }
         }
 
+        // The bulk goes through the vector kernel, if there is one
+        const Base64Kernels& kernels = getBase64Kernels();
+        if (kernels.kernel != Base64Kernel::Scalar && data.size() >= 16)
+        {
+            size_t outputStart = output.size();
+            output.resize(outputStart + encodedSize(data.size()));
+            size_t consumed =
+                kernels.encode(data.data(), data.size(), &output[outputStart]);
+            output.resize(outputStart + (consumed / 3 * 4));
+            data.remove_prefix(consumed);
+        }
+
         while (data.size() >= 3)
         {
             encodeTriple(data[0], data[1], data[2], output);
@@ -249,11 +305,23 @@ inline bool base64Decode(std::string_view input, std::string& output)
         return decodingData[code];
     };
 
+    // The bulk goes through the vector kernel, if there is one.  It stops at
+    // a 4 char boundary, before padding or any bad char, so the loop below
+    // picks up where it left off.
+    size_t consumed = 0;
+    const Base64Kernels& kernels = getBase64Kernels();
+    if (kernels.kernel != Base64Kernel::Scalar && inputLength >= 16)
+    {
+        output.resize(inputLength / 4 * 3 + 4);
+        consumed = kernels.decode(input.data(), inputLength, output.data());
+        output.resize(consumed / 4 * 3);
+    }
+
     // for each 4-bytes sequence from the input, extract 4 6-bits sequences by
     // dropping first two bits
     // and regenerate into 3 8-bits sequences
 
-    for (size_t i = 0; i < inputLength; i++)
+    for (size_t i = consumed; i < inputLength; i++)
     {
         char base64code0 = 0;
         char base64code1 = 0;
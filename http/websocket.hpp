@@ -1,9 +1,13 @@
 #pragma once
+#include "bmcweb_config.h"
+
 #include "async_resp.hpp"
 #include "http_body.hpp"
 #include "http_request.hpp"
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/beast/core/multi_buffer.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
@@ -68,7 +72,8 @@ class ConnectionImpl : public Connection
         messageHandler(std::move(messageHandlerIn)),
         messageExHandler(std::move(messageExHandlerIn)),
         closeHandler(std::move(closeHandlerIn)),
-        errorHandler(std::move(errorHandlerIn)), session(sessionIn)
+        errorHandler(std::move(errorHandlerIn)), session(sessionIn),
+        handlerIo(&socketIoContext())
     {
         /* Turn on the timeouts on websocket stream to server role */
         ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
@@ -77,11 +82,30 @@ class ConnectionImpl : public Connection
     }
 
     boost::asio::io_context& getIoContext() override
+    {
+        return *handlerIo;
+    }
+
+    // With more than one HTTP thread, the socket is driven by a worker
+    // io_context while the handlers run on the main one.  Handler callbacks
+    // are dispatched to the main io_context, and calls made by handlers are
+    // forwarded to the socket's.
+    void setHandlerIoContext(boost::asio::io_context& ioIn)
+    {
+        handlerIo = &ioIn;
+    }
+
+    boost::asio::io_context& socketIoContext()
     {
         return static_cast<boost::asio::io_context&>(
             ws.get_executor().context());
     }
 
+    bool onSocketThread()
+    {
+        return socketIoContext().get_executor().running_in_this_thread();
+    }
+
     void start(const crow::Request& req)
     {
         BMCWEB_LOG_DEBUG("starting connection {}", logPtr(this));
@@ -136,6 +160,18 @@ class ConnectionImpl : public Connection
 
     void sendBinary(std::string_view msg) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()),
+                                   data(std::string(msg))]() {
+                    sendBinary(data);
+                });
+                return;
+            }
+        }
         ws.binary(true);
         outBuffer.commit(boost::asio::buffer_copy(outBuffer.prepare(msg.size()),
                                                   boost::asio::buffer(msg)));
@@ -145,6 +181,25 @@ class ConnectionImpl : public Connection
     void sendEx(MessageType type, std::string_view msg,
                 std::function<void()>&& onDone) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            // msg is guaranteed to outlive onDone, so it doesn't need a copy,
+            // but onDone needs to run back on the handler thread.
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()), type, msg,
+                                   onDone(std::move(onDone))]() mutable {
+                    sendEx(type, msg,
+                           [handlerIoIn(handlerIo),
+                            onDoneIn(std::move(onDone))]() mutable {
+                        boost::asio::dispatch(*handlerIoIn,
+                                              std::move(onDoneIn));
+                    });
+                });
+                return;
+            }
+        }
         if (doingWrite)
         {
             BMCWEB_LOG_CRITICAL(
@@ -178,6 +233,18 @@ class ConnectionImpl : public Connection
 
     void sendText(std::string_view msg) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()),
+                                   data(std::string(msg))]() {
+                    sendText(data);
+                });
+                return;
+            }
+        }
         ws.text(true);
         outBuffer.commit(boost::asio::buffer_copy(outBuffer.prepare(msg.size()),
                                                   boost::asio::buffer(msg)));
@@ -186,6 +253,18 @@ class ConnectionImpl : public Connection
 
     void close(std::string_view msg) override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(socketIoContext(),
+                                  [this, self(shared_from_this()),
+                                   data(std::string(msg))]() {
+                    close(data);
+                });
+                return;
+            }
+        }
         ws.async_close(
             {boost::beast::websocket::close_code::normal, msg},
             [self(shared_from_this())](const boost::system::error_code& ec) {
@@ -218,15 +297,38 @@ class ConnectionImpl : public Connection
         }
         BMCWEB_LOG_DEBUG("Websocket accepted connection");
 
-        if (openHandler)
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
         {
-            openHandler(*this);
+            boost::asio::dispatch(*handlerIo,
+                                  [this, self(shared_from_this())]() {
+                if (openHandler)
+                {
+                    openHandler(*this);
+                }
+            });
+        }
+        else
+        {
+            if (openHandler)
+            {
+                openHandler(*this);
+            }
         }
         doRead();
     }
 
     void deferRead() override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(
+                    socketIoContext(),
+                    [this, self(shared_from_this())]() { deferRead(); });
+                return;
+            }
+        }
         readingDefered = true;
 
         // If we're not actively reading, we need to take ownership of
@@ -237,6 +339,16 @@ class ConnectionImpl : public Connection
 
     void resumeRead() override
     {
+        if constexpr (BMCWEB_HTTP_THREADS > 1)
+        {
+            if (!onSocketThread())
+            {
+                boost::asio::post(
+                    socketIoContext(),
+                    [this, self(shared_from_this())]() { resumeRead(); });
+                return;
+            }
+        }
         readingDefered = false;
         doRead();
 
@@ -262,7 +374,17 @@ class ConnectionImpl : public Connection
                 if (closeHandler)
                 {
                     std::string reason{ws.reason().reason.c_str()};
-                    closeHandler(*this, reason);
+                    if constexpr (BMCWEB_HTTP_THREADS > 1)
+                    {
+                        boost::asio::dispatch(
+                            *handlerIo, [this, self, reason]() {
+                            closeHandler(*this, reason);
+                        });
+                    }
+                    else
+                    {
+                        closeHandler(*this, reason);
+                    }
                 }
                 return;
             }
@@ -311,6 +433,25 @@ class ConnectionImpl : public Connection
     {
         if (messageExHandler)
         {
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                // inString isn't touched again until the handler completes,
+                // so it can be read from the handler thread without a copy.
+                boost::asio::dispatch(
+                    *handlerIo, [this, self(shared_from_this()), bytesRead]() {
+                    messageExHandler(*this, inString, MessageType::Binary,
+                                     [this, self, bytesRead]() {
+                        boost::asio::dispatch(socketIoContext(),
+                                              [this, self, bytesRead]() {
+                            inBuffer.consume(bytesRead);
+                            inString.clear();
+
+                            doRead();
+                        });
+                    });
+                });
+                return;
+            }
             // Note, because of the interactions with the read buffers,
             // this message handler overrides the normal message handler
             messageExHandler(*this, inString, MessageType::Binary,
@@ -330,7 +471,18 @@ class ConnectionImpl : public Connection
 
         if (messageHandler)
         {
-            messageHandler(*this, inString, ws.got_text());
+            if constexpr (BMCWEB_HTTP_THREADS > 1)
+            {
+                boost::asio::dispatch(*handlerIo,
+                                      [this, self(shared_from_this()),
+                                       msg(inString), isText(ws.got_text())]() {
+                    messageHandler(*this, msg, isText);
+                });
+            }
+            else
+            {
+                messageHandler(*this, inString, ws.got_text());
+            }
         }
         inBuffer.consume(bytesRead);
         inString.clear();
@@ -362,6 +514,8 @@ class ConnectionImpl : public Connection
     std::shared_ptr<persistent_data::UserSession> session;
 
     std::shared_ptr<Connection> selfOwned;
+
+    boost::asio::io_context* handlerIo;
 };
 } // namespace websocket
 } // namespace crow
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace bmcweb
+{
+
+struct AllocationStats
+{
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+// Heap allocations made by the calling thread.  These are only counted when
+// bmcweb is built with the allocation-stats option, which replaces the global
+// operator new; otherwise they stay at zero.
+inline AllocationStats& threadAllocationStats()
+{
+    thread_local AllocationStats stats;
+    return stats;
+}
+
+} // namespace bmcweb
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "dbus_call_trace.hpp"
 #include "http_response.hpp"
+#include "request_arena.hpp"
 
 #include <functional>
+#include <memory>
 
 namespace bmcweb
 {
@@ -17,6 +20,10 @@ class AsyncResp
   public:
     AsyncResp() = default;
     explicit AsyncResp(crow::Response&& resIn) : res(std::move(resIn)) {}
+    // Response headers are allocated from the given arena
+    explicit AsyncResp(const ArenaAllocator<char>& fieldsAlloc) :
+        res(fieldsAlloc)
+    {}
 
     AsyncResp(const AsyncResp&) = delete;
     AsyncResp(AsyncResp&&) = delete;
@@ -25,10 +32,17 @@ class AsyncResp
 
     ~AsyncResp()
     {
+        if (dbusCallTrace != nullptr)
+        {
+            res.addHeader("Server-Timing", dbusCallTrace->serverTiming());
+            dbusCallTrace->log();
+        }
         res.end();
     }
 
     crow::Response res;
+    // Set if the D-Bus calls made for the request are being traced
+    std::shared_ptr<DbusCallTrace> dbusCallTrace;
 };
 
 } // namespace bmcweb
@@ -18,20 +18,26 @@ namespace crow
 namespace authentication
 {
 
-inline void cleanupTempSession(const Request& req)
+inline void cleanupTempSession(
+    const std::shared_ptr<persistent_data::UserSession>& session)
 {
     // TODO(ed) THis should really be handled by the persistent data
     // middleware, but because it is upstream, it doesn't have access to the
     // session information.  Should the data middleware persist the current
     // user session?
-    if (req.session != nullptr &&
-        req.session->persistence ==
+    if (session != nullptr &&
+        session->persistence ==
             persistent_data::PersistenceType::SINGLE_REQUEST)
     {
-        persistent_data::SessionStore::getInstance().removeSession(req.session);
+        persistent_data::SessionStore::getInstance().removeSession(session);
     }
 }
 
+inline void cleanupTempSession(const Request& req)
+{
+    cleanupTempSession(req.session);
+}
+
 inline std::shared_ptr<persistent_data::UserSession>
     performBasicAuth(const boost::asio::ip::address& clientIp,
                      std::string_view authHeader)
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "logging.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dbus
+{
+namespace utility
+{
+
+namespace details
+{
+
+inline void appendCallKey(std::string& key, std::string_view arg)
+{
+    // Arguments can't contain a nul, so one can't run into the next
+    key += arg;
+    key += '\0';
+}
+
+template <typename Arg>
+inline void appendCallKey(std::string& key, const Arg& arg)
+{
+    if constexpr (std::is_convertible_v<const Arg&, std::string_view>)
+    {
+        appendCallKey(key, std::string_view(arg));
+    }
+    else if constexpr (requires { arg.str; })
+    {
+        // sdbusplus object_path and signature
+        appendCallKey(key, std::string_view(arg.str));
+    }
+    else if constexpr (std::integral<Arg>)
+    {
+        appendCallKey(key, std::to_string(arg));
+    }
+    else
+    {
+        static_assert(std::ranges::range<Arg>,
+                      "Unsupported argument type for a coalesced call");
+        key += '[';
+        for (const auto& item : arg)
+        {
+            appendCallKey(key, item);
+        }
+        key += ']';
+    }
+}
+
+} // namespace details
+
+// Identifies a method call by everything that's sent: destination, object,
+// interface, method and arguments
+template <typename... Args>
+inline std::string callKey(std::string_view service, std::string_view path,
+                           std::string_view interface, std::string_view method,
+                           const Args&... args)
+{
+    std::string key;
+    details::appendCallKey(key, service);
+    details::appendCallKey(key, path);
+    details::appendCallKey(key, interface);
+    details::appendCallKey(key, method);
+    (details::appendCallKey(key, args), ...);
+    return key;
+}
+
+// Lets identical read-only calls share one request.  The first caller for a
+// key makes the call; anyone asking for the same thing before the reply
+// comes back waits on it, and all of them get the one reply.  Keyed by the
+// reply type as well as the call, since that's how it gets unpacked.
+//
+// Only used from the io_context thread.
+template <typename... Reply>
+class CallCoalescer
+{
+  public:
+    using Callback = std::function<void(Reply...)>;
+
+    CallCoalescer() = default;
+    ~CallCoalescer() = default;
+    CallCoalescer(const CallCoalescer&) = delete;
+    CallCoalescer& operator=(const CallCoalescer&) = delete;
+    CallCoalescer(CallCoalescer&&) = delete;
+    CallCoalescer& operator=(CallCoalescer&&) = delete;
+
+    static CallCoalescer& getInstance()
+    {
+        static CallCoalescer coalescer;
+        return coalescer;
+    }
+
+    // Returns true if the caller has to make the call, and pass its reply to
+    // complete()
+    bool join(const std::string& key, Callback&& callback)
+    {
+        auto [it, inserted] = pending.try_emplace(key);
+        it->second.emplace_back(std::move(callback));
+        if (!inserted)
+        {
+            joined++;
+        }
+        return inserted;
+    }
+
+    void complete(const std::string& key, Reply... reply)
+    {
+        auto node = pending.extract(key);
+        if (node.empty())
+        {
+            BMCWEB_LOG_ERROR("Reply for a call nobody was waiting on");
+            return;
+        }
+        // Taken out first, so that anyone calling again from their callback
+        // makes a new call
+        std::vector<Callback>& waiters = node.mapped();
+        if (waiters.size() > 1)
+        {
+            BMCWEB_LOG_DEBUG("One reply for {} callers", waiters.size());
+        }
+        for (Callback& waiter : waiters)
+        {
+            waiter(reply...);
+        }
+    }
+
+    size_t size() const
+    {
+        return pending.size();
+    }
+
+    uint64_t getJoined() const
+    {
+        return joined;
+    }
+
+  private:
+    std::unordered_map<std::string, std::vector<Callback>> pending;
+    uint64_t joined = 0;
+};
+
+} // namespace utility
+} // namespace dbus
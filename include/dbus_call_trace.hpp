@@ -0,0 +1,284 @@
+#pragma once
+
+#include "logging.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace bmcweb
+{
+
+// Request header that asks for the D-Bus calls made for the request to be
+// traced, as "X-Bmcweb-Trace: dbus".  Only honored for users with
+// ConfigureManager.
+constexpr std::string_view dbusCallTraceHeader = "X-Bmcweb-Trace";
+
+struct DbusCall
+{
+    std::string service;
+    std::string path;
+    std::string interface;
+    std::string method;
+    std::chrono::steady_clock::duration latency{};
+    // Size of the unpacked reply
+    size_t replyBytes = 0;
+    bool failed = false;
+};
+
+// Rough size of an unpacked D-Bus reply: string lengths plus the size of
+// every number, summed over containers, variants and structs
+template <typename Value>
+inline size_t dbusPayloadSize(const Value& value)
+{
+    if constexpr (std::is_convertible_v<const Value&, std::string_view>)
+    {
+        return std::string_view(value).size();
+    }
+    else if constexpr (std::is_arithmetic_v<Value> || std::is_enum_v<Value>)
+    {
+        return sizeof(Value);
+    }
+    else if constexpr (requires { value.str; })
+    {
+        // sdbusplus object_path and signature
+        return value.str.size();
+    }
+    else if constexpr (requires { value.valueless_by_exception(); })
+    {
+        return std::visit(
+            [](const auto& held) { return dbusPayloadSize(held); }, value);
+    }
+    else if constexpr (std::ranges::range<Value>)
+    {
+        size_t size = 0;
+        for (const auto& item : value)
+        {
+            size += dbusPayloadSize(item);
+        }
+        return size;
+    }
+    else if constexpr (requires { std::tuple_size<Value>::value; })
+    {
+        return std::apply(
+            [](const auto&... members) {
+            return (dbusPayloadSize(members) + ... + size_t{0});
+        },
+            value);
+    }
+    else
+    {
+        // error_code, message, monostate and file descriptors
+        return 0;
+    }
+}
+
+// The D-Bus calls made on behalf of one request.  Calls made while a trace is
+// current are added to it, and their callbacks run with it current again, so
+// calls made from those are added too.
+//
+// Only used from the io_context thread.
+class DbusCallTrace
+{
+  public:
+    // Calls past this many are only counted in the totals
+    static constexpr size_t maxCalls = 512;
+
+    explicit DbusCallTrace(std::string requestIn) :
+        request(std::move(requestIn))
+    {}
+
+    // Makes a trace current until destroyed
+    class Scope
+    {
+      public:
+        explicit Scope(std::shared_ptr<DbusCallTrace> trace) :
+            previous(std::exchange(current(), std::move(trace)))
+        {}
+        ~Scope()
+        {
+            current() = std::move(previous);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        std::shared_ptr<DbusCallTrace> previous;
+    };
+
+    static std::shared_ptr<DbusCallTrace>& current()
+    {
+        thread_local std::shared_ptr<DbusCallTrace> trace;
+        return trace;
+    }
+
+    void add(DbusCall&& call)
+    {
+        count++;
+        totalLatency += call.latency;
+        totalBytes += call.replyBytes;
+        if (calls.size() < maxCalls)
+        {
+            calls.emplace_back(std::move(call));
+        }
+    }
+
+    const std::vector<DbusCall>& getCalls() const
+    {
+        return calls;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    // Value of the Server-Timing response header: the time spent waiting on
+    // all calls, and on the slowest one.  Calls made at the same time each
+    // count in full, so the total can be more than the time the request
+    // took.
+    std::string serverTiming() const
+    {
+        std::string out = std::format(
+            R"(dbus;dur={:.3f};desc="{} calls, {} bytes")",
+            toMilliseconds(totalLatency), count, totalBytes);
+        auto slowest = std::ranges::max_element(calls, {}, &DbusCall::latency);
+        if (slowest != calls.end())
+        {
+            out += std::format(
+                R"(, dbus-slowest;dur={:.3f};desc="{} {} {}.{}")",
+                toMilliseconds(slowest->latency), slowest->service,
+                slowest->path, slowest->interface, slowest->method);
+        }
+        return out;
+    }
+
+    void log() const
+    {
+        BMCWEB_LOG_DEBUG("{} made {} D-Bus calls, {:.3f}ms, {} bytes", request,
+                         count, toMilliseconds(totalLatency), totalBytes);
+        for (const DbusCall& call : calls)
+        {
+            BMCWEB_LOG_DEBUG("  {} {} {}.{} {:.3f}ms {} bytes{}", call.service,
+                             call.path, call.interface, call.method,
+                             toMilliseconds(call.latency), call.replyBytes,
+                             call.failed ? " failed" : "");
+        }
+        if (count > calls.size())
+        {
+            BMCWEB_LOG_DEBUG("  {} more not kept", count - calls.size());
+        }
+    }
+
+  private:
+    static double toMilliseconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    std::string request;
+    std::vector<DbusCall> calls;
+    size_t count = 0;
+    std::chrono::steady_clock::duration totalLatency{};
+    size_t totalBytes = 0;
+};
+
+// Wraps the callback of a method call, to add the call to a trace when the
+// reply comes, then run the callback with the trace current.  operator() takes
+// exactly the arguments the callback does, since sdbusplus unpacks the reply
+// by looking at them.
+template <typename Handler, typename... Args>
+class TracedHandler
+{
+  public:
+    TracedHandler(Handler&& handlerIn, std::shared_ptr<DbusCallTrace> traceIn,
+                  DbusCall&& callIn) :
+        handler(std::move(handlerIn)), trace(std::move(traceIn)),
+        call(std::move(callIn)), start(std::chrono::steady_clock::now())
+    {}
+
+    void operator()(Args... args)
+    {
+        call.latency = std::chrono::steady_clock::now() - start;
+        call.replyBytes = (dbusPayloadSize(args) + ... + size_t{0});
+        if constexpr (sizeof...(Args) > 0)
+        {
+            call.failed = static_cast<bool>(std::get<0>(std::tie(args...)));
+        }
+        trace->add(std::move(call));
+        DbusCallTrace::Scope scope(trace);
+        handler(std::forward<Args>(args)...);
+    }
+
+  private:
+    Handler handler;
+    std::shared_ptr<DbusCallTrace> trace;
+    DbusCall call;
+    std::chrono::steady_clock::time_point start;
+};
+
+namespace details
+{
+
+template <typename Handler, typename Signature>
+struct TracedHandlerFor;
+
+template <typename Handler, typename Class, typename Ret, typename... Args>
+struct TracedHandlerFor<Handler, Ret (Class::*)(Args...)>
+{
+    using type = TracedHandler<Handler, Args...>;
+};
+
+template <typename Handler, typename Class, typename Ret, typename... Args>
+struct TracedHandlerFor<Handler, Ret (Class::*)(Args...) const>
+{
+    using type = TracedHandler<Handler, Args...>;
+};
+
+} // namespace details
+
+// Callback for a call to service, traced as part of trace
+template <typename Handler>
+inline auto traceDbusCall(Handler&& handler,
+                          std::shared_ptr<DbusCallTrace> trace,
+                          std::string_view service, std::string_view path,
+                          std::string_view interface, std::string_view method)
+{
+    using Callback = std::decay_t<Handler>;
+    using Traced = typename details::TracedHandlerFor<
+        Callback, decltype(&Callback::operator())>::type;
+    DbusCall call;
+    call.service = service;
+    call.path = path;
+    call.interface = interface;
+    call.method = method;
+    return Traced(Callback(std::forward<Handler>(handler)), std::move(trace),
+                  std::move(call));
+}
+
+// Wraps a callback that runs later, such as an answer from a cache, so that it
+// runs with the trace that's current now
+template <typename Callback>
+inline auto keepDbusCallTrace(Callback&& callback)
+{
+    return [trace{DbusCallTrace::current()},
+            callback{std::forward<Callback>(callback)}](
+               auto&&... args) mutable {
+        DbusCallTrace::Scope scope(trace);
+        callback(std::forward<decltype(args)>(args)...);
+    };
+}
+
+} // namespace bmcweb
@@ -2,6 +2,7 @@
 #include "app.hpp"
 #include "async_resp.hpp"
 #include "dbus_singleton.hpp"
+#include "http_utility.hpp"
 #include "openbmc_dbus_rest.hpp"
 #include "websocket.hpp"
 
@@ -115,8 +116,8 @@ inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
         return 0;
     }
 
-    connection->sendText(
-        json.dump(2, ' ', true, nlohmann::json::error_handler_t::replace));
+    connection->sendText(json.dump(http_helpers::defaultJsonIndent, ' ', true,
+                                   nlohmann::json::error_handler_t::replace));
     return 0;
 }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "async_resp.hpp"
+#include "bmcweb_config.h"
+#include "dbus_call_trace.hpp"
 #include "dbus_utility.hpp"
 #include "error_messages.hpp"
 #include "http_request.hpp"
@@ -11,6 +14,7 @@
 #include <boost/url/format.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
+#include <format>
 #include <memory>
 #include <string>
 #include <utility>
@@ -102,6 +106,30 @@ inline bool
     return true;
 }
 
+// Starts tracing the D-Bus calls made for the request, if it asks for that
+// and the user can configure the BMC
+inline void startDbusCallTrace(const Request& req,
+                               bmcweb::AsyncResp& asyncResp)
+{
+    if constexpr (!BMCWEB_DBUS_CALL_TRACE)
+    {
+        return;
+    }
+    if (req.session == nullptr || req.session->isConfigureSelfOnly ||
+        req.getHeaderValue(bmcweb::dbusCallTraceHeader) != "dbus")
+    {
+        return;
+    }
+    if (!redfish::getUserPrivileges(*req.session)
+             .isSupersetOf(redfish::Privileges{"ConfigureManager"}))
+    {
+        BMCWEB_LOG_WARNING("D-Bus call trace needs ConfigureManager");
+        return;
+    }
+    asyncResp.dbusCallTrace = std::make_shared<bmcweb::DbusCallTrace>(
+        std::format("{} {}", req.methodString(), req.url().encoded_path()));
+}
+
 inline bool afterGetUserInfoValidate(
     Request& req, const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     BaseRule& rule, const dbus::utility::DBusPropertiesMap& userInfoMap)
@@ -130,7 +158,7 @@ void requestUserInfo(const std::string& username,
                      const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                      CallbackFn&& callback)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, callback = std::forward<CallbackFn>(callback)](
             const boost::system::error_code& ec,
             const dbus::utility::DBusPropertiesMap& userInfoMap) mutable {
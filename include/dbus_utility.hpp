@@ -15,12 +15,18 @@
  */
 #pragma once
 
+#include "bmcweb_config.h"
 #include "boost_formatters.hpp"
+#include "call_coalescer.hpp"
+#include "dbus_call_trace.hpp"
 #include "dbus_singleton.hpp"
 #include "logging.hpp"
+#include "mapper_cache.hpp"
+#include "property_store.hpp"
 
+#include <boost/asio/post.hpp>
 #include <boost/system/error_code.hpp> // IWYU pragma: keep
-#include <sdbusplus/asio/property.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message/native_types.hpp>
 
 #include <array>
@@ -28,12 +34,15 @@
 #include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -84,6 +93,8 @@ using DBusInterfacesMap =
 using ManagedObjectType =
     std::vector<std::pair<sdbusplus::message::object_path, DBusInterfacesMap>>;
 
+using PropertyStore = BasicPropertyStore<DBusPropertiesMap, ManagedObjectType>;
+
 // Map of service name to list of interfaces
 using MapperServiceMap =
     std::vector<std::pair<std::string, std::vector<std::string>>>;
@@ -144,10 +155,49 @@ inline bool getNthStringFromPath(const std::string& path, int index,
     return count >= index;
 }
 
+// async_method_call on the system bus.  If a request's D-Bus calls are being
+// traced, the call is added to the trace when its reply comes.
+template <typename MessageHandler, typename... InputArgs>
+inline void asyncMethodCall(MessageHandler&& handler,
+                            const std::string& service,
+                            const std::string& objpath,
+                            const std::string& interf,
+                            const std::string& method, const InputArgs&... a)
+{
+    if constexpr (BMCWEB_DBUS_CALL_TRACE)
+    {
+        std::shared_ptr<bmcweb::DbusCallTrace> trace =
+            bmcweb::DbusCallTrace::current();
+        if (trace != nullptr)
+        {
+            crow::connections::systemBus->async_method_call(
+                bmcweb::traceDbusCall(std::forward<MessageHandler>(handler),
+                                      std::move(trace), service, objpath,
+                                      interf, method),
+                service, objpath, interf, method, a...);
+            return;
+        }
+    }
+    crow::connections::systemBus->async_method_call(
+        std::forward<MessageHandler>(handler), service, objpath, interf, method,
+        a...);
+}
+
+// Answers a call from a cache.  The answer is posted rather than given
+// straight away, so that, as with a reply, the callback never runs from
+// inside the call, and it runs with the request's trace.
+template <typename Answer>
+inline void postCachedAnswer(Answer&& answer)
+{
+    boost::asio::post(
+        crow::connections::systemBus->get_io_context(),
+        bmcweb::keepDbusCallTrace(std::forward<Answer>(answer)));
+}
+
 template <typename Callback>
 inline void checkDbusPathExists(const std::string& path, Callback&& callback)
 {
-    crow::connections::systemBus->async_method_call(
+    asyncMethodCall(
         [callback = std::forward<Callback>(callback)](
             const boost::system::error_code& ec,
             const dbus::utility::MapperGetObject& objectNames) {
@@ -159,20 +209,252 @@ inline void checkDbusPathExists(const std::string& path, Callback&& callback)
         std::array<std::string, 0>());
 }
 
+template <typename Response>
+using CoalescedCalls =
+    CallCoalescer<const boost::system::error_code&, sdbusplus::message_t&,
+                  const Response&>;
+
+// Makes a read-only method call, unless an identical one is already waiting
+// for its reply, in which case the callback gets that reply instead.
+// Returns true if a call was made.
+template <typename Response, typename... Args>
+inline bool coalescedMethodCall(
+    std::function<void(const boost::system::error_code&,
+                       sdbusplus::message_t&, const Response&)>&& callback,
+    const std::string& service, const std::string& path,
+    const std::string& interface, const std::string& method,
+    const Args&... args)
+{
+    if constexpr (BMCWEB_DBUS_CALL_TRACE)
+    {
+        // Each caller waits for the reply, whether it made the call or not
+        std::shared_ptr<bmcweb::DbusCallTrace> trace =
+            bmcweb::DbusCallTrace::current();
+        if (trace != nullptr)
+        {
+            callback = bmcweb::traceDbusCall(std::move(callback),
+                                             std::move(trace), service, path,
+                                             interface, method);
+        }
+    }
+    std::string key = callKey(service, path, interface, method, args...);
+    CoalescedCalls<Response>& calls = CoalescedCalls<Response>::getInstance();
+    if (!calls.join(key, std::move(callback)))
+    {
+        return false;
+    }
+    crow::connections::systemBus->async_method_call(
+        [key{std::move(key)}](const boost::system::error_code& ec,
+                              sdbusplus::message_t& msg,
+                              const Response& response) {
+        CoalescedCalls<Response>::getInstance().complete(key, ec, msg,
+                                                         response);
+    },
+        service, path, interface, method, args...);
+    return true;
+}
+
+template <typename PropertyType>
+inline void getProperty(
+    const std::string& service, const std::string& objectPath,
+    const std::string& interface, const std::string& propertyName,
+    std::function<void(const boost::system::error_code&, const PropertyType&)>&&
+        callback)
+{
+    coalescedMethodCall<std::variant<std::monostate, PropertyType>>(
+        [callback{std::move(callback)}](
+            const boost::system::error_code& ec, sdbusplus::message_t& /*msg*/,
+            const std::variant<std::monostate, PropertyType>& value) {
+        if (ec)
+        {
+            callback(ec, PropertyType());
+            return;
+        }
+        const PropertyType* property = std::get_if<PropertyType>(&value);
+        if (property == nullptr)
+        {
+            callback(boost::system::errc::make_error_code(
+                         boost::system::errc::invalid_argument),
+                     PropertyType());
+            return;
+        }
+        callback(ec, *property);
+    },
+        service, objectPath, "org.freedesktop.DBus.Properties", "Get",
+        interface, propertyName);
+}
+
+// Same as sdbusplus::asio::setProperty, but made through asyncMethodCall so
+// that it shows up in the request's trace
+template <typename PropertyType, typename Handler>
+inline void setProperty(const std::string& service,
+                        const std::string& objectPath,
+                        const std::string& interface,
+                        const std::string& propertyName,
+                        PropertyType&& propertyValue, Handler&& handler)
+{
+    asyncMethodCall(std::forward<Handler>(handler), service, objectPath,
+                    "org.freedesktop.DBus.Properties", "Set", interface,
+                    propertyName,
+                    std::variant<std::decay_t<PropertyType>>(
+                        std::forward<PropertyType>(propertyValue)));
+}
+
+inline void onMapperCacheInterfacesAdded(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path path;
+    std::vector<std::string> interfaces;
+    try
+    {
+        DBusInterfacesMap added;
+        msg.read(path, added);
+        for (const auto& [interface, properties] : added)
+        {
+            interfaces.emplace_back(interface);
+        }
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        // Properties of a type we don't know; drop everything for the path
+        BMCWEB_LOG_DEBUG("Couldn't read InterfacesAdded from {}",
+                         msg.get_sender());
+        interfaces.clear();
+    }
+    MapperCache::getInstance().onInterfacesChanged(path.str, interfaces);
+}
+
+inline void onMapperCacheInterfacesRemoved(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path path;
+    std::vector<std::string> interfaces;
+    try
+    {
+        msg.read(path, interfaces);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        MapperCache::getInstance().clear();
+        return;
+    }
+    MapperCache::getInstance().onInterfacesChanged(path.str, interfaces);
+}
+
+inline void onMapperCacheNameOwnerChanged(sdbusplus::message_t& msg)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    try
+    {
+        msg.read(name, oldOwner, newOwner);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        MapperCache::getInstance().clear();
+        return;
+    }
+    if (name.starts_with(':'))
+    {
+        // Unique names never show up in mapper replies
+        return;
+    }
+    MapperCache::getInstance().onServiceOwnerChanged(name, !newOwner.empty());
+}
+
+// Listens for the signals that can change what the mapper returns.  Called
+// the first time the cache is used, since it needs the system bus.
+inline void registerMapperCacheSignals()
+{
+    namespace rules = sdbusplus::bus::match::rules;
+    static sdbusplus::bus::match_t interfacesAddedMatch(
+        *crow::connections::systemBus, rules::interfacesAdded(),
+        onMapperCacheInterfacesAdded);
+    static sdbusplus::bus::match_t interfacesRemovedMatch(
+        *crow::connections::systemBus, rules::interfacesRemoved(),
+        onMapperCacheInterfacesRemoved);
+    static sdbusplus::bus::match_t nameOwnerChangedMatch(
+        *crow::connections::systemBus, rules::nameOwnerChanged(),
+        onMapperCacheNameOwnerChanged);
+    static sdbusplus::bus::match_t associationChangedMatch(
+        *crow::connections::systemBus,
+        rules::type::signal() + rules::member("PropertiesChanged") +
+            rules::interface("org.freedesktop.DBus.Properties") +
+            rules::argN(0, "xyz.openbmc_project.Association"),
+        [](sdbusplus::message_t& /*msg*/) {
+        MapperCache::getInstance().onAssociationChanged();
+    });
+}
+
+// Calls the ObjectMapper, or answers from the MapperCache.  args are the
+// arguments to the method, as described by query.
+template <typename Response, typename... Args>
+inline void mapperCall(
+    MapperQuery&& query,
+    std::function<void(const boost::system::error_code&, const Response&)>&&
+        callback,
+    const Args&... args)
+{
+    MapperCache& cache = MapperCache::getInstance();
+    if (!cache.isEnabled())
+    {
+        coalescedMethodCall<Response>(
+            [callback{std::move(callback)}](const boost::system::error_code& ec,
+                                            sdbusplus::message_t& /*msg*/,
+                                            const Response& response) {
+            callback(ec, response);
+        },
+            "xyz.openbmc_project.ObjectMapper",
+            "/xyz/openbmc_project/object_mapper",
+            "xyz.openbmc_project.ObjectMapper", std::string(query.method),
+            args...);
+        return;
+    }
+    registerMapperCacheSignals();
+
+    std::shared_ptr<const Response> cached = cache.find<Response>(query);
+    if (cached != nullptr)
+    {
+        postCachedAnswer(
+            [callback{std::move(callback)}, cached{std::move(cached)}]() {
+            callback(boost::system::error_code(), *cached);
+        });
+        return;
+    }
+    // Only the caller that sent the request keeps the reply.  Anyone who
+    // joined it later may have seen a signal that the reply predates.
+    std::shared_ptr<bool> sent = std::make_shared<bool>(false);
+    std::string method(query.method);
+    *sent = coalescedMethodCall<Response>(
+        [callback{std::move(callback)}, query{std::move(query)},
+         generation{cache.getGeneration()},
+         sent](const boost::system::error_code& ec,
+               sdbusplus::message_t& /*msg*/, const Response& response) {
+        if (!ec && *sent)
+        {
+            MapperCache::getInstance().insert(query, generation, response);
+        }
+        callback(ec, response);
+    },
+        "xyz.openbmc_project.ObjectMapper",
+        "/xyz/openbmc_project/object_mapper",
+        "xyz.openbmc_project.ObjectMapper", method, args...);
+}
+
+inline std::vector<std::string>
+    toStrings(std::span<const std::string_view> interfaces)
+{
+    return {interfaces.begin(), interfaces.end()};
+}
+
 inline void
     getSubTree(const std::string& path, int32_t depth,
                std::span<const std::string_view> interfaces,
                std::function<void(const boost::system::error_code&,
                                   const MapperGetSubTreeResponse&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](
-            const boost::system::error_code& ec,
-            const MapperGetSubTreeResponse& subtree) { callback(ec, subtree); },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree", path, depth,
-        interfaces);
+    mapperCall<MapperGetSubTreeResponse>(
+        {"GetSubTree", path, depth, toStrings(interfaces), ""},
+        std::move(callback), path, depth, interfaces);
 }
 
 inline void getSubTreePaths(
@@ -181,16 +463,9 @@ inline void getSubTreePaths(
     std::function<void(const boost::system::error_code&,
                        const MapperGetSubTreePathsResponse&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](
-            const boost::system::error_code& ec,
-            const MapperGetSubTreePathsResponse& subtreePaths) {
-        callback(ec, subtreePaths);
-    },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths", path, depth,
-        interfaces);
+    mapperCall<MapperGetSubTreePathsResponse>(
+        {"GetSubTreePaths", path, depth, toStrings(interfaces), ""},
+        std::move(callback), path, depth, interfaces);
 }
 
 inline void getAssociatedSubTree(
@@ -200,14 +475,10 @@ inline void getAssociatedSubTree(
     std::function<void(const boost::system::error_code&,
                        const MapperGetSubTreeResponse&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](
-            const boost::system::error_code& ec,
-            const MapperGetSubTreeResponse& subtree) { callback(ec, subtree); },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetAssociatedSubTree",
-        associatedPath, path, depth, interfaces);
+    mapperCall<MapperGetSubTreeResponse>(
+        {"GetAssociatedSubTree", path.str, depth, toStrings(interfaces),
+         associatedPath.str},
+        std::move(callback), associatedPath, path, depth, interfaces);
 }
 
 inline void getAssociatedSubTreePaths(
@@ -217,16 +488,10 @@ inline void getAssociatedSubTreePaths(
     std::function<void(const boost::system::error_code&,
                        const MapperGetSubTreePathsResponse&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](
-            const boost::system::error_code& ec,
-            const MapperGetSubTreePathsResponse& subtreePaths) {
-        callback(ec, subtreePaths);
-    },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetAssociatedSubTreePaths",
-        associatedPath, path, depth, interfaces);
+    mapperCall<MapperGetSubTreePathsResponse>(
+        {"GetAssociatedSubTreePaths", path.str, depth, toStrings(interfaces),
+         associatedPath.str},
+        std::move(callback), associatedPath, path, depth, interfaces);
 }
 
 inline void
@@ -235,14 +500,9 @@ inline void
                   std::function<void(const boost::system::error_code&,
                                      const MapperGetObject&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](const boost::system::error_code& ec,
-                                        const MapperGetObject& object) {
-        callback(ec, object);
-    },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetObject", path, interfaces);
+    mapperCall<MapperGetObject>({"GetObject", path, 0, toStrings(interfaces),
+                                 ""},
+                                std::move(callback), path, interfaces);
 }
 
 inline void getAssociationEndPoints(
@@ -250,23 +510,188 @@ inline void getAssociationEndPoints(
     std::function<void(const boost::system::error_code&,
                        const MapperEndPoints&)>&& callback)
 {
-    sdbusplus::asio::getProperty<MapperEndPoints>(
-        *crow::connections::systemBus, "xyz.openbmc_project.ObjectMapper", path,
+    dbus::utility::getProperty<MapperEndPoints>(
+        "xyz.openbmc_project.ObjectMapper", path,
         "xyz.openbmc_project.Association", "endpoints", std::move(callback));
 }
 
+inline void onPropertyStorePropertiesChanged(sdbusplus::message_t& msg)
+{
+    std::string interface;
+    DBusPropertiesMap changed;
+    std::vector<std::string> invalidated;
+    try
+    {
+        msg.read(interface, changed, invalidated);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        PropertyStore::getInstance().dropOwner(msg.get_sender());
+        return;
+    }
+    PropertyStore::getInstance().onPropertiesChanged(
+        msg.get_sender(), msg.get_path(), interface, changed, invalidated);
+}
+
+inline void onPropertyStoreInterfacesAdded(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path path;
+    DBusInterfacesMap interfaces;
+    try
+    {
+        msg.read(path, interfaces);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        PropertyStore::getInstance().dropOwner(msg.get_sender());
+        return;
+    }
+    PropertyStore::getInstance().onInterfacesAdded(msg.get_sender(), path.str,
+                                                   interfaces);
+}
+
+inline void onPropertyStoreInterfacesRemoved(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path path;
+    std::vector<std::string> interfaces;
+    try
+    {
+        msg.read(path, interfaces);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        PropertyStore::getInstance().dropOwner(msg.get_sender());
+        return;
+    }
+    PropertyStore::getInstance().onInterfacesRemoved(msg.get_sender(),
+                                                     path.str, interfaces);
+}
+
+inline void onPropertyStoreNameOwnerChanged(sdbusplus::message_t& msg)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    try
+    {
+        msg.read(name, oldOwner, newOwner);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        return;
+    }
+    PropertyStore::getInstance().onNameOwnerChanged(name, oldOwner);
+}
+
+// Listens for changes to the PropertyStore interfaces from any service, and
+// to anything on the PropertyStore services.  This has to happen before
+// anything is read, so that no signal after a reply is missed.
+inline void registerPropertyStoreSignals()
+{
+    static std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches =
+        []() {
+        namespace rules = sdbusplus::bus::match::rules;
+        sdbusplus::asio::connection& bus = *crow::connections::systemBus;
+        std::string propertiesChanged =
+            rules::type::signal() + rules::member("PropertiesChanged") +
+            rules::interface("org.freedesktop.DBus.Properties");
+
+        std::vector<std::unique_ptr<sdbusplus::bus::match_t>> out;
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::interfacesAdded(), onPropertyStoreInterfacesAdded));
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::interfacesRemoved(), onPropertyStoreInterfacesRemoved));
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::nameOwnerChanged(), onPropertyStoreNameOwnerChanged));
+        for (std::string_view interface : propertyStoreInterfaces)
+        {
+            out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+                bus, propertiesChanged + rules::argN(0, std::string(interface)),
+                onPropertyStorePropertiesChanged));
+        }
+        for (std::string_view service : propertyStoreServices)
+        {
+            out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+                bus, propertiesChanged + rules::sender(std::string(service)),
+                onPropertyStorePropertiesChanged));
+        }
+        return out;
+    }();
+}
+
+inline void getAllProperties(
+    const std::string& service, const std::string& objectPath,
+    const std::string& interface,
+    std::function<void(const boost::system::error_code&,
+                       const DBusPropertiesMap&)>&& callback)
+{
+    bool store = BMCWEB_DBUS_PROPERTY_STORE &&
+                 PropertyStore::isStored(service, interface);
+    if (store)
+    {
+        registerPropertyStoreSignals();
+        std::optional<DBusPropertiesMap> stored =
+            PropertyStore::getInstance().findProperties(service, objectPath,
+                                                        interface);
+        if (stored)
+        {
+            postCachedAnswer([callback{std::move(callback)},
+                              properties{std::move(*stored)}]() {
+                callback(boost::system::error_code(), properties);
+            });
+            return;
+        }
+    }
+    coalescedMethodCall<DBusPropertiesMap>(
+        [callback{std::move(callback)}, store, service, objectPath,
+         interface](const boost::system::error_code& ec,
+                    sdbusplus::message_t& msg,
+                    const DBusPropertiesMap& properties) {
+        if (!ec && store)
+        {
+            PropertyStore::getInstance().insertProperties(
+                service, msg.get_sender(), objectPath, interface, properties);
+        }
+        callback(ec, properties);
+    },
+        service, objectPath, "org.freedesktop.DBus.Properties", "GetAll",
+        interface);
+}
+
 inline void
     getManagedObjects(const std::string& service,
                       const sdbusplus::message::object_path& path,
                       std::function<void(const boost::system::error_code&,
                                          const ManagedObjectType&)>&& callback)
 {
-    crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](const boost::system::error_code& ec,
-                                        const ManagedObjectType& objects) {
+    bool store = BMCWEB_DBUS_PROPERTY_STORE &&
+                 PropertyStore::isStoredService(service);
+    if (store)
+    {
+        registerPropertyStoreSignals();
+        std::optional<ManagedObjectType> stored =
+            PropertyStore::getInstance().findManagedObjects(service, path.str);
+        if (stored)
+        {
+            postCachedAnswer([callback{std::move(callback)},
+                              objects{std::move(*stored)}]() {
+                callback(boost::system::error_code(), objects);
+            });
+            return;
+        }
+    }
+    coalescedMethodCall<ManagedObjectType>(
+        [callback{std::move(callback)}, store, service,
+         path](const boost::system::error_code& ec, sdbusplus::message_t& msg,
+               const ManagedObjectType& objects) {
+        if (!ec && store)
+        {
+            PropertyStore::getInstance().insertManagedObjects(
+                service, msg.get_sender(), path.str, objects);
+        }
         callback(ec, objects);
     },
-        service, path, "org.freedesktop.DBus.ObjectManager",
+        service, path.str, "org.freedesktop.DBus.ObjectManager",
         "GetManagedObjects");
 }
 
@@ -176,7 +176,7 @@ inline void
         return;
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp{asyncResp}](const boost::system::error_code& ec,
                                const std::vector<uint8_t>& responseBytes) {
         invocationCallback(asyncResp, ec, responseBytes);
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "admission_control.hpp"
+#include "app.hpp"
+#include "async_resp.hpp"
+#include "http_request.hpp"
+#include "tls_session_resumption.hpp"
+
+#include <boost/beast/http/verb.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+
+namespace crow
+{
+namespace http_stats_routes
+{
+
+inline void fillHttpStats(crow::Response& res)
+{
+    AdmissionControl::Counters counters =
+        AdmissionControl::getInstance().getCounters();
+    nlohmann::json& admission = res.jsonValue["Admission"];
+    admission["Connections"] = counters.connections;
+    admission["Requests"] = counters.requests;
+    admission["QueuedConnections"] = counters.queuedConnections;
+    admission["ConnectionsRejected"] = counters.connectionsRejected;
+    admission["ConnectionsDropped"] = counters.connectionsDropped;
+    admission["RequestsRejected"] = counters.requestsRejected;
+
+    // Whether clients get to skip the full handshake, which is what session
+    // tickets and the server side cache are for
+    ensuressl::HandshakeCounters& handshakes = ensuressl::handshakeCounters();
+    nlohmann::json& tls = res.jsonValue["Tls"];
+    tls["FullHandshakes"] = handshakes.full.load();
+    tls["ResumedHandshakes"] = handshakes.resumed.load();
+    tls["TicketKeyRotations"] =
+        ensuressl::SessionTicketKeys::getInstance().getRotations();
+}
+
+inline void
+    handleHttpStatsGet(const crow::Request& /*req*/,
+                       const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    fillHttpStats(asyncResp->res);
+}
+
+inline void requestRoutes(App& app)
+{
+    BMCWEB_ROUTE(app, "/bmcweb/http_stats")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::get)(handleHttpStatsGet);
+}
+
+} // namespace http_stats_routes
+} // namespace crow
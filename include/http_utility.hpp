@@ -1,13 +1,20 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstddef>
 #include <iomanip>
+#include <limits>
+#include <optional>
 #include <ostream>
 #include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 // IWYU pragma: no_include <ctype.h>
@@ -59,13 +66,17 @@ inline ContentType
             header.remove_prefix(1);
         }
         lastIndex = index + 1;
-        // ignore any q-factor weighting (;q=)
-        std::size_t separator = encoding.find(";q=");
+        // ignore any parameters, like q-factor weighting (;q=)
+        std::size_t separator = encoding.find(';');
 
         if (separator != std::string_view::npos)
         {
             encoding = encoding.substr(0, separator);
         }
+        while (encoding.ends_with(' '))
+        {
+            encoding.remove_suffix(1);
+        }
         // If the client allows any encoding, given them the first one on the
         // servers list
         if (encoding == "*/*")
@@ -108,4 +119,298 @@ inline bool isContentTypeAllowed(std::string_view header, ContentType type,
     return type == allowed;
 }
 
+enum class ContentEncoding
+{
+    Identity,
+    Gzip,
+    Deflate,
+};
+
+// Splits one entry of an Accept-Encoding header into its coding, which is
+// left in the argument, and its q-value.
+inline double parseCoding(std::string_view& coding)
+{
+    double qValue = 1.0;
+    size_t paramStart = coding.find(';');
+    if (paramStart != std::string_view::npos)
+    {
+        std::string_view params = coding.substr(paramStart + 1);
+        coding = coding.substr(0, paramStart);
+        size_t qStart = params.find("q=");
+        if (qStart != std::string_view::npos)
+        {
+            std::string_view qStr = params.substr(qStart + 2);
+            // q-values are restricted to 0, 1, or 0.xxx
+            qValue = qStr.starts_with('1') ? 1.0 : 0.0;
+            if (qStr.starts_with("0."))
+            {
+                double scale = 0.1;
+                for (char c : qStr.substr(2, 3))
+                {
+                    if (c < '0' || c > '9')
+                    {
+                        break;
+                    }
+                    qValue += (c - '0') * scale;
+                    scale /= 10;
+                }
+            }
+        }
+    }
+    while (coding.starts_with(' '))
+    {
+        coding.remove_prefix(1);
+    }
+    while (coding.ends_with(' '))
+    {
+        coding.remove_suffix(1);
+    }
+    return qValue;
+}
+
+// Returns how strongly an Accept-Encoding header asks for a content coding,
+// from 0 (refused) to 1.  Codings that aren't listed get the q-value of "*",
+// if there is one.
+inline double getEncodingQuality(std::string_view header,
+                                 std::string_view wanted)
+{
+    double wildcard = 0.0;
+    while (!header.empty())
+    {
+        std::string_view coding = header.substr(0, header.find(','));
+        header.remove_prefix(std::min(coding.size() + 1, header.size()));
+
+        double qValue = parseCoding(coding);
+        if (coding == wanted || (wanted == "gzip" && coding == "x-gzip"))
+        {
+            return qValue;
+        }
+        if (coding == "*")
+        {
+            wildcard = qValue;
+        }
+    }
+    return wildcard;
+}
+
+// Picks the encoding with the highest q-value from an Accept-Encoding
+// header, preferring gzip on a tie.  Encodings refused with q=0 and
+// unsupported encodings are skipped.
+inline ContentEncoding getPreferredEncoding(std::string_view header)
+{
+    ContentEncoding best = ContentEncoding::Identity;
+    double bestQ = 0.0;
+    while (!header.empty())
+    {
+        std::string_view coding = header.substr(0, header.find(','));
+        header.remove_prefix(std::min(coding.size() + 1, header.size()));
+
+        double qValue = parseCoding(coding);
+        ContentEncoding encoding = ContentEncoding::Identity;
+        if (coding == "gzip" || coding == "x-gzip" || coding == "*")
+        {
+            encoding = ContentEncoding::Gzip;
+        }
+        else if (coding == "deflate")
+        {
+            encoding = ContentEncoding::Deflate;
+        }
+        else
+        {
+            continue;
+        }
+        if (qValue > bestQ ||
+            (qValue == bestQ && qValue > 0.0 &&
+             encoding == ContentEncoding::Gzip))
+        {
+            best = encoding;
+            bestQ = qValue;
+        }
+    }
+    return best;
+}
+
+// The name of a content coding, as sent in Content-Encoding
+inline std::string_view getEncodingName(ContentEncoding encoding)
+{
+    switch (encoding)
+    {
+        case ContentEncoding::Gzip:
+            return "gzip";
+        case ContentEncoding::Deflate:
+            return "deflate";
+        case ContentEncoding::Identity:
+            break;
+    }
+    return "identity";
+}
+
+// Each content coding of a body is a different representation, so it gets its
+// own strong entity tag, made by adding the coding to the tag of the
+// uncompressed body: "1234abcd" becomes "1234abcd-gzip"
+inline std::string getEncodedEtag(std::string_view etag,
+                                  ContentEncoding encoding)
+{
+    if (encoding == ContentEncoding::Identity || etag.size() < 2 ||
+        !etag.ends_with('"'))
+    {
+        return std::string(etag);
+    }
+    std::string encoded(etag.substr(0, etag.size() - 1));
+    encoded += '-';
+    encoded += getEncodingName(encoding);
+    encoded += '"';
+    return encoded;
+}
+
+// Whether an entity tag sent by a client is the tag of the uncompressed body,
+// in any of the codings the body could have been sent with
+inline bool etagMatchesAnyEncoding(std::string_view clientEtag,
+                                   std::string_view etag)
+{
+    return std::ranges::any_of(
+        std::to_array({ContentEncoding::Identity, ContentEncoding::Gzip,
+                       ContentEncoding::Deflate}),
+        [clientEtag, etag](ContentEncoding encoding) {
+        return clientEtag == getEncodedEtag(etag, encoding);
+    });
+}
+
+// Indent passed to nlohmann::json::dump for payloads that aren't negotiated
+// with a client, like events.  -1 produces compact output.
+constexpr int defaultJsonIndent = BMCWEB_COMPACT_JSON ? -1 : 2;
+
+// Clients can override the server wide json formatting with a parameter on
+// the json media type, for example "Accept: application/json;format=compact"
+inline int getJsonIndent(std::string_view header)
+{
+    while (!header.empty())
+    {
+        std::string_view mediaRange = header.substr(0, header.find(','));
+        header.remove_prefix(std::min(mediaRange.size() + 1, header.size()));
+
+        size_t paramStart = mediaRange.find(';');
+        std::string_view mediaType = mediaRange.substr(0, paramStart);
+        while (mediaType.starts_with(' '))
+        {
+            mediaType.remove_prefix(1);
+        }
+        while (mediaType.ends_with(' '))
+        {
+            mediaType.remove_suffix(1);
+        }
+        if (paramStart == std::string_view::npos ||
+            (mediaType != "application/json" && mediaType != "*/*"))
+        {
+            continue;
+        }
+        std::string_view params = mediaRange.substr(paramStart);
+        if (params.find("format=compact") != std::string_view::npos)
+        {
+            return -1;
+        }
+        if (params.find("format=pretty") != std::string_view::npos)
+        {
+            return 2;
+        }
+    }
+    return defaultJsonIndent;
+}
+
+// A range from a Range header; first and last are both included
+struct ByteRange
+{
+    size_t first = 0;
+    size_t last = 0;
+};
+
+// Requests for more ranges than this get the full payload instead, so that a
+// short header can't make the server do a disproportionate amount of work
+constexpr size_t maxByteRanges = 16;
+
+inline bool parseRangeNumber(std::string_view str, size_t& value)
+{
+    const char* end = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), end, value);
+    return !str.empty() && ec == std::errc() && ptr == end;
+}
+
+// Parses a "bytes=" Range header against a payload of the given size.
+// Returns std::nullopt if the header should be ignored and the full payload
+// sent, or an empty vector if none of the ranges can be satisfied.
+inline std::optional<std::vector<ByteRange>>
+    parseRange(std::string_view header, size_t size)
+{
+    if (!header.starts_with("bytes="))
+    {
+        return std::nullopt;
+    }
+    header.remove_prefix(6);
+    std::vector<ByteRange> ranges;
+    size_t rangeSpecs = 0;
+    while (!header.empty())
+    {
+        std::string_view spec = header.substr(0, header.find(','));
+        header.remove_prefix(std::min(spec.size() + 1, header.size()));
+        while (spec.starts_with(' '))
+        {
+            spec.remove_prefix(1);
+        }
+        while (spec.ends_with(' '))
+        {
+            spec.remove_suffix(1);
+        }
+        if (spec.empty())
+        {
+            continue;
+        }
+        rangeSpecs++;
+        if (rangeSpecs > maxByteRanges)
+        {
+            return std::nullopt;
+        }
+        size_t dash = spec.find('-');
+        if (dash == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+        std::string_view firstStr = spec.substr(0, dash);
+        std::string_view lastStr = spec.substr(dash + 1);
+        if (firstStr.empty())
+        {
+            // "-N" asks for the last N bytes
+            size_t suffix = 0;
+            if (!parseRangeNumber(lastStr, suffix))
+            {
+                return std::nullopt;
+            }
+            if (suffix != 0 && size != 0)
+            {
+                ranges.push_back({size - std::min(suffix, size), size - 1});
+            }
+            continue;
+        }
+        size_t first = 0;
+        if (!parseRangeNumber(firstStr, first))
+        {
+            return std::nullopt;
+        }
+        size_t last = std::numeric_limits<size_t>::max();
+        if (!lastStr.empty() &&
+            (!parseRangeNumber(lastStr, last) || last < first))
+        {
+            return std::nullopt;
+        }
+        if (first < size)
+        {
+            ranges.push_back({first, std::min(last, size - 1)});
+        }
+    }
+    if (rangeSpecs == 0)
+    {
+        return std::nullopt;
+    }
+    return ranges;
+}
+
 } // namespace http_helpers
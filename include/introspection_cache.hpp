@@ -0,0 +1,311 @@
+#pragma once
+
+#include "logging.hpp"
+#include "service_owner_map.hpp"
+
+#include <tinyxml2.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace crow
+{
+namespace openbmc_mapper
+{
+
+// What org.freedesktop.DBus.Introspectable.Introspect says about an object,
+// parsed out of the XML.  Attributes that weren't given are left empty, and
+// interfaces, methods, signals and properties without a name are skipped.
+struct IntrospectedArg
+{
+    std::string name;
+    std::string direction;
+    std::string type;
+};
+
+struct IntrospectedMember
+{
+    std::string name;
+    std::vector<IntrospectedArg> args;
+};
+
+struct IntrospectedProperty
+{
+    std::string name;
+    std::string type;
+};
+
+struct IntrospectedInterface
+{
+    std::string name;
+    std::vector<IntrospectedMember> methods;
+    std::vector<IntrospectedMember> signals;
+    std::vector<IntrospectedProperty> properties;
+};
+
+struct Introspection
+{
+    std::vector<IntrospectedInterface> interfaces;
+    // Names of the child nodes, relative to the object
+    std::vector<std::string> children;
+
+    const IntrospectedInterface* findInterface(std::string_view name) const
+    {
+        auto it = std::ranges::find(interfaces, name,
+                                    &IntrospectedInterface::name);
+        if (it == interfaces.end())
+        {
+            return nullptr;
+        }
+        return &*it;
+    }
+};
+
+namespace details
+{
+
+inline std::string
+    introspectionAttribute(const tinyxml2::XMLElement& element,
+                           const char* name)
+{
+    const char* value = element.Attribute(name);
+    if (value == nullptr)
+    {
+        return {};
+    }
+    return value;
+}
+
+inline std::vector<IntrospectedMember>
+    parseIntrospectedMembers(const tinyxml2::XMLElement& interface,
+                             const char* kind)
+{
+    std::vector<IntrospectedMember> members;
+    for (const tinyxml2::XMLElement* node = interface.FirstChildElement(kind);
+         node != nullptr; node = node->NextSiblingElement(kind))
+    {
+        IntrospectedMember member;
+        member.name = introspectionAttribute(*node, "name");
+        if (member.name.empty())
+        {
+            continue;
+        }
+        for (const tinyxml2::XMLElement* arg = node->FirstChildElement("arg");
+             arg != nullptr; arg = arg->NextSiblingElement("arg"))
+        {
+            member.args.emplace_back(
+                IntrospectedArg{introspectionAttribute(*arg, "name"),
+                                introspectionAttribute(*arg, "direction"),
+                                introspectionAttribute(*arg, "type")});
+        }
+        members.emplace_back(std::move(member));
+    }
+    return members;
+}
+
+} // namespace details
+
+// Returns nullopt if the XML isn't an introspection document
+inline std::optional<Introspection> parseIntrospection(std::string_view xml)
+{
+    tinyxml2::XMLDocument doc;
+    doc.Parse(xml.data(), xml.size());
+    const tinyxml2::XMLElement* root = doc.FirstChildElement("node");
+    if (root == nullptr)
+    {
+        return std::nullopt;
+    }
+    Introspection introspection;
+    for (const tinyxml2::XMLElement* node = root->FirstChildElement("node");
+         node != nullptr; node = node->NextSiblingElement("node"))
+    {
+        std::string child = details::introspectionAttribute(*node, "name");
+        if (!child.empty())
+        {
+            introspection.children.emplace_back(std::move(child));
+        }
+    }
+    for (const tinyxml2::XMLElement* node =
+             root->FirstChildElement("interface");
+         node != nullptr; node = node->NextSiblingElement("interface"))
+    {
+        IntrospectedInterface interface;
+        interface.name = details::introspectionAttribute(*node, "name");
+        if (interface.name.empty())
+        {
+            continue;
+        }
+        interface.methods = details::parseIntrospectedMembers(*node, "method");
+        interface.signals = details::parseIntrospectedMembers(*node, "signal");
+        for (const tinyxml2::XMLElement* property =
+                 node->FirstChildElement("property");
+             property != nullptr;
+             property = property->NextSiblingElement("property"))
+        {
+            IntrospectedProperty parsed;
+            parsed.name = details::introspectionAttribute(*property, "name");
+            if (parsed.name.empty())
+            {
+                continue;
+            }
+            parsed.type = details::introspectionAttribute(*property, "type");
+            interface.properties.emplace_back(std::move(parsed));
+        }
+        introspection.interfaces.emplace_back(std::move(interface));
+    }
+    return introspection;
+}
+
+// Parsed introspection of the objects the /bus/system REST API has looked
+// at, keyed by service and path, so that a PUT or an action doesn't have to
+// introspect the object again.  Besides what ServiceOwnerMap drops, entries
+// are dropped when the connection that answered adds or removes interfaces
+// on the object, or on anything under it, which can change its child nodes.
+// Only used from the io_context thread.
+class IntrospectionCache
+{
+  public:
+    // Nothing more is kept past this many objects, until old ones are pruned
+    static constexpr size_t maxEntries = 4096;
+
+    IntrospectionCache() = default;
+    ~IntrospectionCache() = default;
+    IntrospectionCache(const IntrospectionCache&) = delete;
+    IntrospectionCache& operator=(const IntrospectionCache&) = delete;
+    IntrospectionCache(IntrospectionCache&&) = delete;
+    IntrospectionCache& operator=(IntrospectionCache&&) = delete;
+
+    static IntrospectionCache& getInstance()
+    {
+        static IntrospectionCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const Introspection> find(std::string_view service,
+                                              std::string_view path)
+    {
+        Objects* objects = services.find(service);
+        if (objects != nullptr)
+        {
+            auto object = objects->find(path);
+            if (object != objects->end() &&
+                Services::isFresh(object->second.added))
+            {
+                hits++;
+                return object->second.introspection;
+            }
+        }
+        misses++;
+        return nullptr;
+    }
+
+    // owner is the unique name that sent the reply
+    void insert(std::string_view service, std::string_view owner,
+                std::string_view path,
+                std::shared_ptr<const Introspection> introspection)
+    {
+        if (services.pruneDue())
+        {
+            services.prune([this](Objects& objects) {
+                count -= std::erase_if(objects, [](const auto& item) {
+                    return !Services::isFresh(item.second.added);
+                });
+                return objects.empty();
+            });
+            BMCWEB_LOG_DEBUG("Introspection cache holds {} objects", count);
+        }
+        if (count >= maxEntries)
+        {
+            return;
+        }
+        Objects& objects = services.forOwner(service, owner);
+        auto [it, inserted] = objects.insert_or_assign(
+            std::string(path),
+            Object{std::move(introspection), Services::now()});
+        if (inserted)
+        {
+            count++;
+        }
+    }
+
+    // InterfacesAdded or InterfacesRemoved from sender on path
+    void onInterfacesChanged(std::string_view sender, std::string_view path)
+    {
+        services.forEachOwnedBy(sender, [this, path](std::string_view,
+                                                     Objects& objects) {
+            // The object itself, and every node above it
+            std::string_view node = path;
+            while (true)
+            {
+                auto object = objects.find(node);
+                if (object != objects.end())
+                {
+                    objects.erase(object);
+                    count--;
+                }
+                if (node.empty() || node == "/")
+                {
+                    break;
+                }
+                size_t slash = node.rfind('/');
+                node = node.substr(0, slash == 0 ? 1 : slash);
+            }
+        });
+    }
+
+    void onNameOwnerChanged(std::string_view name, std::string_view oldOwner)
+    {
+        services.onNameOwnerChanged(name, oldOwner);
+    }
+
+    void dropOwner(std::string_view owner)
+    {
+        services.dropOwner(owner);
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    uint64_t getHits() const
+    {
+        return hits;
+    }
+
+    uint64_t getMisses() const
+    {
+        return misses;
+    }
+
+  private:
+    struct Object
+    {
+        std::shared_ptr<const Introspection> introspection;
+        std::chrono::steady_clock::time_point added;
+    };
+
+    using Objects = std::map<std::string, Object, std::less<>>;
+    using Services = dbus::utility::ServiceOwnerMap<Objects>;
+
+    // Objects kept across all services
+    size_t count = 0;
+    Services services{[this](const Objects& objects) {
+        count -= objects.size();
+    }};
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace openbmc_mapper
+} // namespace crow
@@ -1,6 +1,7 @@
 #pragma once
 #include "app.hpp"
 #include "async_resp.hpp"
+#include "buffer_pool.hpp"
 #include "websocket.hpp"
 
 #include <sys/socket.h>
@@ -14,6 +15,8 @@ namespace obmc_kvm
 
 static constexpr const uint maxSessions = 4;
 
+static constexpr size_t kvmOutputBufferSize = 1024UL * 50UL;
+
 class KvmSession : public std::enable_shared_from_this<KvmSession>
 {
   public:
@@ -64,7 +67,35 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
     }
 
   protected:
+    // Waits for the KVM server to have something to send before borrowing a
+    // buffer to read it into, so an idle session holds no buffer
     void doRead()
+    {
+        hostSocket.async_wait(
+            boost::asio::socket_base::wait_read,
+            [this,
+             weak(weak_from_this())](const boost::system::error_code& ec) {
+            auto self = weak.lock();
+            if (self == nullptr)
+            {
+                return;
+            }
+            if (ec)
+            {
+                BMCWEB_LOG_ERROR("conn:{}, Couldn't wait on KVM socket: {}",
+                                 logPtr(&conn), ec);
+                if (ec != boost::asio::error::operation_aborted)
+                {
+                    conn.close("Error in connecting to KVM port");
+                }
+                return;
+            }
+            outputBuffer.acquire();
+            readAvailable();
+        });
+    }
+
+    void readAvailable()
     {
         std::size_t bytes = outputBuffer.capacity() - outputBuffer.size();
         BMCWEB_LOG_DEBUG("conn:{}, Reading {} from kvm socket", logPtr(&conn),
@@ -100,6 +131,7 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
                              payload.size());
             conn.sendBinary(payload);
             outputBuffer.consume(bytesRead);
+            outputBuffer.release();
 
             doRead();
         });
@@ -157,7 +189,7 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
 
     crow::websocket::Connection& conn;
     boost::asio::ip::tcp::socket hostSocket;
-    boost::beast::flat_static_buffer<1024UL * 50UL> outputBuffer;
+    bmcweb::PooledFlatBuffer<kvmOutputBufferSize> outputBuffer;
     boost::beast::flat_static_buffer<1024UL> inputBuffer;
     bool doingWrite{false};
 };
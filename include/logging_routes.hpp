@@ -0,0 +1,139 @@
+#pragma once
+
+#include "app.hpp"
+#include "async_resp.hpp"
+#include "http_request.hpp"
+#include "logging.hpp"
+
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace crow
+{
+namespace logging_routes
+{
+
+inline std::optional<LogLevel> getLogLevel(const nlohmann::json& name)
+{
+    const std::string* nameStr = name.get_ptr<const std::string*>();
+    if (nameStr == nullptr)
+    {
+        return std::nullopt;
+    }
+    const auto* iter = std::ranges::find(mapLogLevelFromName, *nameStr);
+    if (iter == mapLogLevelFromName.end())
+    {
+        return std::nullopt;
+    }
+    return static_cast<LogLevel>(iter - mapLogLevelFromName.begin());
+}
+
+inline void fillLogLevels(crow::Response& res)
+{
+    RuntimeLogLevels& levels = RuntimeLogLevels::getInstance();
+    res.jsonValue["MaxLevel"] =
+        mapLogLevelFromName[static_cast<size_t>(bmcwebMaxLoggingLevel)];
+    nlohmann::json& categories = res.jsonValue["Categories"];
+    for (size_t i = 0; i < mapLogCategoryFromName.size(); i++)
+    {
+        LogLevel level = levels.get(static_cast<LogCategory>(i));
+        categories[mapLogCategoryFromName[i]] =
+            mapLogLevelFromName[static_cast<size_t>(level)];
+    }
+}
+
+inline void
+    handleLoggingGet(const crow::Request& /*req*/,
+                     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    fillLogLevels(asyncResp->res);
+}
+
+// Takes {"Level": "DEBUG"} to set every category, and/or
+// {"Categories": {"dbus": "DEBUG"}} to set some of them.  Levels are
+// lowered to MaxLevel.  Nothing is changed unless the whole body is valid.
+inline void
+    handleLoggingPatch(const crow::Request& req,
+                       const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    nlohmann::json body = nlohmann::json::parse(req.body(), nullptr, false);
+    if (!body.is_object())
+    {
+        BMCWEB_LOG_DEBUG("Bad json in request");
+        asyncResp->res.result(boost::beast::http::status::bad_request);
+        return;
+    }
+
+    std::optional<LogLevel> level;
+    std::vector<std::pair<LogCategory, LogLevel>> categoryLevels;
+    for (const auto& [key, value] : body.items())
+    {
+        if (key == "Level")
+        {
+            level = getLogLevel(value);
+            if (!level)
+            {
+                BMCWEB_LOG_DEBUG("Unknown log level");
+                asyncResp->res.result(boost::beast::http::status::bad_request);
+                return;
+            }
+            continue;
+        }
+        if (key != "Categories" || !value.is_object())
+        {
+            BMCWEB_LOG_DEBUG("Unexpected property {}", key);
+            asyncResp->res.result(boost::beast::http::status::bad_request);
+            return;
+        }
+        for (const auto& [categoryName, categoryValue] : value.items())
+        {
+            std::optional<LogCategory> category =
+                getLogCategoryFromName(categoryName);
+            std::optional<LogLevel> categoryLevel = getLogLevel(categoryValue);
+            if (!category || !categoryLevel)
+            {
+                BMCWEB_LOG_DEBUG("Bad log level for category {}",
+                                 categoryName);
+                asyncResp->res.result(boost::beast::http::status::bad_request);
+                return;
+            }
+            categoryLevels.emplace_back(*category, *categoryLevel);
+        }
+    }
+
+    RuntimeLogLevels& levels = RuntimeLogLevels::getInstance();
+    if (level)
+    {
+        levels.set(*level);
+    }
+    for (const auto& [category, categoryLevel] : categoryLevels)
+    {
+        levels.set(category, categoryLevel);
+    }
+    BMCWEB_LOG_INFO("Log levels changed by {}",
+                    req.session == nullptr ? "" : req.session->username);
+    fillLogLevels(asyncResp->res);
+}
+
+inline void requestRoutes(App& app)
+{
+    BMCWEB_ROUTE(app, "/bmcweb/logging")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::get)(handleLoggingGet);
+
+    BMCWEB_ROUTE(app, "/bmcweb/logging")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::patch)(handleLoggingPatch);
+}
+
+} // namespace logging_routes
+} // namespace crow
@@ -0,0 +1,400 @@
+#pragma once
+
+#include "bmcweb_config.h"
+#include "dbus_call_trace.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dbus
+{
+namespace utility
+{
+
+// One call to the ObjectMapper, which is also what its reply is cached under
+struct MapperQuery
+{
+    std::string_view method;
+    std::string path;
+    int32_t depth = 0;
+    std::vector<std::string> interfaces;
+    // Only set for the GetAssociated* methods
+    std::string associatedPath;
+
+    std::string key() const
+    {
+        std::string out(method);
+        out += '\0';
+        out += associatedPath;
+        out += '\0';
+        out += path;
+        out += '\0';
+        out += std::to_string(depth);
+        for (const std::string& interface : interfaces)
+        {
+            out += '\0';
+            out += interface;
+        }
+        return out;
+    }
+};
+
+// Replies from the ObjectMapper, kept until a signal says they might have
+// changed.  Entries are dropped when:
+// - an object in the scope of the query, or in the reply, has interfaces that
+//   the query asks for added or removed
+// - a service in the reply loses its name, or any service gains one, since
+//   the mapper then introspects it
+// - for association queries, anything is added or removed, or any
+//   association changes
+// The mapper handles the same signals in its own time, so replies aren't
+// kept for a little while after anything changes, and entries expire
+// after maxAge regardless.
+//
+// A single GetSubTree of "/" can be large, so besides the number of entries,
+// the total size of the replies is bounded too.  Sizes are estimated with
+// dbusPayloadSize, which leaves out the overhead of the containers.
+class MapperCache
+{
+  public:
+    static constexpr size_t maxEntries = 1024;
+    static constexpr size_t maxBytes = 4U * 1024U * 1024U;
+    static constexpr std::chrono::seconds settleTime{1};
+    static constexpr std::chrono::seconds maxAge{300};
+
+    MapperCache() = default;
+    ~MapperCache() = default;
+    MapperCache(const MapperCache&) = delete;
+    MapperCache& operator=(const MapperCache&) = delete;
+    MapperCache(MapperCache&&) = delete;
+    MapperCache& operator=(MapperCache&&) = delete;
+
+    static MapperCache& getInstance()
+    {
+        static MapperCache cache;
+        return cache;
+    }
+
+    bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // Turning the cache off drops everything in it
+    void setEnabled(bool enable)
+    {
+        enabled.store(enable, std::memory_order_relaxed);
+        if (!enable)
+        {
+            clear();
+        }
+    }
+
+    template <typename Response>
+    std::shared_ptr<const Response> find(const MapperQuery& query)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(query.key());
+        if (it == entries.end() ||
+            std::chrono::steady_clock::now() - it->second.added > maxAge)
+        {
+            misses++;
+            return nullptr;
+        }
+        hits++;
+        return std::static_pointer_cast<const Response>(it->second.response);
+    }
+
+    // Taken before calling the mapper, and passed to insert, so that a reply
+    // that raced a signal isn't kept
+    uint64_t getGeneration() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return generation;
+    }
+
+    template <typename Response>
+    void insert(const MapperQuery& query, uint64_t startGeneration,
+                const Response& response)
+    {
+        Entry entry;
+        entry.bytes = bmcweb::dbusPayloadSize(response);
+        if (entry.bytes > maxBytes)
+        {
+            return;
+        }
+        collectMentions(response, entry.paths, entry.services);
+        entry.bytes += bmcweb::dbusPayloadSize(entry.paths) +
+                       bmcweb::dbusPayloadSize(entry.services);
+        entry.response = std::make_shared<const Response>(response);
+        entry.added = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!isEnabled() || startGeneration != generation ||
+            entry.added - lastChange < settleTime)
+        {
+            return;
+        }
+        std::string key = query.key();
+        auto existing = entries.find(key);
+        if (existing != entries.end())
+        {
+            bytes -= existing->second.bytes;
+            entries.erase(existing);
+        }
+        if (entries.size() >= maxEntries || bytes + entry.bytes > maxBytes)
+        {
+            bytes -= eraseIf([&entry](const Entry& item) {
+                return entry.added - item.added > maxAge;
+            });
+            if (entries.size() >= maxEntries || bytes + entry.bytes > maxBytes)
+            {
+                return;
+            }
+        }
+        entry.query = query;
+        bytes += entry.bytes;
+        entries.emplace(std::move(key), std::move(entry));
+    }
+
+    // An object had interfaces added or removed.  An empty list of
+    // interfaces means they aren't known.
+    void onInterfacesChanged(std::string_view objectPath,
+                             std::span<const std::string> interfaces)
+    {
+        dropIf([objectPath, interfaces](const Entry& entry) {
+            return isAffected(entry, objectPath, interfaces);
+        });
+    }
+
+    // An association's endpoints changed
+    void onAssociationChanged()
+    {
+        dropIf([](const Entry& entry) {
+            return !entry.query.associatedPath.empty();
+        });
+    }
+
+    // A well known name was taken or released
+    void onServiceOwnerChanged(std::string_view service, bool appeared)
+    {
+        if (appeared)
+        {
+            clear();
+            return;
+        }
+        dropIf([service](const Entry& entry) {
+            // Replies with only paths can't say which service they came from
+            return entry.services.empty() ||
+                   std::ranges::find(entry.services, service) !=
+                       entry.services.end();
+        });
+    }
+
+    void clear()
+    {
+        dropIf([](const Entry&) { return true; });
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    // Estimated size of everything kept
+    size_t sizeBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bytes;
+    }
+
+    uint64_t getHits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+
+    uint64_t getMisses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return misses;
+    }
+
+    uint64_t getInvalidations() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return invalidations;
+    }
+
+  private:
+    struct Entry
+    {
+        MapperQuery query;
+        // Object paths and services the reply lists, sorted
+        std::vector<std::string> paths;
+        std::vector<std::string> services;
+        std::shared_ptr<const void> response;
+        std::chrono::steady_clock::time_point added;
+        // Estimated size of the reply and the mentions
+        size_t bytes = 0;
+    };
+
+    // Replies are a list of paths, a list of services and their interfaces,
+    // or a list of paths, each with a list of services and their interfaces
+    template <typename Response>
+    static void collectMentions(const Response& response,
+                                std::vector<std::string>& paths,
+                                std::vector<std::string>& services)
+    {
+        using Value = typename Response::value_type;
+        if constexpr (std::is_convertible_v<Value, std::string>)
+        {
+            paths.assign(response.begin(), response.end());
+        }
+        else if constexpr (std::is_convertible_v<typename Value::second_type,
+                                                 std::vector<std::string>>)
+        {
+            for (const auto& [service, interfaces] : response)
+            {
+                services.emplace_back(service);
+            }
+        }
+        else
+        {
+            for (const auto& [path, serviceMap] : response)
+            {
+                paths.emplace_back(path);
+                for (const auto& [service, interfaces] : serviceMap)
+                {
+                    services.emplace_back(service);
+                }
+            }
+        }
+        std::ranges::sort(paths);
+        std::ranges::sort(services);
+        services.erase(std::ranges::unique(services).begin(), services.end());
+    }
+
+    // Whether objectPath is at or below root, and no more than depth levels
+    // down, with 0 meaning any depth
+    static bool inScope(std::string_view root, int32_t depth,
+                        std::string_view objectPath)
+    {
+        if (root.ends_with('/'))
+        {
+            root.remove_suffix(1);
+        }
+        if (!objectPath.starts_with(root))
+        {
+            return false;
+        }
+        std::string_view rest = objectPath.substr(root.size());
+        if (rest.empty())
+        {
+            return true;
+        }
+        if (!rest.starts_with('/'))
+        {
+            return false;
+        }
+        if (depth <= 0)
+        {
+            return true;
+        }
+        return std::ranges::count(rest, '/') <= depth;
+    }
+
+    static bool isAffected(const Entry& entry, std::string_view objectPath,
+                           std::span<const std::string> interfaces)
+    {
+        const MapperQuery& query = entry.query;
+        if (!query.associatedPath.empty())
+        {
+            // Any object can bring an association with it
+            return true;
+        }
+        if (std::ranges::binary_search(entry.paths, objectPath))
+        {
+            return true;
+        }
+        if (query.method == "GetObject")
+        {
+            // The reply lists every interface the services have on the
+            // object, not only the ones the query asks for
+            return objectPath == query.path;
+        }
+        bool wanted = query.interfaces.empty() || interfaces.empty() ||
+                      std::ranges::any_of(
+                          interfaces, [&query](const std::string& interface) {
+            return std::ranges::find(query.interfaces, interface) !=
+                   query.interfaces.end();
+        });
+        if (!wanted)
+        {
+            return false;
+        }
+        return inScope(query.path, query.depth, objectPath);
+    }
+
+    // Returns the size of what was erased.  Called with the mutex held.
+    template <typename Predicate>
+    size_t eraseIf(Predicate&& predicate)
+    {
+        size_t erased = 0;
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (!predicate(it->second))
+            {
+                it++;
+                continue;
+            }
+            erased += it->second.bytes;
+            it = entries.erase(it);
+        }
+        return erased;
+    }
+
+    template <typename Predicate>
+    void dropIf(Predicate&& predicate)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+        lastChange = std::chrono::steady_clock::now();
+        size_t before = entries.size();
+        bytes -= eraseIf(predicate);
+        size_t dropped = before - entries.size();
+        invalidations += dropped;
+        if (dropped != 0)
+        {
+            BMCWEB_LOG_DEBUG("Dropped {} mapper cache entries", dropped);
+        }
+    }
+
+    std::atomic<bool> enabled = BMCWEB_MAPPER_CACHE;
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    // Sum of the bytes of every entry
+    size_t bytes = 0;
+    uint64_t generation = 0;
+    std::chrono::steady_clock::time_point lastChange;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t invalidations = 0;
+};
+
+} // namespace utility
+} // namespace dbus
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "app.hpp"
+#include "async_resp.hpp"
+#include "http_request.hpp"
+#include "logging.hpp"
+#include "mapper_cache.hpp"
+
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+
+namespace crow
+{
+namespace mapper_cache_routes
+{
+
+inline void fillMapperCacheStats(crow::Response& res)
+{
+    dbus::utility::MapperCache& cache =
+        dbus::utility::MapperCache::getInstance();
+    res.jsonValue["Enabled"] = cache.isEnabled();
+    res.jsonValue["Entries"] = cache.size();
+    res.jsonValue["Hits"] = cache.getHits();
+    res.jsonValue["Misses"] = cache.getMisses();
+    res.jsonValue["Invalidations"] = cache.getInvalidations();
+}
+
+inline void
+    handleMapperCacheGet(const crow::Request& /*req*/,
+                         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    fillMapperCacheStats(asyncResp->res);
+}
+
+// Takes {"Enabled": false} to stop caching, and drop everything cached
+inline void
+    handleMapperCachePatch(const crow::Request& req,
+                           const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    nlohmann::json body = nlohmann::json::parse(req.body(), nullptr, false);
+    if (!body.is_object() || body.size() != 1)
+    {
+        BMCWEB_LOG_DEBUG("Bad json in request");
+        asyncResp->res.result(boost::beast::http::status::bad_request);
+        return;
+    }
+    auto enabled = body.find("Enabled");
+    if (enabled == body.end() || !enabled->is_boolean())
+    {
+        BMCWEB_LOG_DEBUG("Enabled must be a boolean");
+        asyncResp->res.result(boost::beast::http::status::bad_request);
+        return;
+    }
+    dbus::utility::MapperCache::getInstance().setEnabled(
+        enabled->get<bool>());
+    fillMapperCacheStats(asyncResp->res);
+}
+
+inline void requestRoutes(App& app)
+{
+    BMCWEB_ROUTE(app, "/bmcweb/mapper_cache")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::get)(handleMapperCacheGet);
+
+    BMCWEB_ROUTE(app, "/bmcweb/mapper_cache")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::patch)(handleMapperCachePatch);
+}
+
+} // namespace mapper_cache_routes
+} // namespace crow
@@ -20,6 +20,7 @@
 #include "dbus_utility.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
+#include "introspection_cache.hpp"
 #include "json_formatters.hpp"
 #include "logging.hpp"
 #include "parsing.hpp"
@@ -28,7 +29,6 @@
 
 #include <systemd/sd-bus-protocol.h>
 #include <systemd/sd-bus.h>
-#include <tinyxml2.h>
 
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
@@ -37,7 +37,7 @@
 #include <boost/system/error_code.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/asio/connection.hpp>
-#include <sdbusplus/asio/property.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/exception.hpp>
 #include <sdbusplus/message.hpp>
 #include <sdbusplus/message/native_types.hpp>
@@ -55,6 +55,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <regex>
 #include <string>
@@ -116,6 +117,109 @@ inline void setErrorResponse(crow::Response& res,
     res.jsonValue["status"] = "error";
 }
 
+inline void onIntrospectionCacheInterfacesChanged(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path path;
+    try
+    {
+        msg.read(path);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        IntrospectionCache::getInstance().dropOwner(msg.get_sender());
+        return;
+    }
+    IntrospectionCache::getInstance().onInterfacesChanged(msg.get_sender(),
+                                                          path.str);
+}
+
+inline void onIntrospectionCacheNameOwnerChanged(sdbusplus::message_t& msg)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    try
+    {
+        msg.read(name, oldOwner, newOwner);
+    }
+    catch (const sdbusplus::exception_t& /*e*/)
+    {
+        return;
+    }
+    IntrospectionCache::getInstance().onNameOwnerChanged(name, oldOwner);
+}
+
+// Has to happen before anything is introspected, so that no signal after a
+// reply is missed
+inline void registerIntrospectionCacheSignals()
+{
+    static std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches =
+        []() {
+        namespace rules = sdbusplus::bus::match::rules;
+        sdbusplus::asio::connection& bus = *crow::connections::systemBus;
+        std::vector<std::unique_ptr<sdbusplus::bus::match_t>> out;
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::interfacesAdded(),
+            onIntrospectionCacheInterfacesChanged));
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::interfacesRemoved(),
+            onIntrospectionCacheInterfacesChanged));
+        out.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus, rules::nameOwnerChanged(),
+            onIntrospectionCacheNameOwnerChanged));
+        return out;
+    }();
+}
+
+// Introspects an object, or answers from the IntrospectionCache.  The
+// introspection is null if the reply couldn't be parsed.
+inline void introspect(
+    const std::string& processName, const std::string& objectPath,
+    std::function<void(const boost::system::error_code&,
+                       const std::shared_ptr<const Introspection>&)>&&
+        callback)
+{
+    registerIntrospectionCacheSignals();
+    std::shared_ptr<const Introspection> cached =
+        IntrospectionCache::getInstance().find(processName, objectPath);
+    if (cached != nullptr)
+    {
+        dbus::utility::postCachedAnswer(
+            [callback{std::move(callback)}, cached{std::move(cached)}]() {
+            callback(boost::system::error_code(), cached);
+        });
+        return;
+    }
+    dbus::utility::asyncMethodCall(
+        [processName, objectPath, callback{std::move(callback)}](
+            const boost::system::error_code& ec, sdbusplus::message_t& msg,
+            const std::string& introspectXml) {
+        if (ec)
+        {
+            callback(ec, nullptr);
+            return;
+        }
+        BMCWEB_LOG_DEBUG("Introspected {} {}:\n{}", processName, objectPath,
+                         introspectXml);
+        std::optional<Introspection> parsed =
+            parseIntrospection(introspectXml);
+        if (!parsed)
+        {
+            BMCWEB_LOG_ERROR("XML document failed to parse {} {}", processName,
+                             objectPath);
+            callback(ec, nullptr);
+            return;
+        }
+        std::shared_ptr<const Introspection> introspection =
+            std::make_shared<const Introspection>(std::move(*parsed));
+        IntrospectionCache::getInstance().insert(processName, msg.get_sender(),
+                                                 objectPath, introspection);
+        callback(ec, introspection);
+    },
+        processName, objectPath, "org.freedesktop.DBus.Introspectable",
+        "Introspect");
+}
+
 inline void
     introspectObjects(const std::string& processName,
                       const std::string& objectPath,
@@ -128,11 +232,12 @@ inline void
         transaction->res.jsonValue["objects"] = nlohmann::json::array();
     }
 
-    crow::connections::systemBus->async_method_call(
+    introspect(
+        processName, objectPath,
         [transaction, processName{std::string(processName)},
          objectPath{std::string(objectPath)}](
             const boost::system::error_code& ec,
-            const std::string& introspectXml) {
+            const std::shared_ptr<const Introspection>& introspection) {
         if (ec)
         {
             BMCWEB_LOG_ERROR(
@@ -145,39 +250,22 @@ inline void
 
         transaction->res.jsonValue["objects"].emplace_back(std::move(object));
 
-        tinyxml2::XMLDocument doc;
-
-        doc.Parse(introspectXml.c_str());
-        tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-        if (pRoot == nullptr)
+        if (introspection == nullptr)
         {
-            BMCWEB_LOG_ERROR("XML document failed to parse {} {}", processName,
-                             objectPath);
+            return;
         }
-        else
+        for (const std::string& childPath : introspection->children)
         {
-            tinyxml2::XMLElement* node = pRoot->FirstChildElement("node");
-            while (node != nullptr)
+            std::string newpath;
+            if (objectPath != "/")
             {
-                const char* childPath = node->Attribute("name");
-                if (childPath != nullptr)
-                {
-                    std::string newpath;
-                    if (objectPath != "/")
-                    {
-                        newpath += objectPath;
-                    }
-                    newpath += std::string("/") + childPath;
-                    // introspect the subobjects as well
-                    introspectObjects(processName, newpath, transaction);
-                }
-
-                node = node->NextSiblingElement("node");
+                newpath += objectPath;
             }
+            newpath += "/" + childPath;
+            // introspect the subobjects as well
+            introspectObjects(processName, newpath, transaction);
         }
-    },
-        processName, objectPath, "org.freedesktop.DBus.Introspectable",
-        "Introspect");
+    });
 }
 
 inline void getPropertiesForEnumerate(
@@ -188,8 +276,8 @@ inline void getPropertiesForEnumerate(
     BMCWEB_LOG_DEBUG("getPropertiesForEnumerate {} {} {}", objectPath, service,
                      interface);
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objectPath, interface,
+    dbus::utility::getAllProperties(
+        service, objectPath, interface,
         [asyncResp, objectPath, service,
          interface](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& propertiesList) {
@@ -370,7 +458,7 @@ inline void findObjectManagerPathForEnumerate(
 {
     BMCWEB_LOG_DEBUG("Finding objectmanager for path {} on connection:{}",
                      objectName, connectionName);
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [transaction, objectName, connectionName](
             const boost::system::error_code& ec,
             const dbus::utility::MapperGetAncestorsResponse& objects) {
@@ -1397,11 +1485,11 @@ inline void findActionOnInterface(
     const std::string& connectionName)
 {
     BMCWEB_LOG_DEBUG("findActionOnInterface for connection {}", connectionName);
-    crow::connections::systemBus->async_method_call(
+    introspect(
+        connectionName, transaction->path,
         [transaction, connectionName{std::string(connectionName)}](
             const boost::system::error_code& ec,
-            const std::string& introspectXml) {
-        BMCWEB_LOG_DEBUG("got xml:\n {}", introspectXml);
+            const std::shared_ptr<const Introspection>& introspection) {
         if (ec)
         {
             BMCWEB_LOG_ERROR(
@@ -1409,143 +1497,101 @@ inline void findActionOnInterface(
                 ec.message(), connectionName);
             return;
         }
-        tinyxml2::XMLDocument doc;
-
-        doc.Parse(introspectXml.data(), introspectXml.size());
-        tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-        if (pRoot == nullptr)
+        if (introspection == nullptr)
         {
-            BMCWEB_LOG_ERROR("XML document failed to parse {}", connectionName);
             return;
         }
-        tinyxml2::XMLElement* interfaceNode =
-            pRoot->FirstChildElement("interface");
-        while (interfaceNode != nullptr)
+        for (const IntrospectedInterface& interface :
+             introspection->interfaces)
         {
-            const char* thisInterfaceName = interfaceNode->Attribute("name");
-            if (thisInterfaceName != nullptr)
+            if (!transaction->interfaceName.empty() &&
+                (transaction->interfaceName != interface.name))
             {
-                if (!transaction->interfaceName.empty() &&
-                    (transaction->interfaceName != thisInterfaceName))
+                continue;
+            }
+
+            for (const IntrospectedMember& method : interface.methods)
+            {
+                BMCWEB_LOG_DEBUG("Found method: {}", method.name);
+                if (method.name != transaction->methodName)
                 {
-                    interfaceNode =
-                        interfaceNode->NextSiblingElement("interface");
                     continue;
                 }
+                BMCWEB_LOG_DEBUG("Found method named {} on interface {}",
+                                 method.name, interface.name);
+                sdbusplus::message_t m =
+                    crow::connections::systemBus->new_method_call(
+                        connectionName.c_str(), transaction->path.c_str(),
+                        interface.name.c_str(),
+                        transaction->methodName.c_str());
+
+                std::string returnType;
 
-                tinyxml2::XMLElement* methodNode =
-                    interfaceNode->FirstChildElement("method");
-                while (methodNode != nullptr)
+                // Find the output type
+                for (const IntrospectedArg& arg : method.args)
                 {
-                    const char* thisMethodName = methodNode->Attribute("name");
-                    BMCWEB_LOG_DEBUG("Found method: {}", thisMethodName);
-                    if (thisMethodName != nullptr &&
-                        thisMethodName == transaction->methodName)
+                    if (arg.direction == "out" && !arg.type.empty())
                     {
-                        BMCWEB_LOG_DEBUG(
-                            "Found method named {} on interface {}",
-                            thisMethodName, thisInterfaceName);
-                        sdbusplus::message_t m =
-                            crow::connections::systemBus->new_method_call(
-                                connectionName.c_str(),
-                                transaction->path.c_str(), thisInterfaceName,
-                                transaction->methodName.c_str());
-
-                        tinyxml2::XMLElement* argumentNode =
-                            methodNode->FirstChildElement("arg");
+                        returnType = arg.type;
+                        break;
+                    }
+                }
 
-                        std::string returnType;
+                auto argIt = transaction->arguments.begin();
 
-                        // Find the output type
-                        while (argumentNode != nullptr)
-                        {
-                            const char* argDirection =
-                                argumentNode->Attribute("direction");
-                            const char* argType =
-                                argumentNode->Attribute("type");
-                            if (argDirection != nullptr && argType != nullptr &&
-                                std::string(argDirection) == "out")
-                            {
-                                returnType = argType;
-                                break;
-                            }
-                            argumentNode =
-                                argumentNode->NextSiblingElement("arg");
-                        }
+                for (const IntrospectedArg& arg : method.args)
+                {
+                    if (arg.direction != "in" || arg.type.empty())
+                    {
+                        continue;
+                    }
+                    if (argIt == transaction->arguments.end())
+                    {
+                        transaction->setErrorStatus("Invalid method args");
+                        return;
+                    }
+                    if (convertJsonToDbus(m.get(), arg.type, *argIt) < 0)
+                    {
+                        transaction->setErrorStatus("Invalid method arg type");
+                        return;
+                    }
 
-                        auto argIt = transaction->arguments.begin();
+                    argIt++;
+                }
 
-                        argumentNode = methodNode->FirstChildElement("arg");
+                crow::connections::systemBus->async_send(
+                    m, [transaction, returnType](
+                           const boost::system::error_code& ec2,
+                           sdbusplus::message_t& m2) {
+                    if (ec2)
+                    {
+                        transaction->methodFailed = true;
+                        const sd_bus_error* e = m2.get_error();
 
-                        while (argumentNode != nullptr)
+                        if (e != nullptr)
                         {
-                            const char* argDirection =
-                                argumentNode->Attribute("direction");
-                            const char* argType =
-                                argumentNode->Attribute("type");
-                            if (argDirection != nullptr && argType != nullptr &&
-                                std::string(argDirection) == "in")
-                            {
-                                if (argIt == transaction->arguments.end())
-                                {
-                                    transaction->setErrorStatus(
-                                        "Invalid method args");
-                                    return;
-                                }
-                                if (convertJsonToDbus(m.get(),
-                                                      std::string(argType),
-                                                      *argIt) < 0)
-                                {
-                                    transaction->setErrorStatus(
-                                        "Invalid method arg type");
-                                    return;
-                                }
-
-                                argIt++;
-                            }
-                            argumentNode =
-                                argumentNode->NextSiblingElement("arg");
+                            setErrorResponse(
+                                transaction->asyncResp->res,
+                                boost::beast::http::status::bad_request,
+                                e->name, e->message);
                         }
-
-                        crow::connections::systemBus->async_send(
-                            m, [transaction, returnType](
-                                   const boost::system::error_code& ec2,
-                                   sdbusplus::message_t& m2) {
-                            if (ec2)
-                            {
-                                transaction->methodFailed = true;
-                                const sd_bus_error* e = m2.get_error();
-
-                                if (e != nullptr)
-                                {
-                                    setErrorResponse(
-                                        transaction->asyncResp->res,
-                                        boost::beast::http::status::bad_request,
-                                        e->name, e->message);
-                                }
-                                else
-                                {
-                                    setErrorResponse(
-                                        transaction->asyncResp->res,
-                                        boost::beast::http::status::bad_request,
-                                        "Method call failed", methodFailedMsg);
-                                }
-                                return;
-                            }
-                            transaction->methodPassed = true;
-
-                            handleMethodResponse(transaction, m2, returnType);
-                        });
-                        break;
+                        else
+                        {
+                            setErrorResponse(
+                                transaction->asyncResp->res,
+                                boost::beast::http::status::bad_request,
+                                "Method call failed", methodFailedMsg);
+                        }
+                        return;
                     }
-                    methodNode = methodNode->NextSiblingElement("method");
-                }
+                    transaction->methodPassed = true;
+
+                    handleMethodResponse(transaction, m2, returnType);
+                });
+                break;
             }
-            interfaceNode = interfaceNode->NextSiblingElement("interface");
         }
-    },
-        connectionName, transaction->path,
-        "org.freedesktop.DBus.Introspectable", "Introspect");
+    });
 }
 
 inline void handleAction(const crow::Request& req,
@@ -1916,10 +1962,11 @@ inline void handlePut(const crow::Request& req,
         {
             const std::string& connectionName = connection.first;
 
-            crow::connections::systemBus->async_method_call(
-                [connectionName{std::string(connectionName)},
-                 transaction](const boost::system::error_code& ec3,
-                              const std::string& introspectXml) {
+            introspect(
+                connectionName, transaction->objectPath,
+                [connectionName{std::string(connectionName)}, transaction](
+                    const boost::system::error_code& ec3,
+                    const std::shared_ptr<const Introspection>& introspection) {
                 if (ec3)
                 {
                     BMCWEB_LOG_ERROR(
@@ -1928,115 +1975,92 @@ inline void handlePut(const crow::Request& req,
                     transaction->setErrorStatus("Unexpected Error");
                     return;
                 }
-                tinyxml2::XMLDocument doc;
-
-                doc.Parse(introspectXml.c_str());
-                tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-                if (pRoot == nullptr)
+                if (introspection == nullptr)
                 {
-                    BMCWEB_LOG_ERROR("XML document failed to parse: {}",
-                                     introspectXml);
                     transaction->setErrorStatus("Unexpected Error");
                     return;
                 }
-                tinyxml2::XMLElement* ifaceNode =
-                    pRoot->FirstChildElement("interface");
-                while (ifaceNode != nullptr)
+                for (const IntrospectedInterface& interface :
+                     introspection->interfaces)
                 {
-                    const char* interfaceName = ifaceNode->Attribute("name");
+                    const std::string& interfaceName = interface.name;
                     BMCWEB_LOG_DEBUG("found interface {}", interfaceName);
-                    tinyxml2::XMLElement* propNode =
-                        ifaceNode->FirstChildElement("property");
-                    while (propNode != nullptr)
+                    for (const IntrospectedProperty& property :
+                         interface.properties)
                     {
-                        const char* propertyName = propNode->Attribute("name");
-                        BMCWEB_LOG_DEBUG("Found property {}", propertyName);
-                        if (propertyName == transaction->propertyName)
+                        BMCWEB_LOG_DEBUG("Found property {}", property.name);
+                        if (property.name != transaction->propertyName ||
+                            property.type.empty())
+                        {
+                            continue;
+                        }
+                        const char* argType = property.type.c_str();
+                        sdbusplus::message_t m =
+                            crow::connections::systemBus->new_method_call(
+                                connectionName.c_str(),
+                                transaction->objectPath.c_str(),
+                                "org.freedesktop.DBus.Properties", "Set");
+                        m.append(interfaceName, transaction->propertyName);
+                        int r = sd_bus_message_open_container(
+                            m.get(), SD_BUS_TYPE_VARIANT, argType);
+                        if (r < 0)
                         {
-                            const char* argType = propNode->Attribute("type");
-                            if (argType != nullptr)
+                            transaction->setErrorStatus("Unexpected Error");
+                            return;
+                        }
+                        r = convertJsonToDbus(m.get(), argType,
+                                              transaction->propertyValue);
+                        if (r < 0)
+                        {
+                            if (r == -ERANGE)
                             {
-                                sdbusplus::message_t m =
-                                    crow::connections::systemBus
-                                        ->new_method_call(
-                                            connectionName.c_str(),
-                                            transaction->objectPath.c_str(),
-                                            "org.freedesktop.DBus."
-                                            "Properties",
-                                            "Set");
-                                m.append(interfaceName,
-                                         transaction->propertyName);
-                                int r = sd_bus_message_open_container(
-                                    m.get(), SD_BUS_TYPE_VARIANT, argType);
-                                if (r < 0)
-                                {
-                                    transaction->setErrorStatus(
-                                        "Unexpected Error");
-                                    return;
-                                }
-                                r = convertJsonToDbus(
-                                    m.get(), argType,
-                                    transaction->propertyValue);
-                                if (r < 0)
-                                {
-                                    if (r == -ERANGE)
-                                    {
-                                        transaction->setErrorStatus(
-                                            "Provided property value "
-                                            "is out of range for the "
-                                            "property type");
-                                    }
-                                    else
-                                    {
-                                        transaction->setErrorStatus(
-                                            "Invalid arg type");
-                                    }
-                                    return;
-                                }
-                                r = sd_bus_message_close_container(m.get());
-                                if (r < 0)
-                                {
-                                    transaction->setErrorStatus(
-                                        "Unexpected Error");
-                                    return;
-                                }
-                                crow::connections::systemBus->async_send(
-                                    m, [transaction](
-                                           const boost::system::error_code& ec,
-                                           sdbusplus::message_t& m2) {
-                                    BMCWEB_LOG_DEBUG("sent");
-                                    if (ec)
-                                    {
-                                        const sd_bus_error* e = m2.get_error();
-                                        setErrorResponse(
-                                            transaction->asyncResp->res,
-                                            boost::beast::http::status::
-                                                forbidden,
-                                            (e) != nullptr
-                                                ? e->name
-                                                : ec.category().name(),
-                                            (e) != nullptr ? e->message
-                                                           : ec.message());
-                                    }
-                                    else
-                                    {
-                                        transaction->asyncResp->res
-                                            .jsonValue["status"] = "ok";
-                                        transaction->asyncResp->res
-                                            .jsonValue["message"] = "200 OK";
-                                        transaction->asyncResp->res
-                                            .jsonValue["data"] = nullptr;
-                                    }
-                                });
+                                transaction->setErrorStatus(
+                                    "Provided property value "
+                                    "is out of range for the "
+                                    "property type");
                             }
+                            else
+                            {
+                                transaction->setErrorStatus(
+                                    "Invalid arg type");
+                            }
+                            return;
+                        }
+                        r = sd_bus_message_close_container(m.get());
+                        if (r < 0)
+                        {
+                            transaction->setErrorStatus("Unexpected Error");
+                            return;
                         }
-                        propNode = propNode->NextSiblingElement("property");
+                        crow::connections::systemBus->async_send(
+                            m, [transaction](
+                                   const boost::system::error_code& ec,
+                                   sdbusplus::message_t& m2) {
+                            BMCWEB_LOG_DEBUG("sent");
+                            if (ec)
+                            {
+                                const sd_bus_error* e = m2.get_error();
+                                setErrorResponse(
+                                    transaction->asyncResp->res,
+                                    boost::beast::http::status::forbidden,
+                                    (e) != nullptr ? e->name
+                                                   : ec.category().name(),
+                                    (e) != nullptr ? e->message
+                                                   : ec.message());
+                            }
+                            else
+                            {
+                                transaction->asyncResp->res
+                                    .jsonValue["status"] = "ok";
+                                transaction->asyncResp->res
+                                    .jsonValue["message"] = "200 OK";
+                                transaction->asyncResp->res
+                                    .jsonValue["data"] = nullptr;
+                            }
+                        });
                     }
-                    ifaceNode = ifaceNode->NextSiblingElement("interface");
                 }
-            },
-                connectionName, transaction->objectPath,
-                "org.freedesktop.DBus.Introspectable", "Introspect");
+            });
         }
     });
 }
@@ -2172,10 +2196,11 @@ inline void
     }
     if (interfaceName.empty())
     {
-        crow::connections::systemBus->async_method_call(
-            [asyncResp, processName,
-             objectPath](const boost::system::error_code& ec,
-                         const std::string& introspectXml) {
+        introspect(
+            processName, objectPath,
+            [asyncResp, processName, objectPath](
+                const boost::system::error_code& ec,
+                const std::shared_ptr<const Introspection>& introspection) {
             if (ec)
             {
                 BMCWEB_LOG_ERROR(
@@ -2183,21 +2208,14 @@ inline void
                     ec.message(), processName, objectPath);
                 return;
             }
-            tinyxml2::XMLDocument doc;
-
-            doc.Parse(introspectXml.c_str());
-            tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-            if (pRoot == nullptr)
+            if (introspection == nullptr)
             {
-                BMCWEB_LOG_ERROR("XML document failed to parse {} {}",
-                                 processName, objectPath);
                 asyncResp->res.jsonValue["status"] = "XML parse error";
                 asyncResp->res.result(
                     boost::beast::http::status::internal_server_error);
                 return;
             }
 
-            BMCWEB_LOG_DEBUG("{}", introspectXml);
             asyncResp->res.jsonValue["status"] = "ok";
             asyncResp->res.jsonValue["bus_name"] = processName;
             asyncResp->res.jsonValue["object_path"] = objectPath;
@@ -2205,31 +2223,22 @@ inline void
             nlohmann::json& interfacesArray =
                 asyncResp->res.jsonValue["interfaces"];
             interfacesArray = nlohmann::json::array();
-            tinyxml2::XMLElement* interface =
-                pRoot->FirstChildElement("interface");
-
-            while (interface != nullptr)
+            for (const IntrospectedInterface& interface :
+                 introspection->interfaces)
             {
-                const char* ifaceName = interface->Attribute("name");
-                if (ifaceName != nullptr)
-                {
-                    nlohmann::json::object_t interfaceObj;
-                    interfaceObj["name"] = ifaceName;
-                    interfacesArray.emplace_back(std::move(interfaceObj));
-                }
-
-                interface = interface->NextSiblingElement("interface");
+                nlohmann::json::object_t interfaceObj;
+                interfaceObj["name"] = interface.name;
+                interfacesArray.emplace_back(std::move(interfaceObj));
             }
-        },
-            processName, objectPath, "org.freedesktop.DBus.Introspectable",
-            "Introspect");
+        });
     }
     else if (methodName.empty())
     {
-        crow::connections::systemBus->async_method_call(
-            [asyncResp, processName, objectPath,
-             interfaceName](const boost::system::error_code& ec,
-                            const std::string& introspectXml) {
+        introspect(
+            processName, objectPath,
+            [asyncResp, processName, objectPath, interfaceName](
+                const boost::system::error_code& ec,
+                const std::shared_ptr<const Introspection>& introspection) {
             if (ec)
             {
                 BMCWEB_LOG_ERROR(
@@ -2237,14 +2246,8 @@ inline void
                     ec.message(), processName, objectPath);
                 return;
             }
-            tinyxml2::XMLDocument doc;
-
-            doc.Parse(introspectXml.data(), introspectXml.size());
-            tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-            if (pRoot == nullptr)
+            if (introspection == nullptr)
             {
-                BMCWEB_LOG_ERROR("XML document failed to parse {} {}",
-                                 processName, objectPath);
                 asyncResp->res.result(
                     boost::beast::http::status::internal_server_error);
                 return;
@@ -2265,21 +2268,8 @@ inline void
                 asyncResp->res.jsonValue["properties"];
             propertiesObj = nlohmann::json::object();
 
-            // if we know we're the only call, build the
-            // json directly
-            tinyxml2::XMLElement* interface =
-                pRoot->FirstChildElement("interface");
-            while (interface != nullptr)
-            {
-                const char* ifaceName = interface->Attribute("name");
-
-                if (ifaceName != nullptr && ifaceName == interfaceName)
-                {
-                    break;
-                }
-
-                interface = interface->NextSiblingElement("interface");
-            }
+            const IntrospectedInterface* interface =
+                introspection->findInterface(interfaceName);
             if (interface == nullptr)
             {
                 // if we got to the end of the list and
@@ -2288,121 +2278,97 @@ inline void
                 return;
             }
 
-            tinyxml2::XMLElement* methods =
-                interface->FirstChildElement("method");
-            while (methods != nullptr)
+            for (const IntrospectedMember& method : interface->methods)
             {
                 nlohmann::json argsArray = nlohmann::json::array();
-                tinyxml2::XMLElement* arg = methods->FirstChildElement("arg");
-                while (arg != nullptr)
+                for (const IntrospectedArg& arg : method.args)
                 {
                     nlohmann::json thisArg;
-                    for (const char* fieldName : std::array<const char*, 3>{
-                             "name", "direction", "type"})
+                    if (!arg.name.empty())
                     {
-                        const char* fieldValue = arg->Attribute(fieldName);
-                        if (fieldValue != nullptr)
-                        {
-                            thisArg[fieldName] = fieldValue;
-                        }
+                        thisArg["name"] = arg.name;
+                    }
+                    if (!arg.direction.empty())
+                    {
+                        thisArg["direction"] = arg.direction;
+                    }
+                    if (!arg.type.empty())
+                    {
+                        thisArg["type"] = arg.type;
                     }
                     argsArray.emplace_back(std::move(thisArg));
-                    arg = arg->NextSiblingElement("arg");
                 }
 
-                const char* name = methods->Attribute("name");
-                if (name != nullptr)
-                {
-                    std::string uri;
-                    uri.reserve(14 + processName.size() + objectPath.size() +
-                                interfaceName.size() + strlen(name));
-                    uri += "/bus/system/";
-                    uri += processName;
-                    uri += objectPath;
-                    uri += "/";
-                    uri += interfaceName;
-                    uri += "/";
-                    uri += name;
+                std::string uri;
+                uri.reserve(14 + processName.size() + objectPath.size() +
+                            interfaceName.size() + method.name.size());
+                uri += "/bus/system/";
+                uri += processName;
+                uri += objectPath;
+                uri += "/";
+                uri += interfaceName;
+                uri += "/";
+                uri += method.name;
 
-                    nlohmann::json::object_t object;
-                    object["name"] = name;
-                    object["uri"] = std::move(uri);
-                    object["args"] = argsArray;
+                nlohmann::json::object_t object;
+                object["name"] = method.name;
+                object["uri"] = std::move(uri);
+                object["args"] = argsArray;
 
-                    methodsArray.emplace_back(std::move(object));
-                }
-                methods = methods->NextSiblingElement("method");
+                methodsArray.emplace_back(std::move(object));
             }
-            tinyxml2::XMLElement* signals =
-                interface->FirstChildElement("signal");
-            while (signals != nullptr)
+            for (const IntrospectedMember& signal : interface->signals)
             {
                 nlohmann::json argsArray = nlohmann::json::array();
 
-                tinyxml2::XMLElement* arg = signals->FirstChildElement("arg");
-                while (arg != nullptr)
+                for (const IntrospectedArg& arg : signal.args)
                 {
-                    const char* name = arg->Attribute("name");
-                    const char* type = arg->Attribute("type");
-                    if (name != nullptr && type != nullptr)
+                    if (!arg.name.empty() && !arg.type.empty())
                     {
                         nlohmann::json::object_t params;
-                        params["name"] = name;
-                        params["type"] = type;
+                        params["name"] = arg.name;
+                        params["type"] = arg.type;
                         argsArray.push_back(std::move(params));
                     }
-                    arg = arg->NextSiblingElement("arg");
                 }
-                const char* name = signals->Attribute("name");
-                if (name != nullptr)
-                {
-                    nlohmann::json::object_t object;
-                    object["name"] = name;
-                    object["args"] = argsArray;
-                    signalsArray.emplace_back(std::move(object));
-                }
-
-                signals = signals->NextSiblingElement("signal");
+                nlohmann::json::object_t object;
+                object["name"] = signal.name;
+                object["args"] = argsArray;
+                signalsArray.emplace_back(std::move(object));
             }
 
-            tinyxml2::XMLElement* property =
-                interface->FirstChildElement("property");
-            while (property != nullptr)
+            for (const IntrospectedProperty& property : interface->properties)
             {
-                const char* name = property->Attribute("name");
-                const char* type = property->Attribute("type");
-                if (type != nullptr && name != nullptr)
+                if (property.type.empty())
                 {
-                    sdbusplus::message_t m =
-                        crow::connections::systemBus->new_method_call(
-                            processName.c_str(), objectPath.c_str(),
-                            "org.freedesktop."
-                            "DBus."
-                            "Properties",
-                            "Get");
-                    m.append(interfaceName, name);
-                    nlohmann::json& propertyItem = propertiesObj[name];
-                    crow::connections::systemBus->async_send(
-                        m, [&propertyItem,
-                            asyncResp](const boost::system::error_code& ec2,
-                                       sdbusplus::message_t& msg) {
-                        if (ec2)
-                        {
-                            return;
-                        }
-
-                        int r = convertDBusToJSON("v", msg, propertyItem);
-                        if (r < 0)
-                        {
-                            BMCWEB_LOG_ERROR("Couldn't convert vector to json");
-                        }
-                    });
+                    continue;
                 }
-                property = property->NextSiblingElement("property");
+                sdbusplus::message_t m =
+                    crow::connections::systemBus->new_method_call(
+                        processName.c_str(), objectPath.c_str(),
+                        "org.freedesktop."
+                        "DBus."
+                        "Properties",
+                        "Get");
+                m.append(interfaceName, property.name);
+                nlohmann::json& propertyItem = propertiesObj[property.name];
+                crow::connections::systemBus->async_send(
+                    m, [&propertyItem,
+                        asyncResp](const boost::system::error_code& ec2,
+                                   sdbusplus::message_t& msg) {
+                    if (ec2)
+                    {
+                        return;
+                    }
+
+                    int r = convertDBusToJSON("v", msg, propertyItem);
+                    if (r < 0)
+                    {
+                        BMCWEB_LOG_ERROR("Couldn't convert vector to json");
+                    }
+                });
             }
-        },
-            processName, objectPath, "org.freedesktop.DBus.Introspectable",
-            "Introspect");
+        });
     }
     else
     {
@@ -2484,7 +2450,7 @@ inline void requestRoutes(App& app)
                 }
             }
         };
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             std::move(myCallback), "org.freedesktop.DBus", "/",
             "org.freedesktop.DBus", "ListNames");
     });
@@ -0,0 +1,441 @@
+#pragma once
+
+#include "logging.hpp"
+#include "service_owner_map.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace dbus
+{
+namespace utility
+{
+
+// Interfaces whose properties are kept, from whichever service hosts them.
+// These should hold data that rarely changes, and that the service signals
+// with PropertiesChanged when it does.
+constexpr std::array<std::string_view, 11> propertyStoreInterfaces{
+    "xyz.openbmc_project.Common.UUID",
+    "xyz.openbmc_project.Inventory.Decorator.Asset",
+    "xyz.openbmc_project.Inventory.Decorator.Revision",
+    "xyz.openbmc_project.Inventory.Item.Cpu",
+    "xyz.openbmc_project.Inventory.Item.Dimm",
+    "xyz.openbmc_project.Inventory.Item.Drive",
+    "xyz.openbmc_project.Inventory.Item.PCIeDevice",
+    "xyz.openbmc_project.Inventory.Item.PCIeSlot",
+    "xyz.openbmc_project.Network.EthernetInterface",
+    "xyz.openbmc_project.Network.IP",
+    "xyz.openbmc_project.Software.Version",
+};
+
+// Services whose GetManagedObjects replies, and every property they host,
+// are kept
+constexpr std::array<std::string_view, 2> propertyStoreServices{
+    "xyz.openbmc_project.EntityManager",
+    "xyz.openbmc_project.Network",
+};
+
+// A copy of the properties of selected interfaces and services, kept up to
+// date from PropertiesChanged, InterfacesAdded and InterfacesRemoved rather
+// than read again on every request.  See ServiceOwnerMap for how replies and
+// signals are tied together.
+//
+// Templated on the reply types, which live in dbus_utility.hpp.  Only used
+// from the io_context thread.
+template <typename PropertiesMap, typename ManagedObjects>
+class BasicPropertyStore
+{
+  public:
+    using ObjectPath = typename ManagedObjects::value_type::first_type;
+    using InterfacesMap = typename ManagedObjects::value_type::second_type;
+
+    BasicPropertyStore() = default;
+    ~BasicPropertyStore() = default;
+    BasicPropertyStore(const BasicPropertyStore&) = delete;
+    BasicPropertyStore& operator=(const BasicPropertyStore&) = delete;
+    BasicPropertyStore(BasicPropertyStore&&) = delete;
+    BasicPropertyStore& operator=(BasicPropertyStore&&) = delete;
+
+    static BasicPropertyStore& getInstance()
+    {
+        static BasicPropertyStore store;
+        return store;
+    }
+
+    static bool isStoredService(std::string_view service)
+    {
+        return std::ranges::find(propertyStoreServices, service) !=
+               propertyStoreServices.end();
+    }
+
+    // Whether a GetAll reply for this is kept.  An empty interface asks for
+    // all of them, which can't be answered from what's kept.
+    static bool isStored(std::string_view service, std::string_view interface)
+    {
+        if (interface.empty())
+        {
+            return false;
+        }
+        return isStoredService(service) ||
+               std::ranges::find(propertyStoreInterfaces, interface) !=
+                   propertyStoreInterfaces.end();
+    }
+
+    std::optional<PropertiesMap> findProperties(std::string_view service,
+                                                std::string_view path,
+                                                std::string_view interface)
+    {
+        Service* entry = services.find(service);
+        if (entry != nullptr)
+        {
+            auto object = entry->objects.find(path);
+            if (object != entry->objects.end())
+            {
+                auto snapshot = object->second.find(interface);
+                if (snapshot != object->second.end() &&
+                    isFresh(snapshot->second.added))
+                {
+                    hits++;
+                    return snapshot->second.properties;
+                }
+            }
+        }
+        misses++;
+        return std::nullopt;
+    }
+
+    std::optional<ManagedObjects> findManagedObjects(std::string_view service,
+                                                     std::string_view path)
+    {
+        Service* entry = services.find(service);
+        if (entry == nullptr)
+        {
+            misses++;
+            return std::nullopt;
+        }
+        auto managed = entry->managed.find(path);
+        if (managed == entry->managed.end() || !isFresh(managed->second.added))
+        {
+            misses++;
+            return std::nullopt;
+        }
+        ManagedObjects reply;
+        reply.reserve(managed->second.members.size());
+        for (const std::string& member : managed->second.members)
+        {
+            auto object = entry->objects.find(member);
+            if (object == entry->objects.end())
+            {
+                continue;
+            }
+            InterfacesMap& interfaces =
+                reply.emplace_back(ObjectPath(member), InterfacesMap{}).second;
+            for (const auto& [interface, snapshot] : object->second)
+            {
+                interfaces.emplace_back(interface, snapshot.properties);
+            }
+        }
+        hits++;
+        return reply;
+    }
+
+    void insertProperties(std::string_view service, std::string_view owner,
+                          std::string_view path, std::string_view interface,
+                          const PropertiesMap& properties)
+    {
+        Service& entry = serviceFor(service, owner);
+        entry.objects[std::string(path)].insert_or_assign(
+            std::string(interface), Snapshot{properties, now()});
+    }
+
+    void insertManagedObjects(std::string_view service, std::string_view owner,
+                              std::string_view path,
+                              const ManagedObjects& objects)
+    {
+        Service& entry = serviceFor(service, owner);
+        std::chrono::steady_clock::time_point added = now();
+        Managed managed;
+        managed.added = added;
+        for (const auto& [objectPath, interfaces] : objects)
+        {
+            const std::string& member = objectPath.str;
+            Interfaces& stored = entry.objects[member];
+            stored.clear();
+            for (const auto& [interface, properties] : interfaces)
+            {
+                stored.insert_or_assign(interface,
+                                        Snapshot{properties, added});
+            }
+            managed.members.insert(member);
+        }
+        entry.managed.insert_or_assign(std::string(path), std::move(managed));
+    }
+
+    void onPropertiesChanged(std::string_view sender, std::string_view path,
+                             std::string_view interface,
+                             const PropertiesMap& changed,
+                             std::span<const std::string> invalidated)
+    {
+        services.forEachOwnedBy(sender, [path, interface, &changed,
+                                         invalidated](std::string_view,
+                                                      Service& entry) {
+            Snapshot* snapshot = findSnapshot(entry, path, interface);
+            if (snapshot == nullptr)
+            {
+                // Something under a kept GetManagedObjects reply that it
+                // didn't include
+                dropManaged(entry, path);
+                return;
+            }
+            if (!invalidated.empty())
+            {
+                // The new values weren't sent
+                removeInterface(entry, path, interface);
+                return;
+            }
+            for (const auto& [property, value] : changed)
+            {
+                auto it = std::ranges::find_if(
+                    snapshot->properties, [&property](const auto& item) {
+                    return item.first == property;
+                });
+                if (it == snapshot->properties.end())
+                {
+                    snapshot->properties.emplace_back(property, value);
+                    continue;
+                }
+                it->second = value;
+            }
+        });
+    }
+
+    void onInterfacesAdded(std::string_view sender, std::string_view path,
+                           const InterfacesMap& interfaces)
+    {
+        std::chrono::steady_clock::time_point added = now();
+        services.forEachOwnedBy(sender, [path, &interfaces, added](
+                                            std::string_view name,
+                                            Service& entry) {
+            bool member = false;
+            for (auto it = entry.managed.begin(); it != entry.managed.end();)
+            {
+                if (path == it->first)
+                {
+                    // Whether the root itself is in the reply isn't clear
+                    it = entry.managed.erase(it);
+                    continue;
+                }
+                if (isBelow(it->first, path))
+                {
+                    it->second.members.emplace(path);
+                    member = true;
+                }
+                it++;
+            }
+            for (const auto& [interface, properties] : interfaces)
+            {
+                if (member || isStored(name, interface))
+                {
+                    entry.objects[std::string(path)].insert_or_assign(
+                        interface, Snapshot{properties, added});
+                }
+            }
+        });
+    }
+
+    void onInterfacesRemoved(std::string_view sender, std::string_view path,
+                             std::span<const std::string> interfaces)
+    {
+        services.forEachOwnedBy(sender,
+                                [path, interfaces](std::string_view,
+                                                   Service& entry) {
+            for (const std::string& interface : interfaces)
+            {
+                removeInterface(entry, path, interface);
+            }
+        });
+    }
+
+    void onNameOwnerChanged(std::string_view name, std::string_view oldOwner)
+    {
+        services.onNameOwnerChanged(name, oldOwner);
+    }
+
+    void dropOwner(std::string_view owner)
+    {
+        services.dropOwner(owner);
+    }
+
+    size_t size() const
+    {
+        size_t count = 0;
+        services.forEach([&count](const Service& entry) {
+            for (const auto& [path, interfaces] : entry.objects)
+            {
+                count += interfaces.size();
+            }
+        });
+        return count;
+    }
+
+    uint64_t getHits() const
+    {
+        return hits;
+    }
+
+    uint64_t getMisses() const
+    {
+        return misses;
+    }
+
+  private:
+    struct Snapshot
+    {
+        PropertiesMap properties;
+        std::chrono::steady_clock::time_point added;
+    };
+
+    // Interface name to its properties
+    using Interfaces = std::map<std::string, Snapshot, std::less<>>;
+
+    // A GetManagedObjects reply, as the objects it listed
+    struct Managed
+    {
+        std::set<std::string, std::less<>> members;
+        std::chrono::steady_clock::time_point added;
+    };
+
+    // What's kept for one service
+    struct Service
+    {
+        std::map<std::string, Interfaces, std::less<>> objects;
+        // Keyed by the path GetManagedObjects was called on
+        std::map<std::string, Managed, std::less<>> managed;
+    };
+
+    static std::chrono::steady_clock::time_point now()
+    {
+        return ServiceOwnerMap<Service>::now();
+    }
+
+    static bool isFresh(std::chrono::steady_clock::time_point added)
+    {
+        return ServiceOwnerMap<Service>::isFresh(added);
+    }
+
+    static bool isBelow(std::string_view root, std::string_view path)
+    {
+        if (root == "/")
+        {
+            return path != "/";
+        }
+        return path.starts_with(root) && path.size() > root.size() &&
+               path[root.size()] == '/';
+    }
+
+    // The entry for a service, with anything too old to be used again
+    // thrown away first
+    Service& serviceFor(std::string_view service, std::string_view owner)
+    {
+        if (services.pruneDue())
+        {
+            services.prune(pruneService);
+        }
+        return services.forOwner(service, owner);
+    }
+
+    // Returns true if nothing is left
+    static bool pruneService(Service& entry)
+    {
+        std::erase_if(entry.managed, [](const auto& item) {
+            return !isFresh(item.second.added);
+        });
+        for (auto& [path, interfaces] : entry.objects)
+        {
+            std::erase_if(interfaces, [](const auto& item) {
+                return !isFresh(item.second.added);
+            });
+        }
+        std::erase_if(entry.objects, [&entry](const auto& item) {
+            return item.second.empty() && !isMember(entry, item.first);
+        });
+        return entry.objects.empty() && entry.managed.empty();
+    }
+
+    static bool isMember(const Service& entry, std::string_view path)
+    {
+        return std::ranges::any_of(entry.managed, [path](const auto& item) {
+            return item.second.members.contains(path);
+        });
+    }
+
+    static Snapshot* findSnapshot(Service& entry, std::string_view path,
+                                  std::string_view interface)
+    {
+        auto object = entry.objects.find(path);
+        if (object == entry.objects.end())
+        {
+            return nullptr;
+        }
+        auto snapshot = object->second.find(interface);
+        if (snapshot == object->second.end())
+        {
+            return nullptr;
+        }
+        return &snapshot->second;
+    }
+
+    // Drops any GetManagedObjects reply that covers path
+    static void dropManaged(Service& entry, std::string_view path)
+    {
+        std::erase_if(entry.managed, [path](const auto& item) {
+            return item.first == path || isBelow(item.first, path);
+        });
+    }
+
+    static void removeInterface(Service& entry, std::string_view path,
+                                std::string_view interface)
+    {
+        auto object = entry.objects.find(path);
+        if (object == entry.objects.end())
+        {
+            return;
+        }
+        auto snapshot = object->second.find(interface);
+        if (snapshot != object->second.end())
+        {
+            object->second.erase(snapshot);
+        }
+        if (!object->second.empty())
+        {
+            return;
+        }
+        entry.objects.erase(object);
+        for (auto& [root, managed] : entry.managed)
+        {
+            auto member = managed.members.find(path);
+            if (member != managed.members.end())
+            {
+                managed.members.erase(member);
+            }
+        }
+    }
+
+    ServiceOwnerMap<Service> services;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace utility
+} // namespace dbus
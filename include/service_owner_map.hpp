@@ -0,0 +1,196 @@
+#pragma once
+
+#include "logging.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace dbus
+{
+namespace utility
+{
+
+// What a cache of D-Bus replies keeps for each service, along with the unique
+// name that answered for it.  The caches built on this are kept up to date
+// from signals.
+//
+// Signals and method replies from one connection arrive in the order they
+// were sent, so as long as a cache's matches exist before its first call, a
+// reply and the signals around it can be applied in the order they're
+// received.  A service's entry is emptied when someone else answers for it,
+// and dropped when the name changes hands or its owner goes away.  Changes
+// made without a signal are the risk, so callers don't use anything older
+// than maxAge, and prune it.
+//
+// Keyed by the name the caller asked for, which can be a unique name.  Only
+// used from the io_context thread.
+template <typename Entry>
+class ServiceOwnerMap
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::seconds maxAge{60};
+
+    ServiceOwnerMap() = default;
+
+    // onDropIn is called with every entry that's about to be dropped or
+    // emptied, for callers that keep count of what's in them
+    explicit ServiceOwnerMap(std::function<void(const Entry&)>&& onDropIn) :
+        onDrop(std::move(onDropIn))
+    {}
+
+    static Clock::time_point now()
+    {
+        return Clock::now();
+    }
+
+    static bool isFresh(Clock::time_point added)
+    {
+        return now() - added < maxAge;
+    }
+
+    Entry* find(std::string_view service)
+    {
+        auto it = services.find(service);
+        if (it == services.end())
+        {
+            return nullptr;
+        }
+        return &it->second.entry;
+    }
+
+    // The entry for a service, emptied if someone else answered for it last
+    // time
+    Entry& forOwner(std::string_view service, std::string_view owner)
+    {
+        auto it = services.find(service);
+        if (it == services.end())
+        {
+            it = services
+                     .emplace(std::string(service),
+                              Service{std::string(owner), Entry()})
+                     .first;
+        }
+        else if (it->second.owner != owner)
+        {
+            drop(it->second.entry);
+            it->second = Service{std::string(owner), Entry()};
+        }
+        return it->second.entry;
+    }
+
+    // Calls handler(service, entry) for every service that owner answered
+    // for
+    template <typename Handler>
+    void forEachOwnedBy(std::string_view owner, Handler&& handler)
+    {
+        for (auto& [name, service] : services)
+        {
+            if (service.owner == owner)
+            {
+                handler(name, service.entry);
+            }
+        }
+    }
+
+    template <typename Handler>
+    void forEach(Handler&& handler) const
+    {
+        for (const auto& [name, service] : services)
+        {
+            handler(service.entry);
+        }
+    }
+
+    // Whether it's been more than maxAge since the last prune()
+    bool pruneDue() const
+    {
+        return now() - lastPrune > maxAge;
+    }
+
+    // Calls pruneEntry(entry) on every entry, which throws out anything that
+    // isn't fresh, and returns true if nothing is left
+    template <typename PruneEntry>
+    void prune(PruneEntry&& pruneEntry)
+    {
+        lastPrune = now();
+        for (auto it = services.begin(); it != services.end();)
+        {
+            if (!pruneEntry(it->second.entry))
+            {
+                it++;
+                continue;
+            }
+            drop(it->second.entry);
+            it = services.erase(it);
+        }
+    }
+
+    // A name changed hands.  Anything kept under the name, or for the old
+    // owner, is no longer right.
+    void onNameOwnerChanged(std::string_view name, std::string_view oldOwner)
+    {
+        auto it = services.find(name);
+        if (it != services.end())
+        {
+            drop(it->second.entry);
+            services.erase(it);
+        }
+        if (!oldOwner.empty())
+        {
+            dropOwner(oldOwner);
+        }
+    }
+
+    // Forgets everything a connection answered, for when a signal from it
+    // couldn't be read
+    void dropOwner(std::string_view owner)
+    {
+        size_t dropped = 0;
+        for (auto it = services.begin(); it != services.end();)
+        {
+            if (it->second.owner != owner)
+            {
+                it++;
+                continue;
+            }
+            drop(it->second.entry);
+            it = services.erase(it);
+            dropped++;
+        }
+        if (dropped != 0)
+        {
+            BMCWEB_LOG_DEBUG("Dropped cached replies for {} services of {}",
+                             dropped, owner);
+        }
+    }
+
+  private:
+    struct Service
+    {
+        // The unique name that answered for this service
+        std::string owner;
+        Entry entry;
+    };
+
+    void drop(const Entry& entry)
+    {
+        if (onDrop)
+        {
+            onDrop(entry);
+        }
+    }
+
+    std::map<std::string, Service, std::less<>> services;
+    Clock::time_point lastPrune;
+    std::function<void(const Entry&)> onDrop;
+};
+
+} // namespace utility
+} // namespace dbus
@@ -4,6 +4,7 @@
 
 #include "logging.hpp"
 #include "ossl_random.hpp"
+#include "tls_session_resumption.hpp"
 
 #include <boost/beast/core/file_posix.hpp>
 
@@ -611,6 +612,8 @@ inline std::shared_ptr<boost::asio::ssl::context> getSslServerContext()
 
     SSL_CTX_set_options(sslCtx.native_handle(), SSL_OP_NO_RENEGOTIATION);
 
+    setupSessionResumption(sslCtx.native_handle());
+
     if constexpr (BMCWEB_EXPERIMENTAL_HTTP2)
     {
         SSL_CTX_set_next_protos_advertised_cb(sslCtx.native_handle(),
@@ -0,0 +1,348 @@
+#pragma once
+
+#include "http_request.hpp"
+#include "http_response.hpp"
+#include "http_utility.hpp"
+#include "logging.hpp"
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/container/flat_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace crow
+{
+namespace webassets
+{
+
+// Ordered by preference, when a client accepts more than one equally
+enum class AssetEncoding
+{
+    Brotli,
+    Gzip,
+    Identity,
+};
+
+struct AssetVariant
+{
+    std::filesystem::path path;
+    size_t size = 0;
+    std::string etag;
+    // The contents of the file, if it fit in the cache
+    std::shared_ptr<const std::string> data;
+};
+
+// A file served from the static hosting directory, along with the
+// precompressed copies of it that sit next to it on disk
+struct StaticAsset
+{
+    const char* contentType = nullptr;
+    // The webpack content hash from the file name, if it has one
+    std::string hash;
+    // Paths with a content hash can be cached by the client forever
+    bool immutable = false;
+    std::array<std::optional<AssetVariant>, 3> variants;
+
+    const std::optional<AssetVariant>& variant(AssetEncoding encoding) const
+    {
+        return variants[static_cast<size_t>(encoding)];
+    }
+
+    size_t variantCount() const
+    {
+        return static_cast<size_t>(std::ranges::count_if(
+            variants, [](const std::optional<AssetVariant>& variant) {
+            return variant.has_value();
+        }));
+    }
+};
+
+inline const char* encodingName(AssetEncoding encoding)
+{
+    switch (encoding)
+    {
+        case AssetEncoding::Brotli:
+            return "br";
+        case AssetEncoding::Gzip:
+            return "gzip";
+        case AssetEncoding::Identity:
+            break;
+    }
+    return "identity";
+}
+
+// Picks the copy of an asset to send.  Compressed copies are preferred
+// whenever the client accepts them.  If it accepts none of the copies there
+// are, one is sent anyway; WebUI assets are often only installed compressed.
+inline AssetEncoding selectEncoding(const StaticAsset& asset,
+                                    std::string_view acceptEncoding)
+{
+    std::optional<AssetEncoding> best;
+    double bestQ = 0.0;
+    for (AssetEncoding encoding : {AssetEncoding::Brotli, AssetEncoding::Gzip})
+    {
+        if (!asset.variant(encoding))
+        {
+            continue;
+        }
+        double qValue = http_helpers::getEncodingQuality(acceptEncoding,
+                                                         encodingName(encoding));
+        if (qValue > bestQ)
+        {
+            best = encoding;
+            bestQ = qValue;
+        }
+    }
+    if (best)
+    {
+        return *best;
+    }
+    if (asset.variant(AssetEncoding::Identity))
+    {
+        return AssetEncoding::Identity;
+    }
+    if (asset.variant(AssetEncoding::Gzip))
+    {
+        return AssetEncoding::Gzip;
+    }
+    return AssetEncoding::Brotli;
+}
+
+// True if an If-None-Match header lists the entity tag.  Uses the weak
+// comparison that RFC 9110 requires for If-None-Match.
+inline bool etagMatches(std::string_view ifNoneMatch, std::string_view etag)
+{
+    while (!ifNoneMatch.empty())
+    {
+        std::string_view tag = ifNoneMatch.substr(0, ifNoneMatch.find(','));
+        ifNoneMatch.remove_prefix(
+            std::min(tag.size() + 1, ifNoneMatch.size()));
+        while (tag.starts_with(' '))
+        {
+            tag.remove_prefix(1);
+        }
+        while (tag.ends_with(' '))
+        {
+            tag.remove_suffix(1);
+        }
+        if (tag.starts_with("W/"))
+        {
+            tag.remove_prefix(2);
+        }
+        if (tag == "*" || tag == etag)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fills in the response for an asset.  Conditional requests, and assets held
+// in memory, are answered without touching the filesystem.
+inline void handleAssetRequest(const StaticAsset& asset, const Request& req,
+                               Response& res)
+{
+    AssetEncoding encoding = selectEncoding(
+        asset,
+        req.getHeaderValue(boost::beast::http::field::accept_encoding));
+    const std::optional<AssetVariant>& variant = asset.variant(encoding);
+    if (!variant)
+    {
+        res.result(boost::beast::http::status::not_found);
+        return;
+    }
+
+    if (asset.contentType != nullptr)
+    {
+        res.addHeader(boost::beast::http::field::content_type,
+                      asset.contentType);
+    }
+    if (encoding != AssetEncoding::Identity)
+    {
+        res.addHeader(boost::beast::http::field::content_encoding,
+                      encodingName(encoding));
+    }
+    if (asset.variantCount() > 1)
+    {
+        res.addHeader(boost::beast::http::field::vary, "Accept-Encoding");
+    }
+    res.addHeader(boost::beast::http::field::etag, variant->etag);
+    if (asset.immutable)
+    {
+        res.addHeader(boost::beast::http::field::cache_control,
+                      "max-age=31556926, immutable");
+    }
+
+    if (etagMatches(
+            req.getHeaderValue(boost::beast::http::field::if_none_match),
+            variant->etag))
+    {
+        res.result(boost::beast::http::status::not_modified);
+        return;
+    }
+
+    if (variant->data)
+    {
+        res.writeShared(variant->data);
+        return;
+    }
+    if (!res.openFile(variant->path))
+    {
+        BMCWEB_LOG_DEBUG("failed to read file");
+        res.result(boost::beast::http::status::internal_server_error);
+    }
+}
+
+// Index of the static assets, built once at startup.  As many files as fit
+// in the budget are read into memory, and every file gets its ETag and size
+// worked out up front.
+class StaticAssetCache
+{
+  public:
+    explicit StaticAssetCache(size_t budgetIn) : budget(budgetIn) {}
+
+    // Adds a file as one copy of the asset served at webpath.  Returns the
+    // asset, so that the caller can fill in the rest of it, or nullptr if
+    // that copy of the asset already exists.
+    StaticAsset* addFile(const std::string& webpath,
+                         const std::filesystem::path& file,
+                         AssetEncoding encoding)
+    {
+        std::shared_ptr<StaticAsset>& asset = assets[webpath];
+        if (asset == nullptr)
+        {
+            asset = std::make_shared<StaticAsset>();
+        }
+        std::optional<AssetVariant>& variant =
+            asset->variants[static_cast<size_t>(encoding)];
+        if (variant)
+        {
+            return nullptr;
+        }
+        variant.emplace();
+        variant->path = file;
+        return asset.get();
+    }
+
+    // Works out the size and ETag of every file, and reads in as many as fit
+    // in the budget.  Call once every file has been added.
+    void load()
+    {
+        std::vector<AssetVariant*> toLoad;
+        for (auto& [webpath, asset] : assets)
+        {
+            for (size_t index = 0; index < asset->variants.size(); index++)
+            {
+                std::optional<AssetVariant>& variant = asset->variants[index];
+                if (!variant)
+                {
+                    continue;
+                }
+                setSizeAndEtag(*asset, static_cast<AssetEncoding>(index),
+                               *variant);
+                toLoad.push_back(&*variant);
+            }
+        }
+
+        // Small files first, so that a full page load is served from memory
+        // for as many of its requests as possible
+        std::ranges::stable_sort(toLoad, {}, &AssetVariant::size);
+        for (AssetVariant* variant : toLoad)
+        {
+            if (variant->size > budget - cachedBytes)
+            {
+                break;
+            }
+            variant->data = readFile(variant->path, variant->size);
+            if (variant->data)
+            {
+                cachedBytes += variant->data->size();
+                cachedFiles++;
+            }
+        }
+        BMCWEB_LOG_INFO("Cached {} of {} static files, {} bytes", cachedFiles,
+                        toLoad.size(), cachedBytes);
+    }
+
+    const boost::container::flat_map<std::string,
+                                     std::shared_ptr<StaticAsset>>&
+        getAssets() const
+    {
+        return assets;
+    }
+
+    size_t getCachedBytes() const
+    {
+        return cachedBytes;
+    }
+
+    size_t getCachedFiles() const
+    {
+        return cachedFiles;
+    }
+
+  private:
+    static void setSizeAndEtag(const StaticAsset& asset,
+                               AssetEncoding encoding, AssetVariant& variant)
+    {
+        std::error_code ec;
+        variant.size = static_cast<size_t>(
+            std::filesystem::file_size(variant.path, ec));
+        if (ec)
+        {
+            variant.size = 0;
+        }
+        std::string tag = asset.hash;
+        if (tag.empty())
+        {
+            // Same idea as nginx; the files only change along with the image
+            auto modified = std::filesystem::last_write_time(variant.path, ec);
+            tag = std::format("{:x}-{:x}",
+                              ec ? 0 : modified.time_since_epoch().count(),
+                              variant.size);
+        }
+        // Every copy of a resource needs its own strong ETag
+        if (encoding != AssetEncoding::Identity && asset.variantCount() > 1)
+        {
+            tag += '-';
+            tag += encodingName(encoding);
+        }
+        variant.etag = std::format("\"{}\"", tag);
+    }
+
+    static std::shared_ptr<const std::string>
+        readFile(const std::filesystem::path& path, size_t size)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string contents(size, '\0');
+        if (!file.read(contents.data(), static_cast<std::streamsize>(size)))
+        {
+            BMCWEB_LOG_ERROR("Failed to read {}", path.string());
+            return nullptr;
+        }
+        return std::make_shared<const std::string>(std::move(contents));
+    }
+
+    boost::container::flat_map<std::string, std::shared_ptr<StaticAsset>>
+        assets;
+    size_t budget;
+    size_t cachedBytes = 0;
+    size_t cachedFiles = 0;
+};
+
+} // namespace webassets
+} // namespace crow
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include "logging.hpp"
+
+extern "C"
+{
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif
+}
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace ensuressl
+{
+
+// Keys that TLS session tickets are encrypted with.  A new key is made every
+// rotation period.  Tickets made with the previous key are still accepted
+// for one more period, and are reissued with the current key when they're
+// used, so a client that keeps reconnecting never has to do a full
+// handshake.
+class SessionTicketKeys
+{
+  public:
+    struct Key
+    {
+        std::array<unsigned char, 16> name{};
+        std::array<unsigned char, 32> aesKey{};
+        std::array<unsigned char, 32> hmacKey{};
+        std::chrono::steady_clock::time_point created;
+    };
+
+    // The current key, and the one before it
+    static constexpr size_t maxKeys = 2;
+
+    explicit SessionTicketKeys(std::chrono::seconds rotationIn) :
+        rotation(rotationIn)
+    {}
+
+    // Shared by every SSL context, so that tickets survive the context being
+    // rebuilt when the certificate changes
+    static SessionTicketKeys& getInstance()
+    {
+        static SessionTicketKeys keys{
+            std::chrono::seconds(BMCWEB_TLS_TICKET_KEY_ROTATION)};
+        return keys;
+    }
+
+    // Returns the key to encrypt new tickets with, making a new one if the
+    // current key is too old
+    std::optional<Key> currentKey(std::chrono::steady_clock::time_point now)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (keys.empty() || now - keys.front().created >= rotation)
+        {
+            Key key;
+            key.created = now;
+            if (RAND_bytes(key.name.data(),
+                           static_cast<int>(key.name.size())) != 1 ||
+                RAND_bytes(key.aesKey.data(),
+                           static_cast<int>(key.aesKey.size())) != 1 ||
+                RAND_bytes(key.hmacKey.data(),
+                           static_cast<int>(key.hmacKey.size())) != 1)
+            {
+                BMCWEB_LOG_ERROR("Failed to generate session ticket key");
+                return std::nullopt;
+            }
+            keys.push_front(key);
+            if (keys.size() > maxKeys)
+            {
+                keys.pop_back();
+            }
+            rotations++;
+            BMCWEB_LOG_DEBUG("Rotated session ticket key");
+        }
+        return keys.front();
+    }
+
+    // Finds the key a ticket was encrypted with.  renew is set if the ticket
+    // should be replaced with one from the current key.
+    std::optional<Key> findKey(std::span<const unsigned char, 16> name,
+                               std::chrono::steady_clock::time_point now,
+                               bool& renew)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t index = 0; index < keys.size(); index++)
+        {
+            const Key& key = keys[index];
+            if (!std::ranges::equal(key.name, name))
+            {
+                continue;
+            }
+            std::chrono::steady_clock::duration age = now - key.created;
+            if (age >= rotation * static_cast<int>(maxKeys))
+            {
+                return std::nullopt;
+            }
+            renew = index != 0 || age >= rotation;
+            return key;
+        }
+        return std::nullopt;
+    }
+
+    uint64_t getRotations() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return rotations;
+    }
+
+  private:
+    const std::chrono::seconds rotation;
+    mutable std::mutex mutex;
+    // Newest first
+    std::deque<Key> keys;
+    uint64_t rotations = 0;
+};
+
+struct HandshakeCounters
+{
+    std::atomic<uint64_t> full = 0;
+    std::atomic<uint64_t> resumed = 0;
+};
+
+inline HandshakeCounters& handshakeCounters()
+{
+    static HandshakeCounters counters;
+    return counters;
+}
+
+// Called once a server handshake is done, to count whether the client
+// resumed a previous session
+inline void countHandshake(SSL* ssl)
+{
+    HandshakeCounters& counters = handshakeCounters();
+    if (SSL_session_reused(ssl) == 1)
+    {
+        counters.resumed++;
+        BMCWEB_LOG_DEBUG("Resumed TLS session; {} resumed, {} full handshakes",
+                         counters.resumed.load(), counters.full.load());
+        return;
+    }
+    counters.full++;
+}
+
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+using TicketMacCtx = EVP_MAC_CTX;
+#else
+using TicketMacCtx = HMAC_CTX;
+#endif
+
+// Encrypts new tickets with the current key, and picks the key to decrypt
+// tickets that clients present.  Return values are as documented for
+// SSL_CTX_set_tlsext_ticket_key_evp_cb.
+inline int ticketKeyCallback(SSL* /*ssl*/, unsigned char* keyName,
+                             unsigned char* iv, EVP_CIPHER_CTX* cipherCtx,
+                             TicketMacCtx* macCtx, int encrypt)
+{
+    SessionTicketKeys& ticketKeys = SessionTicketKeys::getInstance();
+    std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+    const EVP_CIPHER* cipher = EVP_aes_256_cbc();
+    std::optional<SessionTicketKeys::Key> key;
+    int ret = 1;
+    if (encrypt == 1)
+    {
+        key = ticketKeys.currentKey(now);
+        if (!key)
+        {
+            return -1;
+        }
+        std::ranges::copy(key->name, keyName);
+        if (RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) != 1)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        bool renew = false;
+        key = ticketKeys.findKey(
+            std::span<const unsigned char, 16>(keyName, 16), now, renew);
+        if (!key)
+        {
+            // Unknown or expired key; fall back to a full handshake
+            return 0;
+        }
+        ret = renew ? 2 : 1;
+    }
+
+    if (EVP_CipherInit_ex(cipherCtx, cipher, nullptr, key->aesKey.data(), iv,
+                          encrypt) != 1)
+    {
+        return -1;
+    }
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+    std::array<char, 7> digest{"sha256"};
+    std::array<OSSL_PARAM, 3> params{
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY,
+                                          key->hmacKey.data(),
+                                          key->hmacKey.size()),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest.data(),
+                                         0),
+        OSSL_PARAM_construct_end()};
+    if (EVP_MAC_CTX_set_params(macCtx, params.data()) != 1)
+    {
+        return -1;
+    }
+#else
+    if (HMAC_Init_ex(macCtx, key->hmacKey.data(),
+                     static_cast<int>(key->hmacKey.size()), EVP_sha256(),
+                     nullptr) != 1)
+    {
+        return -1;
+    }
+#endif
+    return ret;
+}
+
+// Lets clients that reconnect skip the full handshake, by resuming the
+// session from a ticket they hold, or from the server side cache.
+inline void setupSessionResumption(SSL_CTX* ctx)
+{
+    // Shared by every connection, so that a session from one connection can
+    // be resumed on any other; required when client certificates are used.
+    constexpr std::string_view sessionIdContext = "bmcweb";
+    if (SSL_CTX_set_session_id_context(
+            ctx,
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            reinterpret_cast<const unsigned char*>(sessionIdContext.data()),
+            static_cast<unsigned int>(sessionIdContext.size())) != 1)
+    {
+        BMCWEB_LOG_ERROR("Failed to set TLS session id context");
+    }
+    SSL_CTX_set_timeout(ctx, BMCWEB_TLS_SESSION_TIMEOUT);
+
+    if constexpr (BMCWEB_TLS_SESSION_CACHE_SIZE > 0)
+    {
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(ctx, BMCWEB_TLS_SESSION_CACHE_SIZE);
+    }
+    else
+    {
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+    }
+
+    if constexpr (BMCWEB_TLS_SESSION_TICKETS)
+    {
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, ticketKeyCallback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_cb(ctx, ticketKeyCallback);
+#endif
+        // Clients only need one ticket per connection, as they reconnect
+        // serially
+        SSL_CTX_set_num_tickets(ctx, 1);
+    }
+    else
+    {
+        // TLS 1.3 then issues tickets that refer to the server side cache
+        SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+        if constexpr (BMCWEB_TLS_SESSION_CACHE_SIZE == 0)
+        {
+            SSL_CTX_set_num_tickets(ctx, 0);
+        }
+    }
+}
+
+} // namespace ensuressl
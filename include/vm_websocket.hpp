@@ -1,6 +1,7 @@
 #pragma once
 
 #include "app.hpp"
+#include "buffer_pool.hpp"
 #include "dbus_utility.hpp"
 #include "privileges.hpp"
 #include "websocket.hpp"
@@ -10,11 +11,9 @@
 #include <boost/asio/writable_pipe.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/beast/core/buffers_to_string.hpp>
-#include <boost/beast/core/flat_static_buffer.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/process/v2/process.hpp>
 #include <boost/process/v2/stdio.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <csignal>
 #include <string_view>
@@ -40,9 +39,7 @@ class Handler : public std::enable_shared_from_this<Handler>
         pipeOut(ios), pipeIn(ios),
         proxy(ios, "/usr/bin/nbd-proxy", {media},
               boost::process::v2::process_stdio{
-                  .in = pipeIn, .out = pipeOut, .err = nullptr}),
-        outputBuffer(new boost::beast::flat_static_buffer<nbdBufferSize>),
-        inputBuffer(new boost::beast::flat_static_buffer<nbdBufferSize>)
+                  .in = pipeIn, .out = pipeOut, .err = nullptr})
     {}
 
     ~Handler() = default;
@@ -90,7 +87,7 @@ class Handler : public std::enable_shared_from_this<Handler>
             return;
         }
 
-        if (inputBuffer->size() == 0)
+        if (inputBuffer.size() == 0)
         {
             BMCWEB_LOG_DEBUG("inputBuffer empty.  Bailing out");
             return;
@@ -98,12 +95,13 @@ class Handler : public std::enable_shared_from_this<Handler>
 
         doingWrite = true;
         pipeIn.async_write_some(
-            inputBuffer->data(),
+            inputBuffer.data(),
             [this, self(shared_from_this())](const boost::beast::error_code& ec,
                                              std::size_t bytesWritten) {
             BMCWEB_LOG_DEBUG("Wrote {}bytes", bytesWritten);
             doingWrite = false;
-            inputBuffer->consume(bytesWritten);
+            inputBuffer.consume(bytesWritten);
+            inputBuffer.release();
 
             if (session == nullptr)
             {
@@ -126,10 +124,13 @@ class Handler : public std::enable_shared_from_this<Handler>
 
     void doRead()
     {
-        std::size_t bytes = outputBuffer->capacity() - outputBuffer->size();
+        // Pipes can't be waited on for readability, so the output buffer is
+        // held for as long as the proxy runs
+        outputBuffer.acquire();
+        std::size_t bytes = outputBuffer.capacity() - outputBuffer.size();
 
         pipeOut.async_read_some(
-            outputBuffer->prepare(bytes),
+            outputBuffer.prepare(bytes),
             [this, self(shared_from_this())](
                 const boost::system::error_code& ec, std::size_t bytesRead) {
             BMCWEB_LOG_DEBUG("Read done.  Read {} bytes", bytesRead);
@@ -147,12 +148,12 @@ class Handler : public std::enable_shared_from_this<Handler>
                 return;
             }
 
-            outputBuffer->commit(bytesRead);
+            outputBuffer.commit(bytesRead);
             std::string_view payload(
-                static_cast<const char*>(outputBuffer->data().data()),
+                static_cast<const char*>(outputBuffer.data().data()),
                 bytesRead);
             session->sendBinary(payload);
-            outputBuffer->consume(bytesRead);
+            outputBuffer.consume(bytesRead);
 
             doRead();
         });
@@ -163,10 +164,9 @@ class Handler : public std::enable_shared_from_this<Handler>
     boost::process::v2::process proxy;
     bool doingWrite{false};
 
-    std::unique_ptr<boost::beast::flat_static_buffer<nbdBufferSize>>
-        outputBuffer;
-    std::unique_ptr<boost::beast::flat_static_buffer<nbdBufferSize>>
-        inputBuffer;
+    bmcweb::PooledFlatBuffer<nbdBufferSize> outputBuffer;
+    // Only holds storage while there is data waiting to go to the proxy
+    bmcweb::PooledFlatBuffer<nbdBufferSize> inputBuffer;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -217,7 +217,7 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             BMCWEB_LOG_DEBUG("Failed to remove file, ignoring");
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             dbus::utility::logError, "xyz.openbmc_project.VirtualMedia", path,
             "xyz.openbmc_project.VirtualMedia.Proxy", "Unmount");
     }
@@ -275,7 +275,7 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
         acceptor.async_accept(
             std::bind_front(&NbdProxyServer::afterAccept, weak_from_this()));
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [weak{weak_from_this()}](const boost::system::error_code& ec,
                                      bool isBinary) {
             afterMount(weak, ec, isBinary);
@@ -286,6 +286,7 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
 
     void send(std::string_view buffer, std::function<void()>&& onDone)
     {
+        ws2uxBuf.acquire();
         size_t copied = boost::asio::buffer_copy(
             ws2uxBuf.prepare(buffer.size()), boost::asio::buffer(buffer));
         ws2uxBuf.commit(copied);
@@ -300,6 +301,7 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
         if (self2 != nullptr)
         {
             self2->ux2wsBuf.consume(self2->ux2wsBuf.size());
+            self2->ux2wsBuf.release();
             self2->doRead();
         }
     }
@@ -327,12 +329,32 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             std::bind_front(&NbdProxyServer::afterSendEx, weak_from_this()));
     }
 
+    static void afterWait(const std::weak_ptr<NbdProxyServer>& weak,
+                          const boost::system::error_code& ec)
+    {
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("UNIX socket: async_wait error = {}",
+                             ec.message());
+            return;
+        }
+        std::shared_ptr<NbdProxyServer> self = weak.lock();
+        if (self == nullptr)
+        {
+            return;
+        }
+        self->ux2wsBuf.acquire();
+        self->peerSocket.async_read_some(
+            self->ux2wsBuf.prepare(nbdBufferSize),
+            std::bind_front(&NbdProxyServer::afterRead, self.get(), weak));
+    }
+
     void doRead()
     {
-        // Trigger async read
-        peerSocket.async_read_some(ux2wsBuf.prepare(nbdBufferSize),
-                                   std::bind_front(&NbdProxyServer::afterRead,
-                                                   this, weak_from_this()));
+        // Only borrow a buffer once the proxy has something to send
+        peerSocket.async_wait(
+            stream_protocol::socket::wait_read,
+            std::bind_front(&NbdProxyServer::afterWait, weak_from_this()));
     }
 
     static void afterWrite(const std::weak_ptr<NbdProxyServer>& weak,
@@ -362,6 +384,7 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             self->doWrite(std::move(onDone));
             return;
         }
+        self->ws2uxBuf.release();
         onDone();
     }
 
@@ -393,11 +416,11 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
 
     bool uxWriteInProgress = false;
 
-    // UNIX => WebSocket buffer
-    boost::beast::flat_static_buffer<nbdBufferSize> ux2wsBuf;
+    // UNIX => WebSocket buffer, only held while data is in flight
+    bmcweb::PooledFlatBuffer<nbdBufferSize> ux2wsBuf;
 
-    // WebSocket => UNIX buffer
-    boost::beast::flat_static_buffer<nbdBufferSize> ws2uxBuf;
+    // WebSocket => UNIX buffer, only held while data is in flight
+    bmcweb::PooledFlatBuffer<nbdBufferSize> ws2uxBuf;
 
     // The socket used to communicate with the client.
     stream_protocol::socket peerSocket;
@@ -475,8 +498,8 @@ inline void onOpen(crow::websocket::Connection& conn)
     std::string path =
         std::format("/xyz/openbmc_project/VirtualMedia/Proxy/Slot_{}", index);
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.VirtualMedia", path,
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.VirtualMedia", path,
         "xyz.openbmc_project.VirtualMedia.MountPoint",
         [&conn, path](const boost::system::error_code& ec,
                       const dbus::utility::DBusPropertiesMap& propertiesList) {
@@ -583,14 +606,15 @@ inline void requestRoutes(App& app)
 
             session = nullptr;
             handler->doClose();
-            handler->inputBuffer->clear();
-            handler->outputBuffer->clear();
+            handler->inputBuffer.clear();
+            handler->outputBuffer.clear();
             handler.reset();
         })
             .onmessage([](crow::websocket::Connection& conn,
                           const std::string& data, bool) {
+            handler->inputBuffer.acquire();
             if (data.length() >
-                handler->inputBuffer->capacity() - handler->inputBuffer->size())
+                handler->inputBuffer.capacity() - handler->inputBuffer.size())
             {
                 BMCWEB_LOG_ERROR("Buffer overrun when writing {} bytes",
                                  data.length());
@@ -599,9 +623,9 @@ inline void requestRoutes(App& app)
             }
 
             size_t copied = boost::asio::buffer_copy(
-                handler->inputBuffer->prepare(data.size()),
+                handler->inputBuffer.prepare(data.size()),
                 boost::asio::buffer(data));
-            handler->inputBuffer->commit(copied);
+            handler->inputBuffer.commit(copied);
             handler->doWrite();
         });
     }
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include "app.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
 #include "routing.hpp"
+#include "static_asset_cache.hpp"
 #include "webroutes.hpp"
 
 #include <boost/container/flat_set.hpp>
@@ -93,14 +96,12 @@ inline void requestRoutes(App& app)
         return;
     }
 
-    // In certain cases, we might have both a gzipped version of the file AND a
-    // non-gzipped version.  To avoid duplicated routes, we need to make sure we
-    // get the gzipped version first.  Because the gzipped path should be longer
-    // than the non gzipped path, if we sort in descending order, we should be
-    // guaranteed to get the gzip version first.
+    StaticAssetCache cache(
+        static_cast<size_t>(BMCWEB_STATIC_ASSET_CACHE_SIZE) * 1024U);
+
     std::vector<std::filesystem::directory_entry> paths(
         std::filesystem::begin(dirIter), std::filesystem::end(dirIter));
-    std::sort(paths.rbegin(), paths.rend());
+    std::sort(paths.begin(), paths.end());
 
     for (const std::filesystem::directory_entry& dir : paths)
     {
@@ -120,14 +121,17 @@ inline void requestRoutes(App& app)
         {
             std::string extension = relativePath.extension();
             std::filesystem::path webpath = relativePath;
-            const char* contentEncoding = nullptr;
+            AssetEncoding encoding = AssetEncoding::Identity;
 
-            if (extension == ".gz")
+            // Precompressed copies are served in place of the file they were
+            // made from
+            if (extension == ".gz" || extension == ".br")
             {
+                encoding = extension == ".gz" ? AssetEncoding::Gzip
+                                              : AssetEncoding::Brotli;
                 webpath = webpath.replace_extension("");
-                // Use the non-gzip version for determining content type
+                // Use the uncompressed name for determining content type
                 extension = webpath.extension().string();
-                contentEncoding = "gzip";
             }
 
             std::string etag = getStaticEtag(webpath);
@@ -145,17 +149,16 @@ inline void requestRoutes(App& app)
                 }
             }
 
-            std::pair<boost::container::flat_set<std::string>::iterator, bool>
-                inserted = webroutes::routes.insert(webpath);
-
-            if (!inserted.second)
+            StaticAsset* asset = cache.addFile(webpath, absolutePath,
+                                               encoding);
+            if (asset == nullptr)
             {
                 // Got a duplicated path.  This is expected in certain
                 // situations
                 BMCWEB_LOG_DEBUG("Got duplicated path {}", webpath.string());
                 continue;
             }
-            const char* contentType = nullptr;
+            webroutes::routes.insert(webpath);
 
             for (const std::pair<const char*, const char*>& ext : contentTypes)
             {
@@ -165,74 +168,39 @@ inline void requestRoutes(App& app)
                 }
                 if (extension == ext.first)
                 {
-                    contentType = ext.second;
+                    asset->contentType = ext.second;
                 }
             }
 
-            if (contentType == nullptr)
+            if (asset->contentType == nullptr)
             {
                 BMCWEB_LOG_ERROR(
                     "Cannot determine content-type for {} with extension {}",
                     absolutePath.string(), extension);
             }
 
-            if (webpath == "/")
-            {
-                forward_unauthorized::hasWebuiRoute = true;
-            }
-
-            app.routeDynamic(webpath)(
-                [absolutePath, contentType, contentEncoding, etag,
-                 renamed](const crow::Request& req,
-                          const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
-                if (contentType != nullptr)
-                {
-                    asyncResp->res.addHeader(
-                        boost::beast::http::field::content_type, contentType);
-                }
-
-                if (contentEncoding != nullptr)
-                {
-                    asyncResp->res.addHeader(
-                        boost::beast::http::field::content_encoding,
-                        contentEncoding);
-                }
+            // Don't cache paths that don't have the etag in them, like
+            // index, which gets transformed to /
+            asset->hash = etag.empty() ? "" : etag.substr(1, etag.size() - 2);
+            asset->immutable = !etag.empty() && !renamed;
+        }
+    }
 
-                if (!etag.empty())
-                {
-                    asyncResp->res.addHeader(boost::beast::http::field::etag,
-                                             etag);
-                    // Don't cache paths that don't have the etag in them, like
-                    // index, which gets transformed to /
-                    if (!renamed)
-                    {
-                        // Anything with a hash can be cached forever and is
-                        // immutable
-                        asyncResp->res.addHeader(
-                            boost::beast::http::field::cache_control,
-                            "max-age=31556926, immutable");
-                    }
-
-                    std::string_view cachedEtag = req.getHeaderValue(
-                        boost::beast::http::field::if_none_match);
-                    if (cachedEtag == etag)
-                    {
-                        asyncResp->res.result(
-                            boost::beast::http::status::not_modified);
-                        return;
-                    }
-                }
+    cache.load();
 
-                // res.set_header("Cache-Control", "public, max-age=86400");
-                if (!asyncResp->res.openFile(absolutePath))
-                {
-                    BMCWEB_LOG_DEBUG("failed to read file");
-                    asyncResp->res.result(
-                        boost::beast::http::status::internal_server_error);
-                    return;
-                }
-            });
+    for (const auto& [webpath, asset] : cache.getAssets())
+    {
+        if (webpath == "/")
+        {
+            forward_unauthorized::hasWebuiRoute = true;
         }
+
+        app.routeDynamic(webpath)(
+            [asset(std::shared_ptr<const StaticAsset>(asset))](
+                const crow::Request& req,
+                const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+            handleAssetRequest(*asset, req, asyncResp->res);
+        });
     }
 }
 } // namespace webassets
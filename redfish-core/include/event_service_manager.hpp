@@ -18,6 +18,7 @@
 #include "error_messages.hpp"
 #include "event_service_store.hpp"
 #include "http_client.hpp"
+#include "http_utility.hpp"
 #include "metric_report.hpp"
 #include "ossl_random.hpp"
 #include "persistent_data.hpp"
@@ -330,8 +331,9 @@ class Subscription : public persistent_data::UserSubscription
         msg["Name"] = "Event Log";
         msg["Events"] = logEntryArray;
 
-        std::string strMsg = msg.dump(2, ' ', true,
-                                      nlohmann::json::error_handler_t::replace);
+        std::string strMsg =
+            msg.dump(http_helpers::defaultJsonIndent, ' ', true,
+                     nlohmann::json::error_handler_t::replace);
         return sendEvent(std::move(strMsg));
     }
 
@@ -395,8 +397,9 @@ class Subscription : public persistent_data::UserSubscription
         msg["Id"] = std::to_string(eventSeqNum);
         msg["Name"] = "Event Log";
         msg["Events"] = logEntryArray;
-        std::string strMsg = msg.dump(2, ' ', true,
-                                      nlohmann::json::error_handler_t::replace);
+        std::string strMsg =
+            msg.dump(http_helpers::defaultJsonIndent, ' ', true,
+                     nlohmann::json::error_handler_t::replace);
         sendEvent(std::move(strMsg));
         eventSeqNum++;
     }
@@ -434,8 +437,9 @@ class Subscription : public persistent_data::UserSubscription
             msg["Context"] = customText;
         }
 
-        std::string strMsg = msg.dump(2, ' ', true,
-                                      nlohmann::json::error_handler_t::replace);
+        std::string strMsg =
+            msg.dump(http_helpers::defaultJsonIndent, ' ', true,
+                     nlohmann::json::error_handler_t::replace);
         sendEvent(std::move(strMsg));
     }
 
@@ -998,7 +1002,8 @@ class EventServiceManager
                 msgJson["Events"] = eventRecord;
 
                 std::string strMsg = msgJson.dump(
-                    2, ' ', true, nlohmann::json::error_handler_t::replace);
+                    http_helpers::defaultJsonIndent, ' ', true,
+                    nlohmann::json::error_handler_t::replace);
                 entry->sendEvent(std::move(strMsg));
                 eventId++; // increment the eventId
             }
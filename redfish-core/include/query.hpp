@@ -7,6 +7,7 @@
 #include "error_messages.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
+#include "http_utility.hpp"
 #include "logging.hpp"
 #include "utils/query_param.hpp"
 
@@ -38,7 +39,8 @@ inline void afterIfMatchRequest(
     std::string computedEtag = resIn.computeEtag();
     BMCWEB_LOG_DEBUG("User provided if-match etag {} computed etag {}",
                      ifMatchHeader, computedEtag);
-    if (computedEtag != ifMatchHeader)
+    // The tag may have come from a compressed response
+    if (!http_helpers::etagMatchesAnyEncoding(ifMatchHeader, computedEtag))
     {
         messages::preconditionFailed(asyncResp->res);
         return;
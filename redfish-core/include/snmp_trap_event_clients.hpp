@@ -77,9 +77,9 @@ inline void
         asyncResp->res.jsonValue["Context"] = "";
     }
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.Network.SNMP",
-        objectPath, "xyz.openbmc_project.Network.Client",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.Network.SNMP", objectPath,
+        "xyz.openbmc_project.Network.Client",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& properties) {
         afterGetSnmpTrapClientdata(asyncResp, ec, properties);
@@ -90,7 +90,7 @@ inline void
     getSnmpTrapClient(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                       const std::string& id)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id](const boost::system::error_code& ec,
                         dbus::utility::ManagedObjectType& resp) {
         if (ec)
@@ -178,7 +178,7 @@ inline void
     addSnmpTrapClient(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                       const std::string& host, uint16_t snmpTrapPort)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, host](const boost::system::error_code& ec,
                           const sdbusplus::message_t& msg,
                           const std::string& dbusSNMPid) {
@@ -221,7 +221,7 @@ inline void
             "/xyz/openbmc_project/network/snmp/manager") /
         std::string(snmpTrapId);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, param](const boost::system::error_code& ec) {
         if (ec)
         {
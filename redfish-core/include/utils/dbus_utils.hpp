@@ -1,12 +1,11 @@
 #pragma once
 
 #include "async_resp.hpp"
-#include "dbus_singleton.hpp"
+#include "dbus_utility.hpp"
 #include "error_messages.hpp"
 #include "logging.hpp"
 
 #include <nlohmann/json.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/message.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
@@ -59,9 +58,8 @@ void setDbusProperty(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     std::string interfaceStr(interface);
     std::string dbusPropertyStr(dbusProperty);
 
-    sdbusplus::asio::setProperty(
-        *crow::connections::systemBus, processNameStr, path.str, interfaceStr,
-        dbusPropertyStr, prop,
+    dbus::utility::setProperty(
+        processNameStr, path.str, interfaceStr, dbusPropertyStr, prop,
         [asyncResp, redfishPropertyNameStr = std::string{redfishPropertyName},
          jsonProp = nlohmann::json(prop)](const boost::system::error_code& ec,
                                           const sdbusplus::message_t& msg) {
@@ -84,9 +82,8 @@ void setDbusPropertyAction(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     std::string interfaceStr(interface);
     std::string dbusPropertyStr(dbusProperty);
 
-    sdbusplus::asio::setProperty(
-        *crow::connections::systemBus, processNameStr, path.str, interfaceStr,
-        dbusPropertyStr, prop,
+    dbus::utility::setProperty(
+        processNameStr, path.str, interfaceStr, dbusPropertyStr, prop,
         [asyncResp,
          redfishActionParameterName = std::string{redfishActionParameterName},
          jsonProp = nlohmann::json(prop),
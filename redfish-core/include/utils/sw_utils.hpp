@@ -8,7 +8,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <algorithm>
@@ -133,9 +132,9 @@ inline void populateSoftwareInformation(
                 }
 
                 // Now grab its version info
-                sdbusplus::asio::getAllProperties(
-                    *crow::connections::systemBus, obj.second[0].first,
-                    obj.first, "xyz.openbmc_project.Software.Version",
+                dbus::utility::getAllProperties(
+                    obj.second[0].first, obj.first,
+                    "xyz.openbmc_project.Software.Version",
                     [asyncResp, swId, runningImage, swVersionPurpose,
                      activeVersionPropName, populateLinkToImages](
                         const boost::system::error_code& ec3,
@@ -300,9 +299,8 @@ inline void getSwStatus(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     BMCWEB_LOG_DEBUG("getSwStatus: swId {} svc {}", *swId, dbusSvc);
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, dbusSvc,
-        "/xyz/openbmc_project/software/" + *swId,
+    dbus::utility::getAllProperties(
+        dbusSvc, "/xyz/openbmc_project/software/" + *swId,
         "xyz.openbmc_project.Software.Activation",
         [asyncResp,
          swId](const boost::system::error_code& ec,
@@ -29,7 +29,6 @@
 
 #include <boost/url/format.hpp>
 #include <boost/url/url.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -308,7 +307,7 @@ inline void userErrorMessageHandler(
     }
     else
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", errorMessage);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", errorMessage);
         messages::internalError(asyncResp->res);
     }
 }
@@ -380,12 +379,13 @@ inline void handleRoleMapPatch(
             // delete the existing object
             if (index < roleMapObjData.size())
             {
-                crow::connections::systemBus->async_method_call(
+                dbus::utility::asyncMethodCall(
                     [asyncResp, roleMapObjData, serverType,
                      index](const boost::system::error_code& ec) {
                     if (ec)
                     {
-                        BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+                        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}",
+                                             ec);
                         messages::internalError(asyncResp->res);
                         return;
                     }
@@ -481,12 +481,13 @@ inline void handleRoleMapPatch(
                 BMCWEB_LOG_DEBUG("Remote Group={},LocalRole={}", *remoteGroup,
                                  *localRole);
 
-                crow::connections::systemBus->async_method_call(
+                dbus::utility::asyncMethodCall(
                     [asyncResp, serverType, localRole,
                      remoteGroup](const boost::system::error_code& ec) {
                     if (ec)
                     {
-                        BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+                        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}",
+                                             ec);
                         messages::internalError(asyncResp->res);
                         return;
                     }
@@ -524,8 +525,9 @@ inline void getLDAPConfigData(const std::string& ldapType,
                    const dbus::utility::MapperGetObject& resp) mutable {
         if (ec || resp.empty())
         {
-            BMCWEB_LOG_WARNING(
-                "DBUS response error during getting of service name: {}", ec);
+            BMCWEB_LOG_WARNING_CAT(
+                Dbus, "DBUS response error during getting of service name: {}",
+                ec);
             LDAPConfigData empty{};
             callback(false, empty, ldapType);
             return;
@@ -541,7 +543,7 @@ inline void getLDAPConfigData(const std::string& ldapType,
             if (ec2)
             {
                 callback(false, confData, ldapType);
-                BMCWEB_LOG_WARNING("D-Bus responses error: {}", ec2);
+                BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus responses error: {}", ec2);
                 return;
             }
 
@@ -1339,9 +1341,9 @@ inline void
         asyncResp->res.jsonValue["LDAP"]["Certificates"]["@odata.id"] =
             "/redfish/v1/AccountService/LDAP/Certificates";
     }
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.User.Manager",
-        "/xyz/openbmc_project/user", "xyz.openbmc_project.User.AccountPolicy",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.User.Manager", "/xyz/openbmc_project/user",
+        "xyz.openbmc_project.User.AccountPolicy",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& propertiesList) {
         if (ec)
@@ -1626,7 +1628,7 @@ inline void processAfterCreateUser(
         tempObjPath /= username;
         const std::string userPath(tempObjPath);
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, password](const boost::system::error_code& ec3) {
             if (ec3)
             {
@@ -1718,7 +1720,7 @@ inline void processAfterGetAllGroups(
         messages::internalError(asyncResp->res);
         return;
     }
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, username, password](const boost::system::error_code& ec2,
                                         sdbusplus::message_t& m) {
         processAfterCreateUser(asyncResp, username, password, ec2, m);
@@ -1761,10 +1763,9 @@ inline void handleAccountCollectionPost(
     bool enabled = enabledJson.value_or(true);
 
     // Reading AllGroups property
-    sdbusplus::asio::getProperty<std::vector<std::string>>(
-        *crow::connections::systemBus, "xyz.openbmc_project.User.Manager",
-        "/xyz/openbmc_project/user", "xyz.openbmc_project.User.Manager",
-        "AllGroups",
+    dbus::utility::getProperty<std::vector<std::string>>(
+        "xyz.openbmc_project.User.Manager", "/xyz/openbmc_project/user",
+        "xyz.openbmc_project.User.Manager", "AllGroups",
         [asyncResp, username, password{std::move(password)}, roleId, enabled,
          accountTypes](const boost::system::error_code& ec,
                        const std::vector<std::string>& allGroupsList) {
@@ -2005,7 +2006,7 @@ inline void
     tempObjPath /= username;
     const std::string userPath(tempObjPath);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, username](const boost::system::error_code& ec) {
         if (ec)
         {
@@ -2094,7 +2095,7 @@ inline void
                              locked, accountTypes, userSelf, req.session);
         return;
     }
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, username, password(std::move(password)),
          roleId(std::move(roleId)), enabled, newUser{std::string(*newUserName)},
          locked, userSelf, req, accountTypes(std::move(accountTypes))](
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "app.hpp"
+#include "dbus_utility.hpp"
 #include "query.hpp"
 #include "registries/privilege_registry.hpp"
 #include "utils/sw_utils.hpp"
@@ -89,7 +90,7 @@ inline void
         return;
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec) {
         if (ec)
         {
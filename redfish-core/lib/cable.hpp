@@ -9,7 +9,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -30,7 +29,7 @@ inline void
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(resp);
         return;
     }
@@ -91,9 +90,8 @@ inline void
         {
             if (interface == "xyz.openbmc_project.Inventory.Item.Cable")
             {
-                sdbusplus::asio::getAllProperties(
-                    *crow::connections::systemBus, service, cableObjectPath,
-                    interface,
+                dbus::utility::getAllProperties(
+                    service, cableObjectPath, interface,
                     [asyncResp](
                         const boost::system::error_code& ec,
                         const dbus::utility::DBusPropertiesMap& properties) {
@@ -102,9 +100,8 @@ inline void
             }
             else if (interface == "xyz.openbmc_project.Inventory.Item")
             {
-                sdbusplus::asio::getProperty<bool>(
-                    *crow::connections::systemBus, service, cableObjectPath,
-                    interface, "Present",
+                dbus::utility::getProperty<bool>(
+                    service, cableObjectPath, interface, "Present",
                     [asyncResp, cableObjectPath](
                         const boost::system::error_code& ec, bool present) {
                     if (ec)
@@ -160,7 +157,7 @@ inline void requestRoutesCable(App& app)
 
             if (ec)
             {
-                BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -13,7 +13,6 @@
 
 #include <boost/system/linux_error.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
@@ -296,14 +295,14 @@ static void getCertificateProperties(
 {
     BMCWEB_LOG_DEBUG("getCertificateProperties Path={} certId={} certURl={}",
                      objectPath, certId, certURL);
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objectPath, certs::certPropIntf,
+    dbus::utility::getAllProperties(
+        service, objectPath, certs::certPropIntf,
         [asyncResp, certURL, certId,
          name](const boost::system::error_code& ec,
                const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             messages::resourceNotFound(asyncResp->res, "Certificate", certId);
             return;
         }
@@ -381,7 +380,7 @@ static void
                       const std::string& service,
                       const sdbusplus::message::object_path& objectPath)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp,
          id{objectPath.filename()}](const boost::system::error_code& ec) {
         if (ec)
@@ -545,12 +544,12 @@ inline void handleReplaceCertificateAction(
 
     std::shared_ptr<CertificateFile> certFile =
         std::make_shared<CertificateFile>(certificate);
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, certFile, objectPath, service, url{*parsedUrl}, id,
          name](const boost::system::error_code& ec) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             if (ec.value() ==
                 boost::system::linux_error::bad_request_descriptor)
             {
@@ -587,12 +586,12 @@ static void getCSR(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     BMCWEB_LOG_DEBUG("getCSR CertObjectPath{} CSRObjectPath={} service={}",
                      certObjPath, csrObjPath, service);
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, certURI](const boost::system::error_code& ec,
                              const std::string& csr) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -807,7 +806,7 @@ inline void
         timeout.cancel();
         if (m.is_method_error())
         {
-            BMCWEB_LOG_ERROR("Dbus method error!!!");
+            BMCWEB_LOG_ERROR_CAT(Dbus, "Dbus method error!!!");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -827,11 +826,11 @@ inline void
             }
         }
     });
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec, const std::string&) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec.message());
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec.message());
             messages::internalError(asyncResp->res);
             return;
         }
@@ -934,12 +933,12 @@ inline void handleHTTPSCertificateCollectionPost(
     std::shared_ptr<CertificateFile> certFile =
         std::make_shared<CertificateFile>(certHttpBody);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, certFile](const boost::system::error_code& ec,
                               const std::string& objectPath) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1048,12 +1047,12 @@ inline void handleLDAPCertificateCollectionPost(
     std::shared_ptr<CertificateFile> certFile =
         std::make_shared<CertificateFile>(certHttpBody);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, certFile](const boost::system::error_code& ec,
                               const std::string& objectPath) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1185,12 +1184,12 @@ inline void handleTrustStoreCertificateCollectionPost(
 
     std::shared_ptr<CertificateFile> certFile =
         std::make_shared<CertificateFile>(certHttpBody);
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, certFile](const boost::system::error_code& ec,
                               const std::string& objectPath) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -27,7 +27,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/message.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
@@ -54,14 +53,15 @@ namespace redfish
 inline void getStorageLink(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                            const sdbusplus::message::object_path& path)
 {
-    sdbusplus::asio::getProperty<std::vector<std::string>>(
-        *crow::connections::systemBus, "xyz.openbmc_project.ObjectMapper",
-        (path / "storage").str, "xyz.openbmc_project.Association", "endpoints",
+    dbus::utility::getProperty<std::vector<std::string>>(
+        "xyz.openbmc_project.ObjectMapper", (path / "storage").str,
+        "xyz.openbmc_project.Association", "endpoints",
         [asyncResp](const boost::system::error_code& ec,
                     const std::vector<std::string>& storageList) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("getStorageLink got DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(
+                Dbus, "getStorageLink got DBUS response error");
             return;
         }
 
@@ -96,9 +96,9 @@ inline void getStorageLink(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
  */
 inline void getChassisState(std::shared_ptr<bmcweb::AsyncResp> asyncResp)
 {
-    // crow::connections::systemBus->async_method_call(
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Chassis",
+    // dbus::utility::asyncMethodCall(
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.State.Chassis",
         "/xyz/openbmc_project/state/chassis0",
         "xyz.openbmc_project.State.Chassis", "CurrentPowerState",
         [asyncResp{std::move(asyncResp)}](const boost::system::error_code& ec,
@@ -112,7 +112,7 @@ inline void getChassisState(std::shared_ptr<bmcweb::AsyncResp> asyncResp)
                 BMCWEB_LOG_DEBUG("Service not available {}", ec);
                 return;
             }
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -145,7 +145,7 @@ inline void handlePhysicalSecurityGetSubTree(
     {
         // do not add err msg in redfish response, because this is not
         //     mandatory property
-        BMCWEB_LOG_INFO("DBUS error: no matched iface {}", ec);
+        BMCWEB_LOG_INFO_CAT(Dbus, "DBUS error: no matched iface {}", ec);
         return;
     }
     // Iterate over all retrieved ObjectPaths.
@@ -157,8 +157,8 @@ inline void handlePhysicalSecurityGetSubTree(
 
             BMCWEB_LOG_DEBUG("Get intrusion status by service ");
 
-            sdbusplus::asio::getProperty<std::string>(
-                *crow::connections::systemBus, service.first, object.first,
+            dbus::utility::getProperty<std::string>(
+                service.first, object.first,
                 "xyz.openbmc_project.Chassis.Intrusion", "Status",
                 [asyncResp](const boost::system::error_code& ec1,
                             const std::string& value) {
@@ -167,7 +167,7 @@ inline void handlePhysicalSecurityGetSubTree(
                     // do not add err msg in redfish response, because this is
                     // not
                     //     mandatory property
-                    BMCWEB_LOG_ERROR("DBUS response error {}", ec1);
+                    BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec1);
                     return;
                 }
                 asyncResp->res
@@ -211,7 +211,7 @@ inline void getChassisContainedBy(
     {
         if (ec.value() != EBADR)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
         }
         return;
@@ -250,7 +250,7 @@ inline void getChassisContains(
     {
         if (ec.value() != EBADR)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
         }
         return;
@@ -323,14 +323,14 @@ inline void
                            const std::string& connectionName,
                            const std::string& path)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, connectionName, path,
+    dbus::utility::getProperty<std::string>(
+        connectionName, path,
         "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& property) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error for Location");
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Location");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -344,14 +344,13 @@ inline void getChassisUUID(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                            const std::string& connectionName,
                            const std::string& path)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Common.UUID", "UUID",
+    dbus::utility::getProperty<std::string>(
+        connectionName, path, "xyz.openbmc_project.Common.UUID", "UUID",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& chassisUUID) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error for UUID");
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for UUID");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -462,7 +461,7 @@ inline void handleChassisGetSubTree(
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -535,15 +534,14 @@ inline void handleChassisGetSubTree(
         {
             if (interface == assetTagInterface)
             {
-                sdbusplus::asio::getProperty<std::string>(
-                    *crow::connections::systemBus, connectionName, path,
-                    assetTagInterface, "AssetTag",
+                dbus::utility::getProperty<std::string>(
+                    connectionName, path, assetTagInterface, "AssetTag",
                     [asyncResp, chassisId](const boost::system::error_code& ec2,
                                            const std::string& property) {
                     if (ec2)
                     {
-                        BMCWEB_LOG_ERROR("DBus response error for AssetTag: {}",
-                                         ec2);
+                        BMCWEB_LOG_ERROR_CAT(
+                            Dbus, "DBus response error for AssetTag: {}", ec2);
                         messages::internalError(asyncResp->res);
                         return;
                     }
@@ -552,15 +550,15 @@ inline void handleChassisGetSubTree(
             }
             else if (interface == replaceableInterface)
             {
-                sdbusplus::asio::getProperty<bool>(
-                    *crow::connections::systemBus, connectionName, path,
-                    replaceableInterface, "HotPluggable",
+                dbus::utility::getProperty<bool>(
+                    connectionName, path, replaceableInterface, "HotPluggable",
                     [asyncResp, chassisId](const boost::system::error_code& ec2,
                                            const bool property) {
                     if (ec2)
                     {
-                        BMCWEB_LOG_ERROR(
-                            "DBus response error for HotPluggable: {}", ec2);
+                        BMCWEB_LOG_ERROR_CAT(
+                            Dbus, "DBus response error for HotPluggable: {}",
+                            ec2);
                         messages::internalError(asyncResp->res);
                         return;
                     }
@@ -569,15 +567,14 @@ inline void handleChassisGetSubTree(
             }
             else if (interface == revisionInterface)
             {
-                sdbusplus::asio::getProperty<std::string>(
-                    *crow::connections::systemBus, connectionName, path,
-                    revisionInterface, "Version",
+                dbus::utility::getProperty<std::string>(
+                    connectionName, path, revisionInterface, "Version",
                     [asyncResp, chassisId](const boost::system::error_code& ec2,
                                            const std::string& property) {
                     if (ec2)
                     {
-                        BMCWEB_LOG_ERROR("DBus response error for Version: {}",
-                                         ec2);
+                        BMCWEB_LOG_ERROR_CAT(
+                            Dbus, "DBus response error for Version: {}", ec2);
                         messages::internalError(asyncResp->res);
                         return;
                     }
@@ -596,8 +593,8 @@ inline void handleChassisGetSubTree(
             }
         }
 
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, connectionName, path,
+        dbus::utility::getAllProperties(
+            connectionName, path,
             "xyz.openbmc_project.Inventory.Decorator.Asset",
             [asyncResp, chassisId,
              path](const boost::system::error_code&,
@@ -700,7 +697,7 @@ inline void
                        const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -806,7 +803,8 @@ inline void
             const dbus::utility::MapperGetSubTreePathsResponse& chassisList) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("[mapper] Bad D-Bus request error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "[mapper] Bad D-Bus request error: {}",
+                                 ec);
             messages::internalError(asyncResp->res);
             return;
         }
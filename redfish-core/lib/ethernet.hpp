@@ -741,7 +741,7 @@ inline void deleteIPAddress(const std::string& ifaceId,
                             const std::string& ipHash,
                             const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec) {
         if (ec)
         {
@@ -777,7 +777,7 @@ inline void createIPv4(const std::string& ifaceId, uint8_t prefixLength,
         }
     };
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(createIpHandler), "xyz.openbmc_project.Network",
         "/xyz/openbmc_project/network/" + ifaceId,
         "xyz.openbmc_project.Network.IP.Create", "IP",
@@ -805,7 +805,7 @@ inline void deleteAndCreateIPAddress(
     const std::string& gateway,
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, version, ifaceId, address, prefixLength,
          gateway](const boost::system::error_code& ec) {
         if (ec)
@@ -814,7 +814,7 @@ inline void deleteAndCreateIPAddress(
         }
         std::string protocol = "xyz.openbmc_project.Network.IP.Protocol.";
         protocol += version == IpVersion::IpV4 ? "IPv4" : "IPv6";
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec2) {
             if (ec2)
             {
@@ -904,7 +904,7 @@ inline void createIPv6(const std::string& ifaceId, uint8_t prefixLength,
     };
     // Passing null for gateway, as per redfish spec IPv6StaticAddresses
     // object does not have associated gateway property
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(createIpHandler), "xyz.openbmc_project.Network", path,
         "xyz.openbmc_project.Network.IP.Create", "IP",
         "xyz.openbmc_project.Network.IP.Protocol.IPv6", address, prefixLength,
@@ -926,7 +926,7 @@ inline void
 {
     sdbusplus::message::object_path path("/xyz/openbmc_project/network");
     path /= gatewayId;
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec) {
         if (ec)
         {
@@ -959,7 +959,7 @@ inline void createIPv6DefaultGateway(
             messages::internalError(asyncResp->res);
         }
     };
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(createIpHandler), "xyz.openbmc_project.Network", path,
         "xyz.openbmc_project.Network.StaticGateway.Create", "StaticGateway",
         gateway, prefixLength, "xyz.openbmc_project.Network.IP.Protocol.IPv6");
@@ -984,7 +984,7 @@ inline void deleteAndCreateIPv6DefaultGateway(
 {
     sdbusplus::message::object_path path("/xyz/openbmc_project/network");
     path /= gatewayId;
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, ifaceId, gateway,
          prefixLength](const boost::system::error_code& ec) {
         if (ec)
@@ -1998,7 +1998,7 @@ inline void afterDelete(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         messages::internalError(asyncResp->res);
         return;
     }
-    BMCWEB_LOG_DEBUG("DBus error: {}", dbusError->name);
+    BMCWEB_LOG_DEBUG_CAT(Dbus, "DBus error: {}", dbusError->name);
 
     if (std::string_view("org.freedesktop.DBus.Error.UnknownObject") ==
         dbusError->name)
@@ -2032,7 +2032,7 @@ inline void afterVlanCreate(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
             messages::internalError(asyncResp->res);
             return;
         }
-        BMCWEB_LOG_DEBUG("DBus error: {}", dbusError->name);
+        BMCWEB_LOG_DEBUG_CAT(Dbus, "DBus error: {}", dbusError->name);
 
         if (std::string_view(
                 "xyz.openbmc_project.Common.Error.ResourceNotFound") ==
@@ -2198,7 +2198,7 @@ inline void requestEthernetInterfacesRoutes(App& app)
 
         std::string vlanInterface = parentInterface + "_" +
                                     std::to_string(vlanId);
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, parentInterfaceUri,
              vlanInterface](const boost::system::error_code& ec,
                             const sdbusplus::message_t& m) {
@@ -2434,7 +2434,7 @@ inline void requestEthernetInterfacesRoutes(App& app)
             return;
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, ifaceId](const boost::system::error_code& ec,
                                  const sdbusplus::message_t& m) {
             afterDelete(asyncResp, ifaceId, ec, m);
@@ -15,6 +15,7 @@
 */
 #pragma once
 #include "app.hpp"
+#include "dbus_utility.hpp"
 #include "event_service_manager.hpp"
 #include "http/utility.hpp"
 #include "logging.hpp"
@@ -200,7 +201,8 @@ inline void doSubscriptionCollection(
             return;
         }
 
-        BMCWEB_LOG_ERROR("D-Bus response error on GetManagedObjects {}", ec);
+        BMCWEB_LOG_ERROR_CAT(
+            Dbus, "D-Bus response error on GetManagedObjects {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -251,7 +253,7 @@ inline void requestRoutesEventDestinationCollection(App& app)
                 "/redfish/v1/EventService/Subscriptions/{}" + id);
             memberArray.emplace_back(std::move(member));
         }
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec,
                         const dbus::utility::ManagedObjectType& resp) {
             doSubscriptionCollection(ec, asyncResp, resp);
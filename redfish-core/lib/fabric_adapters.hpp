@@ -10,7 +10,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -27,8 +26,8 @@ inline void getFabricAdapterLocation(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     const std::string& serviceName, const std::string& fabricAdapterPath)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, serviceName, fabricAdapterPath,
+    dbus::utility::getProperty<std::string>(
+        serviceName, fabricAdapterPath,
         "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& property) {
@@ -36,7 +35,7 @@ inline void getFabricAdapterLocation(
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Location");
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Location");
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -52,8 +51,8 @@ inline void
                           const std::string& serviceName,
                           const std::string& fabricAdapterPath)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, serviceName, fabricAdapterPath,
+    dbus::utility::getAllProperties(
+        serviceName, fabricAdapterPath,
         "xyz.openbmc_project.Inventory.Decorator.Asset",
         [fabricAdapterPath, asyncResp{asyncResp}](
             const boost::system::error_code& ec,
@@ -62,7 +61,8 @@ inline void
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Properties");
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for Properties");
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -111,15 +111,15 @@ inline void
                           const std::string& serviceName,
                           const std::string& fabricAdapterPath)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, serviceName, fabricAdapterPath,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        serviceName, fabricAdapterPath, "xyz.openbmc_project.Inventory.Item",
+        "Present",
         [asyncResp](const boost::system::error_code& ec, const bool present) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for State");
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for State");
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -137,8 +137,8 @@ inline void
                            const std::string& serviceName,
                            const std::string& fabricAdapterPath)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, serviceName, fabricAdapterPath,
+    dbus::utility::getProperty<bool>(
+        serviceName, fabricAdapterPath,
         "xyz.openbmc_project.State.Decorator.OperationalStatus", "Functional",
         [asyncResp](const boost::system::error_code& ec,
                     const bool functional) {
@@ -146,7 +146,7 @@ inline void
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Health");
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Health");
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -242,7 +242,8 @@ inline void afterHandleFabricAdapterGet(
             return;
         }
 
-        BMCWEB_LOG_ERROR("DBus method call failed with error {}", ec.value());
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBus method call failed with error {}",
+                             ec.value());
         messages::internalError(asyncResp->res);
         return;
     }
@@ -366,7 +367,8 @@ inline void afterHandleFabricAdapterHead(
             return;
         }
 
-        BMCWEB_LOG_ERROR("DBus method call failed with error {}", ec.value());
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBus method call failed with error {}",
+                             ec.value());
         messages::internalError(asyncResp->res);
         return;
     }
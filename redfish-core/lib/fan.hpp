@@ -9,7 +9,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/message/types.hpp>
 
 #include <functional>
@@ -68,7 +67,8 @@ inline void getFanPaths(
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR(
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus,
                     "DBUS response error for getAssociatedSubTreePaths {}",
                     ec.value());
                 messages::internalError(asyncResp->res);
@@ -185,8 +185,9 @@ static inline void handleFanPath(
                        const dbus::utility::MapperGetObject& object) {
             if (ec || object.empty())
             {
-                BMCWEB_LOG_ERROR("DBUS response error on getDbusObject {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error on getDbusObject {}",
+                    ec.value());
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -231,16 +232,16 @@ inline void addFanCommonProperties(crow::Response& resp,
 inline void getFanHealth(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                          const std::string& fanPath, const std::string& service)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, fanPath,
+    dbus::utility::getProperty<bool>(
+        service, fanPath,
         "xyz.openbmc_project.State.Decorator.OperationalStatus", "Functional",
         [asyncResp](const boost::system::error_code& ec, const bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Health {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Health {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -256,16 +257,15 @@ inline void getFanHealth(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 inline void getFanState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& fanPath, const std::string& service)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, fanPath,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        service, fanPath, "xyz.openbmc_project.Inventory.Item", "Present",
         [asyncResp](const boost::system::error_code& ec, const bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for State {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for State {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -281,9 +281,8 @@ inline void getFanState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 inline void getFanAsset(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& fanPath, const std::string& service)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, fanPath,
-        "xyz.openbmc_project.Inventory.Decorator.Asset",
+    dbus::utility::getAllProperties(
+        service, fanPath, "xyz.openbmc_project.Inventory.Decorator.Asset",
         [fanPath, asyncResp{asyncResp}](
             const boost::system::error_code& ec,
             const dbus::utility::DBusPropertiesMap& assetList) {
@@ -291,8 +290,8 @@ inline void getFanAsset(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Properties{}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for Properties{}", ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -339,8 +338,8 @@ inline void getFanLocation(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                            const std::string& fanPath,
                            const std::string& service)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, fanPath,
+    dbus::utility::getProperty<std::string>(
+        service, fanPath,
         "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& property) {
@@ -348,8 +347,8 @@ inline void getFanLocation(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Location{}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Location{}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -11,7 +11,6 @@
 #include "utils/json_utils.hpp"
 
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <array>
 #include <optional>
@@ -35,15 +34,15 @@ inline void
     getHypervisorState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
     BMCWEB_LOG_DEBUG("Get hypervisor state information.");
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Hypervisor",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.State.Hypervisor",
         "/xyz/openbmc_project/state/hypervisor0",
         "xyz.openbmc_project.State.Host", "CurrentHostState",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& hostState) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             // This is an optional D-Bus object so just return if
             // error occurs
             return;
@@ -117,7 +116,7 @@ inline void
                 objInfo) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             // This is an optional D-Bus object so just return if
             // error occurs
             return;
@@ -691,8 +690,8 @@ inline void handleHypervisorEthernetInterfaceGet(
 inline void handleHypervisorSystemGet(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/network/hypervisor",
         "xyz.openbmc_project.Network.SystemConfiguration", "HostName",
         [asyncResp](const boost::system::error_code& ec,
@@ -840,7 +839,7 @@ inline void handleHypervisorResetActionGet(
                 objInfo) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
 
             // No hypervisor objects found by mapper
             if (ec.value() == boost::system::errc::io_error)
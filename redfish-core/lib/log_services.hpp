@@ -42,7 +42,6 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/system/linux_error.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -735,7 +734,8 @@ inline void deleteDumpEntry(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                 messages::resourceNotFound(asyncResp->res, "LogEntry", entryID);
                 return;
             }
-            BMCWEB_LOG_ERROR(
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus,
                 "Dump (DBus) doDelete respHandler got error {} entryID={}", ec,
                 entryID);
             messages::internalError(asyncResp->res);
@@ -743,7 +743,7 @@ inline void deleteDumpEntry(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         }
     };
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         respHandler, "xyz.openbmc_project.Dump.Manager",
         std::format("{}/entry/{}", getDumpPath(dumpType), entryID),
         "xyz.openbmc_project.Object.Delete", "Delete");
@@ -791,7 +791,7 @@ inline void
     }
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error: {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error: {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -860,7 +860,7 @@ inline void
         downloadEntryCallback(asyncResp, entryID, dumpType, ec, unixfd);
     };
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(downloadDumpEntryHandler), "xyz.openbmc_project.Dump.Manager",
         dumpEntryPath, "xyz.openbmc_project.Dump.Entry", "GetFileHandle");
 }
@@ -896,7 +896,7 @@ inline void
         downloadEntryCallback(asyncResp, entryID, dumpType, ec, unixfd);
     };
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(downloadEventLogEntryHandler), "xyz.openbmc_project.Logging",
         entryPath, "xyz.openbmc_project.Logging.Entry", "GetEntry");
 }
@@ -969,7 +969,7 @@ inline void createDumpTaskCallback(
         return;
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, payload = std::move(payload), createdObjPath,
          dumpEntryPath{std::move(dumpEntryPath)},
          dumpId](const boost::system::error_code& ec,
@@ -1167,7 +1167,7 @@ inline void createDump(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
             "xyz.openbmc_project.Common.OriginatedBy.OriginatorTypes.Client");
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, payload(task::Payload(req)),
          dumpPath](const boost::system::error_code& ec,
                    const sdbusplus::message_t& msg,
@@ -1182,8 +1182,9 @@ inline void createDump(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                 return;
             }
 
-            BMCWEB_LOG_ERROR("CreateDump DBus error: {} and error msg: {}",
-                             dbusError->name, dbusError->message);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "CreateDump DBus error: {} and error msg: {}",
+                dbusError->name, dbusError->message);
             if (std::string_view(
                     "xyz.openbmc_project.Common.Error.NotAllowed") ==
                 dbusError->name)
@@ -1225,7 +1226,7 @@ inline void createDump(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 inline void clearDump(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                       const std::string& dumpType)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec) {
         if (ec)
         {
@@ -1460,7 +1461,7 @@ inline void requestRoutesJournalEventLogClear(App& app)
         }
 
         // Reload rsyslog so it knows to start new log files
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec) {
             if (ec)
             {
@@ -1983,8 +1984,8 @@ inline void requestRoutesDBusEventLogEntry(App& app)
 
         // DBus implementation of EventLog/Entries
         // Make call to Logging Service to find all log entry objects
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, "xyz.openbmc_project.Logging",
+        dbus::utility::getAllProperties(
+            "xyz.openbmc_project.Logging",
             "/xyz/openbmc_project/logging/entry/" + entryID, "",
             [asyncResp, entryID](const boost::system::error_code& ec,
                                  const dbus::utility::DBusPropertiesMap& resp) {
@@ -1996,8 +1997,8 @@ inline void requestRoutesDBusEventLogEntry(App& app)
             }
             if (ec)
             {
-                BMCWEB_LOG_ERROR(
-                    "EventLogEntry (DBus) resp_handler got error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "EventLogEntry (DBus) resp_handler got error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -2152,7 +2153,8 @@ inline void requestRoutesDBusEventLogEntry(App& app)
                     return;
                 }
                 // TODO Handle for specific error code
-                BMCWEB_LOG_ERROR(
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus,
                     "EventLogEntry (DBus) doDelete respHandler got error {}",
                     ec);
                 asyncResp->res.result(
@@ -2164,7 +2166,7 @@ inline void requestRoutesDBusEventLogEntry(App& app)
         };
 
         // Make call to Logging service to request Delete Log
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             respHandler, "xyz.openbmc_project.Logging",
             "/xyz/openbmc_project/logging/entry/" + entryID,
             "xyz.openbmc_project.Object.Delete", "Delete");
@@ -3444,7 +3446,7 @@ void inline requestRoutesCrashdumpClear(App& app)
                                        systemName);
             return;
         }
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec,
                         const std::string&) {
             if (ec)
@@ -3523,9 +3525,9 @@ static void
             logEntryJson.update(logEntry);
         }
     };
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, crashdumpObject,
-        crashdumpPath + std::string("/") + logID, crashdumpInterface,
+    dbus::utility::getAllProperties(
+        crashdumpObject, crashdumpPath + std::string("/") + logID,
+        crashdumpInterface,
         std::move(getStoredLogCallback));
 }
 
@@ -3719,9 +3721,9 @@ inline void requestRoutesCrashdumpFile(App& app)
             asyncResp->res.addHeader(
                 boost::beast::http::field::content_disposition, "attachment");
         };
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, crashdumpObject,
-            crashdumpPath + std::string("/") + logID, crashdumpInterface,
+        dbus::utility::getAllProperties(
+            crashdumpObject, crashdumpPath + std::string("/") + logID,
+            crashdumpInterface,
             std::move(getStoredLogCallback));
     });
 }
@@ -3873,7 +3875,7 @@ inline void requestRoutesCrashdumpCollect(App& app)
             task->payload.emplace(std::move(payload));
         };
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             std::move(collectCrashdumpCallback), crashdumpObject, crashdumpPath,
             iface, method);
     });
@@ -3933,7 +3935,7 @@ inline void requestRoutesDBusLogServiceActionsClear(App& app)
         };
 
         // Make call to Logging service to request Clear Log
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             respHandler, "xyz.openbmc_project.Logging",
             "/xyz/openbmc_project/logging",
             "xyz.openbmc_project.Collection.DeleteAll", "DeleteAll");
@@ -4027,7 +4029,7 @@ inline void requestRoutesPostCodesClear(App& app)
         BMCWEB_LOG_DEBUG("Do delete all postcodes entries.");
 
         // Make call to post-code service to request clear all
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec) {
             if (ec)
             {
@@ -4246,7 +4248,7 @@ static void
         return;
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, entryId, bootIndex,
          codeIndex](const boost::system::error_code& ec,
                     const boost::container::flat_map<
@@ -4254,7 +4256,8 @@ static void
                         postcode) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS POST CODE PostCode response error");
+            BMCWEB_LOG_DEBUG_CAT(
+                Dbus, "DBUS POST CODE PostCode response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -4282,7 +4285,7 @@ static void
                        const uint16_t bootIndex, const uint16_t bootCount,
                        const uint64_t entryCount, size_t skip, size_t top)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, bootIndex, bootCount, entryCount, skip,
          top](const boost::system::error_code& ec,
               const boost::container::flat_map<
@@ -4290,7 +4293,8 @@ static void
                   postcode) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS POST CODE PostCode response error");
+            BMCWEB_LOG_DEBUG_CAT(
+                Dbus, "DBUS POST CODE PostCode response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -4340,8 +4344,7 @@ static void
                          size_t skip, size_t top)
 {
     uint64_t entryCount = 0;
-    sdbusplus::asio::getProperty<uint16_t>(
-        *crow::connections::systemBus,
+    dbus::utility::getProperty<uint16_t>(
         "xyz.openbmc_project.State.Boot.PostCode0",
         "/xyz/openbmc_project/State/Boot/PostCode0",
         "xyz.openbmc_project.State.Boot.PostCode", "CurrentBootCycleCount",
@@ -4349,7 +4352,7 @@ static void
                                            const uint16_t bootCount) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -4450,7 +4453,7 @@ inline void requestRoutesPostCodesEntryAdditionalData(App& app)
             return;
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, postCodeID, currentValue](
                 const boost::system::error_code& ec,
                 const std::vector<std::tuple<uint64_t, std::vector<uint8_t>>>&
@@ -4463,7 +4466,7 @@ inline void requestRoutesPostCodesEntryAdditionalData(App& app)
             }
             if (ec)
             {
-                BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+                BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -30,7 +30,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <algorithm>
@@ -63,14 +62,13 @@ inline void
     const char* destProperty = "RequestedBMCTransition";
 
     // Create the D-Bus variant for D-Bus call.
-    sdbusplus::asio::setProperty(
-        *crow::connections::systemBus, processName, objectPath, interfaceName,
-        destProperty, propertyValue,
+    dbus::utility::setProperty(
+        processName, objectPath, interfaceName, destProperty, propertyValue,
         [asyncResp](const boost::system::error_code& ec) {
         // Use "Set" method to set the property value.
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("[Set] Bad D-Bus request error: {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "[Set] Bad D-Bus request error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -90,14 +88,13 @@ inline void
     const char* destProperty = "RequestedBMCTransition";
 
     // Create the D-Bus variant for D-Bus call.
-    sdbusplus::asio::setProperty(
-        *crow::connections::systemBus, processName, objectPath, interfaceName,
-        destProperty, propertyValue,
+    dbus::utility::setProperty(
+        processName, objectPath, interfaceName, destProperty, propertyValue,
         [asyncResp](const boost::system::error_code& ec) {
         // Use "Set" method to set the property value.
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("[Set] Bad D-Bus request error: {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "[Set] Bad D-Bus request error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -233,7 +230,7 @@ inline void requestRoutesManagerResetToDefaultsAction(App& app)
             return;
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec) {
             if (ec)
             {
@@ -839,7 +836,7 @@ inline CreatePIDRet createPidInterface(
 
         BMCWEB_LOG_DEBUG("del {} {}", path, iface);
         // delete interface
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [response, path](const boost::system::error_code& ec) {
             if (ec)
             {
@@ -1231,8 +1228,8 @@ struct GetPIDValues : std::enable_shared_from_this<GetPIDValues>
             const std::string& path = subtreeLocal[0].first;
             const std::string& owner = subtreeLocal[0].second[0].first;
 
-            sdbusplus::asio::getAllProperties(
-                *crow::connections::systemBus, owner, path, thermalModeIface,
+            dbus::utility::getAllProperties(
+                owner, path, thermalModeIface,
                 [path, owner,
                  self](const boost::system::error_code& ec2,
                        const dbus::utility::DBusPropertiesMap& resp) {
@@ -1427,8 +1424,8 @@ struct SetPIDValues : std::enable_shared_from_this<SetPIDValues>
 
             const std::string& path = subtree[0].first;
             const std::string& owner = subtree[0].second[0].first;
-            sdbusplus::asio::getAllProperties(
-                *crow::connections::systemBus, owner, path, thermalModeIface,
+            dbus::utility::getAllProperties(
+                owner, path, thermalModeIface,
                 [self, path, owner](const boost::system::error_code& ec2,
                                     const dbus::utility::DBusPropertiesMap& r) {
                 if (ec2)
@@ -1482,9 +1479,9 @@ struct SetPIDValues : std::enable_shared_from_this<SetPIDValues>
                 return;
             }
             currentProfile = *profile;
-            sdbusplus::asio::setProperty(
-                *crow::connections::systemBus, profileConnection, profilePath,
-                thermalModeIface, "Current", *profile,
+            dbus::utility::setProperty(
+                profileConnection, profilePath, thermalModeIface, "Current",
+                *profile,
                 [response](const boost::system::error_code& ec) {
                 if (ec)
                 {
@@ -1610,7 +1607,7 @@ struct SetPIDValues : std::enable_shared_from_this<SetPIDValues>
                 {
                     for (const auto& property : output)
                     {
-                        crow::connections::systemBus->async_method_call(
+                        dbus::utility::asyncMethodCall(
                             [response,
                              propertyName{std::string(property.first)}](
                                 const boost::system::error_code& ec) {
@@ -1649,7 +1646,8 @@ struct SetPIDValues : std::enable_shared_from_this<SetPIDValues>
                     }
                     if (!foundChassis)
                     {
-                        BMCWEB_LOG_ERROR("Failed to find chassis on dbus");
+                        BMCWEB_LOG_ERROR_CAT(
+                            Dbus, "Failed to find chassis on dbus");
                         messages::resourceMissingAtURI(
                             response->res,
                             boost::urls::format("/redfish/v1/Chassis/{}",
@@ -1657,7 +1655,7 @@ struct SetPIDValues : std::enable_shared_from_this<SetPIDValues>
                         return;
                     }
 
-                    crow::connections::systemBus->async_method_call(
+                    dbus::utility::asyncMethodCall(
                         [response](const boost::system::error_code& ec) {
                         if (ec)
                         {
@@ -1712,15 +1710,14 @@ inline void getLocation(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     BMCWEB_LOG_DEBUG("Get BMC manager Location data.");
 
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, connectionName, path,
+    dbus::utility::getProperty<std::string>(
+        connectionName, path,
         "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& property) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error for "
-                             "Location");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error for " "Location");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1735,15 +1732,14 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Getting Manager Last Reset Time");
 
-    sdbusplus::asio::getProperty<uint64_t>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.BMC",
-        "/xyz/openbmc_project/state/bmc0", "xyz.openbmc_project.State.BMC",
-        "LastRebootTime",
+    dbus::utility::getProperty<uint64_t>(
+        "xyz.openbmc_project.State.BMC", "/xyz/openbmc_project/state/bmc0",
+        "xyz.openbmc_project.State.BMC", "LastRebootTime",
         [asyncResp](const boost::system::error_code& ec,
                     const uint64_t lastResetTime) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("D-BUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "D-BUS response error {}", ec);
             return;
         }
 
@@ -1797,7 +1793,7 @@ inline void
             const dbus::utility::ManagedObjectType& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("D-Bus response error getting objects.");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "D-Bus response error getting objects.");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1848,8 +1844,7 @@ inline void
         // Only support Immediate
         // An addition could be a Redfish Setting like
         // ActiveSoftwareImageApplyTime and support OnReset
-        sdbusplus::asio::setProperty(
-            *crow::connections::systemBus,
+        dbus::utility::setProperty(
             "xyz.openbmc_project.Software.BMC.Updater",
             "/xyz/openbmc_project/software/" + firmwareId,
             "xyz.openbmc_project.Software.RedundancyPriority", "Priority",
@@ -1857,7 +1852,7 @@ inline void
             [asyncResp](const boost::system::error_code& ec2) {
             if (ec2)
             {
-                BMCWEB_LOG_DEBUG("D-Bus response error setting.");
+                BMCWEB_LOG_DEBUG_CAT(Dbus, "D-Bus response error setting.");
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -1873,8 +1868,8 @@ inline void
 {
     if (ec)
     {
-        BMCWEB_LOG_DEBUG("Failed to set elapsed time. DBUS response error {}",
-                         ec);
+        BMCWEB_LOG_DEBUG_CAT(
+            Dbus, "Failed to set elapsed time. DBUS response error {}", ec);
         const sd_bus_error* dbusError = msg.get_error();
         if (dbusError != nullptr)
         {
@@ -1911,7 +1906,7 @@ inline void setDateTime(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     // Set the absolute datetime
     bool relative = false;
     bool interactive = false;
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec,
                     const sdbusplus::message_t& msg) {
         afterSetDateTime(asyncResp, ec, msg);
@@ -1924,8 +1919,8 @@ inline void setDateTime(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 inline void
     checkForQuiesced(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "org.freedesktop.systemd1",
+    dbus::utility::getProperty<std::string>(
+        "org.freedesktop.systemd1",
         "/org/freedesktop/systemd1/unit/obmc-bmc-service-quiesce@0.target",
         "org.freedesktop.systemd1.Unit", "ActiveState",
         [asyncResp](const boost::system::error_code& ec,
@@ -2110,10 +2105,9 @@ inline void requestRoutesManager(App& app)
                 chassiUrl;
         });
 
-        sdbusplus::asio::getProperty<double>(
-            *crow::connections::systemBus, "org.freedesktop.systemd1",
-            "/org/freedesktop/systemd1", "org.freedesktop.systemd1.Manager",
-            "Progress",
+        dbus::utility::getProperty<double>(
+            "org.freedesktop.systemd1", "/org/freedesktop/systemd1",
+            "org.freedesktop.systemd1.Manager", "Progress",
             [asyncResp](const boost::system::error_code& ec, double val) {
             if (ec)
             {
@@ -2139,7 +2133,8 @@ inline void requestRoutesManager(App& app)
                 const dbus::utility::MapperGetSubTreeResponse& subtree) {
             if (ec)
             {
-                BMCWEB_LOG_DEBUG("D-Bus response error on GetSubTree {}", ec);
+                BMCWEB_LOG_DEBUG_CAT(
+                    Dbus, "D-Bus response error on GetSubTree {}", ec);
                 return;
             }
             if (subtree.empty())
@@ -2158,7 +2153,7 @@ inline void requestRoutesManager(App& app)
 
             if (subtree[0].first.empty() || subtree[0].second.size() != 1)
             {
-                BMCWEB_LOG_DEBUG("Error getting bmc D-Bus object!");
+                BMCWEB_LOG_DEBUG_CAT(Dbus, "Error getting bmc D-Bus object!");
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -2171,8 +2166,8 @@ inline void requestRoutesManager(App& app)
                 if (interfaceName ==
                     "xyz.openbmc_project.Inventory.Decorator.Asset")
                 {
-                    sdbusplus::asio::getAllProperties(
-                        *crow::connections::systemBus, connectionName, path,
+                    dbus::utility::getAllProperties(
+                        connectionName, path,
                         "xyz.openbmc_project.Inventory.Decorator.Asset",
                         [asyncResp](const boost::system::error_code& ec2,
                                     const dbus::utility::DBusPropertiesMap&
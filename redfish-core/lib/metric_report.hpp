@@ -9,7 +9,6 @@
 #include "utils/time_utils.hpp"
 
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <array>
 #include <string_view>
@@ -98,7 +97,7 @@ inline void requestRoutesMetricReport(App& app)
             return;
         }
         const std::string reportPath = telemetry::getDbusReportPath(id);
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, id, reportPath](const boost::system::error_code& ec) {
             if (ec.value() == EBADR ||
                 ec == boost::system::errc::host_unreachable)
@@ -108,19 +107,20 @@ inline void requestRoutesMetricReport(App& app)
             }
             if (ec)
             {
-                BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
 
-            sdbusplus::asio::getProperty<telemetry::TimestampReadings>(
-                *crow::connections::systemBus, telemetry::service, reportPath,
-                telemetry::reportInterface, "Readings",
+            dbus::utility::getProperty<telemetry::TimestampReadings>(
+                telemetry::service, reportPath, telemetry::reportInterface,
+                "Readings",
                 [asyncResp, id](const boost::system::error_code& ec2,
                                 const telemetry::TimestampReadings& ret) {
                 if (ec2)
                 {
-                    BMCWEB_LOG_ERROR("respHandler DBus error {}", ec2);
+                    BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}",
+                                         ec2);
                     messages::internalError(asyncResp->res);
                     return;
                 }
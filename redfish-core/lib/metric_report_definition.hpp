@@ -14,7 +14,6 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -62,7 +61,7 @@ inline bool verifyCommonErrors(crow::Response& res, const std::string& id,
 
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(res);
         return false;
     }
@@ -692,7 +691,8 @@ class AddReport
                 auto el = uriToDbus.find(uri);
                 if (el == uriToDbus.end())
                 {
-                    BMCWEB_LOG_ERROR(
+                    BMCWEB_LOG_ERROR_CAT(
+                        Dbus,
                         "Failed to find DBus sensor corresponding to URI {}",
                         uri);
                     messages::propertyValueNotInList(asyncResp->res, uri,
@@ -710,7 +710,7 @@ class AddReport
                 metric.collectionTimeScope, metric.collectionDuration);
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, id = args.id, uriToDbus](
                 const boost::system::error_code& ec, const std::string&) {
             if (ec == boost::system::errc::file_exists)
@@ -738,7 +738,7 @@ class AddReport
             if (ec)
             {
                 messages::internalError(asyncResp->res);
-                BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
                 return;
             }
 
@@ -843,7 +843,7 @@ class UpdateMetrics
             std::get<0>(readingParams[index]) = *readingParam;
         }
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp(this->asyncResp),
              reportId = id](const boost::system::error_code& ec) {
             if (!verifyCommonErrors(asyncResp->res, reportId, ec))
@@ -889,7 +889,7 @@ inline void
     setReportEnabled(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                      std::string_view id, bool enabled)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id = std::string(id)](const boost::system::error_code& ec) {
         if (!verifyCommonErrors(asyncResp->res, id, ec))
         {
@@ -906,7 +906,7 @@ inline void setReportTypeAndInterval(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp, std::string_view id,
     const std::string& reportingType, uint64_t recurrenceInterval)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id = std::string(id)](const boost::system::error_code& ec) {
         if (!verifyCommonErrors(asyncResp->res, id, ec))
         {
@@ -922,7 +922,7 @@ inline void
     setReportUpdates(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                      std::string_view id, const std::string& reportUpdates)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id = std::string(id)](const boost::system::error_code& ec) {
         if (!verifyCommonErrors(asyncResp->res, id, ec))
         {
@@ -940,7 +940,7 @@ inline void
                      std::string_view id,
                      const std::vector<std::string>& dbusReportActions)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id = std::string(id)](const boost::system::error_code& ec) {
         if (!verifyCommonErrors(asyncResp->res, id, ec))
         {
@@ -958,9 +958,9 @@ inline void
                      std::string_view id,
                      std::span<nlohmann::json::object_t> metrics)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, telemetry::service,
-        telemetry::getDbusReportPath(id), telemetry::reportInterface,
+    dbus::utility::getAllProperties(
+        telemetry::service, telemetry::getDbusReportPath(id),
+        telemetry::reportInterface,
         [asyncResp, id = std::string(id),
          redfishMetrics = std::vector<nlohmann::json::object_t>(metrics.begin(),
                                                                 metrics.end())](
@@ -1036,7 +1036,8 @@ inline void
                     const std::map<std::string, std::string>& uriToDbus) {
                 if (status != boost::beast::http::status::ok)
                 {
-                    BMCWEB_LOG_ERROR(
+                    BMCWEB_LOG_ERROR_CAT(
+                        Dbus,
                         "Failed to retrieve URI to dbus sensors map with err {}",
                         static_cast<unsigned>(status));
                     return;
@@ -1194,7 +1195,7 @@ inline void
 
     const std::string reportPath = getDbusReportPath(id);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp,
          reportId = std::string(id)](const boost::system::error_code& ec) {
         if (!verifyCommonErrors(asyncResp->res, reportId, ec))
@@ -1215,8 +1216,8 @@ inline void afterRetrieveUriToDbusMap(
 {
     if (status != boost::beast::http::status::ok)
     {
-        BMCWEB_LOG_ERROR(
-            "Failed to retrieve URI to dbus sensors map with err {}",
+        BMCWEB_LOG_ERROR_CAT(
+            Dbus, "Failed to retrieve URI to dbus sensors map with err {}",
             static_cast<unsigned>(status));
         return;
     }
@@ -1283,9 +1284,9 @@ inline void
         boost::beast::http::field::link,
         "</redfish/v1/JsonSchemas/MetricReport/MetricReport.json>; rel=describedby");
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, telemetry::service,
-        telemetry::getDbusReportPath(id), telemetry::reportInterface,
+    dbus::utility::getAllProperties(
+        telemetry::service, telemetry::getDbusReportPath(id),
+        telemetry::reportInterface,
         [asyncResp, id](const boost::system::error_code& ec,
                         const dbus::utility::DBusPropertiesMap& properties) {
         if (!redfish::telemetry::verifyCommonErrors(asyncResp->res, id, ec))
@@ -1309,7 +1310,7 @@ inline void handleMetricReportDelete(
 
     const std::string reportPath = telemetry::getDbusReportPath(id);
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id](const boost::system::error_code& ec) {
         /*
          * boost::system::errc and std::errc are missing value
@@ -1324,7 +1325,7 @@ inline void handleMetricReportDelete(
 
         if (ec)
         {
-            BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -26,7 +26,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <array>
 #include <optional>
@@ -246,8 +245,8 @@ inline void afterSetNTP(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     if (ec)
     {
-        BMCWEB_LOG_DEBUG("Failed to set elapsed time. DBUS response error {}",
-                         ec);
+        BMCWEB_LOG_DEBUG_CAT(
+            Dbus, "Failed to set elapsed time. DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -261,7 +260,7 @@ inline void handleNTPProtocolEnabled(
     auto callback = [asyncResp](const boost::system::error_code& ec) {
         afterSetNTP(asyncResp, ec);
     };
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         std::move(callback), "org.freedesktop.timedate1",
         "/org/freedesktop/timedate1", "org.freedesktop.timedate1", "SetNTP",
         ntpEnabled, interactive);
@@ -352,7 +351,8 @@ inline void
             const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_WARNING("D-Bus error: {}, {}", ec, ec.message());
+            BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus error: {}, {}", ec,
+                                   ec.message());
             messages::internalError(asyncResp->res);
             return;
         }
@@ -430,9 +430,9 @@ inline std::string getHostName()
 inline void
     getNTPProtocolEnabled(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "org.freedesktop.timedate1",
-        "/org/freedesktop/timedate1", "org.freedesktop.timedate1", "NTP",
+    dbus::utility::getProperty<bool>(
+        "org.freedesktop.timedate1", "/org/freedesktop/timedate1",
+        "org.freedesktop.timedate1", "NTP",
         [asyncResp](const boost::system::error_code& ec, bool enabled) {
         if (ec)
         {
@@ -26,7 +26,6 @@
 
 #include <boost/system/linux_error.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <limits>
@@ -64,7 +63,7 @@ static inline void handlePCIeDevicePath(
                        const dbus::utility::MapperGetObject& object) {
             if (ec || object.empty())
             {
-                BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -91,7 +90,8 @@ static inline void getValidPCIeDevicePath(
                        pcieDevicePaths) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("D-Bus response error on GetSubTree {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "D-Bus response error on GetSubTree {}",
+                                 ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -155,8 +155,8 @@ inline void addPCIeSlotProperties(
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error for getAllProperties{}",
-                         ec.value());
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for getAllProperties{}",
+                             ec.value());
         messages::internalError(res);
         return;
     }
@@ -233,8 +233,8 @@ inline void getPCIeDeviceSlotPath(
                 // Missing association is not an error
                 return;
             }
-            BMCWEB_LOG_ERROR(
-                "DBUS response error for getAssociatedSubTreePaths {}",
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "DBUS response error for getAssociatedSubTreePaths {}",
                 ec.value());
             messages::internalError(asyncResp->res);
             return;
@@ -266,13 +266,13 @@ inline void
 {
     if (ec || object.empty())
     {
-        BMCWEB_LOG_ERROR("DBUS response error for getDbusObject {}",
-                         ec.value());
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for getDbusObject {}",
+                             ec.value());
         messages::internalError(asyncResp->res);
         return;
     }
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, object.begin()->first, pcieDeviceSlot,
+    dbus::utility::getAllProperties(
+        object.begin()->first, pcieDeviceSlot,
         "xyz.openbmc_project.Inventory.Item.PCIeSlot",
         [asyncResp](
             const boost::system::error_code& ec2,
@@ -299,16 +299,16 @@ inline void
                         const std::string& pcieDevicePath,
                         const std::string& service)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, pcieDevicePath,
+    dbus::utility::getProperty<bool>(
+        service, pcieDevicePath,
         "xyz.openbmc_project.State.Decorator.OperationalStatus", "Functional",
         [asyncResp](const boost::system::error_code& ec, const bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Health {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Health {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -326,15 +326,15 @@ inline void
                        const std::string& pcieDevicePath,
                        const std::string& service)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, pcieDevicePath,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        service, pcieDevicePath, "xyz.openbmc_project.Inventory.Item",
+        "Present",
         [asyncResp](const boost::system::error_code& ec, bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for State");
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for State");
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -352,8 +352,8 @@ inline void
                        const std::string& pcieDevicePath,
                        const std::string& service)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, pcieDevicePath,
+    dbus::utility::getAllProperties(
+        service, pcieDevicePath,
         "xyz.openbmc_project.Inventory.Decorator.Asset",
         [pcieDevicePath, asyncResp{asyncResp}](
             const boost::system::error_code& ec,
@@ -362,8 +362,8 @@ inline void
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Properties{}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for Properties{}", ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -514,8 +514,8 @@ inline void getPCIeDeviceProperties(
     const std::function<void(
         const dbus::utility::DBusPropertiesMap& pcieDevProperties)>&& callback)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, pcieDevicePath,
+    dbus::utility::getAllProperties(
+        service, pcieDevicePath,
         "xyz.openbmc_project.Inventory.Item.PCIeDevice",
         [asyncResp,
          callback](const boost::system::error_code& ec,
@@ -524,7 +524,8 @@ inline void getPCIeDeviceProperties(
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Properties");
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for Properties");
                 messages::internalError(asyncResp->res);
             }
             return;
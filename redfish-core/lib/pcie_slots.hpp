@@ -13,7 +13,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -128,7 +127,7 @@ inline void onMapperAssociationDone(
             // This PCIeSlot have no chassis association.
             return;
         }
-        BMCWEB_LOG_ERROR("DBUS response error");
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error");
         messages::internalError(asyncResp->res);
         return;
     }
@@ -148,8 +147,8 @@ inline void onMapperAssociationDone(
         return;
     }
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, connectionName, pcieSlotPath,
+    dbus::utility::getAllProperties(
+        connectionName, pcieSlotPath,
         "xyz.openbmc_project.Inventory.Item.PCIeSlot",
         [asyncResp](const boost::system::error_code& ec2,
                     const dbus::utility::DBusPropertiesMap& propertiesList) {
@@ -165,7 +164,7 @@ inline void
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("D-Bus response error on GetSubTree {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "D-Bus response error on GetSubTree {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
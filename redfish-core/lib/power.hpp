@@ -24,7 +24,6 @@
 #include "utils/chassis_utils.hpp"
 #include "utils/json_utils.hpp"
 
-#include <sdbusplus/asio/property.hpp>
 
 #include <array>
 #include <string>
@@ -42,7 +41,8 @@ inline void afterGetPowerCapEnable(
     if (ec)
     {
         messages::internalError(sensorsAsyncResp->asyncResp->res);
-        BMCWEB_LOG_ERROR("powerCapEnable Get handler: Dbus error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "powerCapEnable Get handler: Dbus error {}",
+                             ec);
         return;
     }
     if (!powerCapEnable)
@@ -95,8 +95,8 @@ inline void afterGetChassisPath(
     {
         return;
     }
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<bool>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/power_cap",
         "xyz.openbmc_project.Control.Power.Cap", "PowerCapEnable",
         std::bind_front(afterGetPowerCapEnable, sensorsAsyncResp, *value));
@@ -110,7 +110,8 @@ inline void afterPowerCapSettingGet(
     if (ec)
     {
         messages::internalError(sensorAsyncResp->asyncResp->res);
-        BMCWEB_LOG_ERROR("Power Limit GetAll handler: Dbus error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "Power Limit GetAll handler: Dbus error {}",
+                             ec);
         return;
     }
 
@@ -202,8 +203,8 @@ inline void
 {
     if (ec2)
     {
-        BMCWEB_LOG_ERROR("Power Limit GetSubTreePaths handler Dbus error {}",
-                         ec2);
+        BMCWEB_LOG_ERROR_CAT(
+            Dbus, "Power Limit GetSubTreePaths handler Dbus error {}", ec2);
         return;
     }
 
@@ -244,8 +245,8 @@ inline void
         return;
     }
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/power_cap",
         "xyz.openbmc_project.Control.Power.Cap",
         [sensorAsyncResp](const boost::system::error_code& ec,
@@ -82,7 +82,7 @@ inline void
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error{}", ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error{}", ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -171,8 +171,8 @@ inline void getValidPowerSupplyPath(
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR(
-                    "DBUS response error for getAssociatedSubTreePaths{}",
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for getAssociatedSubTreePaths{}",
                     ec.value());
                 messages::internalError(asyncResp->res);
                 return;
@@ -205,16 +205,15 @@ inline void
     getPowerSupplyState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        service, path, "xyz.openbmc_project.Inventory.Item", "Present",
         [asyncResp](const boost::system::error_code& ec, const bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for State {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for State {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -231,16 +230,16 @@ inline void
     getPowerSupplyHealth(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                          const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.State.Decorator.OperationalStatus", "Functional",
+    dbus::utility::getProperty<bool>(
+        service, path, "xyz.openbmc_project.State.Decorator.OperationalStatus",
+        "Functional",
         [asyncResp](const boost::system::error_code& ec, const bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Health {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Health {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -257,17 +256,16 @@ inline void
     getPowerSupplyAsset(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Decorator.Asset",
+    dbus::utility::getAllProperties(
+        service, path, "xyz.openbmc_project.Inventory.Decorator.Asset",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& propertiesList) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Asset {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error for Asset {}",
+                                     ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -322,17 +320,17 @@ inline void getPowerSupplyFirmwareVersion(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Software.Version", "Version",
+    dbus::utility::getProperty<std::string>(
+        service, path, "xyz.openbmc_project.Software.Version", "Version",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for FirmwareVersion {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for FirmwareVersion {}",
+                    ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -345,17 +343,17 @@ inline void
     getPowerSupplyLocation(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                            const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
+    dbus::utility::getProperty<std::string>(
+        service, path, "xyz.openbmc_project.Inventory.Decorator.LocationCode",
+        "LocationCode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error for Location {}",
-                                 ec.value());
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error for Location {}", ec.value());
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -373,8 +371,8 @@ inline void handleGetEfficiencyResponse(
     {
         if (ec.value() != EBADR)
         {
-            BMCWEB_LOG_ERROR("DBUS response error for DeratingFactor {}",
-                             ec.value());
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "DBUS response error for DeratingFactor {}", ec.value());
             messages::internalError(asyncResp->res);
         }
         return;
@@ -402,8 +400,9 @@ inline void handlePowerSupplyAttributesSubTreeResponse(
     {
         if (ec.value() != EBADR)
         {
-            BMCWEB_LOG_ERROR("DBUS response error for EfficiencyPercent {}",
-                             ec.value());
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "DBUS response error for EfficiencyPercent {}",
+                ec.value());
             messages::internalError(asyncResp->res);
         }
         return;
@@ -426,9 +425,9 @@ inline void handlePowerSupplyAttributesSubTreeResponse(
 
     const auto& [path, serviceMap] = *subtree.begin();
     const auto& [service, interfaces] = *serviceMap.begin();
-    sdbusplus::asio::getProperty<uint32_t>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Control.PowerSupplyAttributes", "DeratingFactor",
+    dbus::utility::getProperty<uint32_t>(
+        service, path, "xyz.openbmc_project.Control.PowerSupplyAttributes",
+        "DeratingFactor",
         [asyncResp](const boost::system::error_code& ec1, uint32_t value) {
         handleGetEfficiencyResponse(asyncResp, ec1, value);
     });
@@ -29,7 +29,6 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/message/native_types.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 #include <sdbusplus/utility/dedup_variant.hpp>
@@ -61,14 +60,13 @@ inline void getProcessorUUID(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                              const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG("Get Processor UUID");
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, objPath,
-        "xyz.openbmc_project.Common.UUID", "UUID",
+    dbus::utility::getProperty<std::string>(
+        service, objPath, "xyz.openbmc_project.Common.UUID", "UUID",
         [objPath, asyncResp{std::move(asyncResp)}](
             const boost::system::error_code& ec, const std::string& property) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -234,7 +232,7 @@ inline void getCpuDataByService(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
             const dbus::utility::ManagedObjectType& dbusData) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -373,9 +371,8 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Get processor throttle resources");
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objectPath,
-        "xyz.openbmc_project.Control.Power.Throttle",
+    dbus::utility::getAllProperties(
+        service, objectPath, "xyz.openbmc_project.Control.Power.Throttle",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& properties) {
         readThrottleProperties(asyncResp, ec, properties);
@@ -387,15 +384,14 @@ inline void getCpuAssetData(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                             const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG("Get Cpu Asset Data");
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objPath,
-        "xyz.openbmc_project.Inventory.Decorator.Asset",
+    dbus::utility::getAllProperties(
+        service, objPath, "xyz.openbmc_project.Inventory.Decorator.Asset",
         [objPath, asyncResp{std::move(asyncResp)}](
             const boost::system::error_code& ec,
             const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -461,15 +457,14 @@ inline void getCpuRevisionData(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                                const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG("Get Cpu Revision Data");
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objPath,
-        "xyz.openbmc_project.Inventory.Decorator.Revision",
+    dbus::utility::getAllProperties(
+        service, objPath, "xyz.openbmc_project.Inventory.Decorator.Revision",
         [objPath, asyncResp{std::move(asyncResp)}](
             const boost::system::error_code& ec,
             const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -497,14 +492,14 @@ inline void getAcceleratorDataByService(
     const std::string& service, const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG("Get available system Accelerator resources by service.");
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objPath, "",
+    dbus::utility::getAllProperties(
+        service, objPath, "",
         [acclrtrId, asyncResp{std::move(asyncResp)}](
             const boost::system::error_code& ec,
             const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -610,15 +605,16 @@ inline void
     BMCWEB_LOG_INFO("Getting CPU operating configs for {}", cpuId);
 
     // First, GetAll CurrentOperatingConfig properties on the object
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objPath,
+    dbus::utility::getAllProperties(
+        service, objPath,
         "xyz.openbmc_project.Control.Processor.CurrentOperatingConfig",
         [asyncResp, cpuId,
          service](const boost::system::error_code& ec,
                   const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_WARNING("D-Bus error: {}, {}", ec, ec.message());
+            BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus error: {}, {}", ec,
+                                   ec.message());
             messages::internalError(asyncResp->res);
             return;
         }
@@ -670,8 +666,8 @@ inline void
             // Once we found the current applied config, queue another
             // request to read the base freq core ids out of that
             // config.
-            sdbusplus::asio::getProperty<BaseSpeedPrioritySettingsProperty>(
-                *crow::connections::systemBus, service, dbusPath,
+            dbus::utility::getProperty<BaseSpeedPrioritySettingsProperty>(
+                service, dbusPath,
                 "xyz.openbmc_project.Inventory.Item.Cpu."
                 "OperatingConfig",
                 "BaseSpeedPrioritySettings",
@@ -680,7 +676,8 @@ inline void
                     const BaseSpeedPrioritySettingsProperty& baseSpeedList) {
                 if (ec2)
                 {
-                    BMCWEB_LOG_WARNING("D-Bus Property Get error: {}", ec2);
+                    BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus Property Get error: {}",
+                                           ec2);
                     messages::internalError(asyncResp->res);
                     return;
                 }
@@ -710,14 +707,14 @@ inline void getCpuLocationCode(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                                const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG("Get Cpu Location Data");
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, objPath,
+    dbus::utility::getProperty<std::string>(
+        service, objPath,
         "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode",
         [objPath, asyncResp{std::move(asyncResp)}](
             const boost::system::error_code& ec, const std::string& property) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             messages::internalError(asyncResp->res);
             return;
         }
@@ -740,8 +737,8 @@ inline void getCpuUniqueId(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                            const std::string& objectPath)
 {
     BMCWEB_LOG_DEBUG("Get CPU UniqueIdentifier");
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, service, objectPath,
+    dbus::utility::getProperty<std::string>(
+        service, objectPath,
         "xyz.openbmc_project.Inventory.Decorator.UniqueIdentifier",
         "UniqueIdentifier",
         [asyncResp](const boost::system::error_code& ec,
@@ -792,7 +789,7 @@ inline void getProcessorObject(const std::shared_ptr<bmcweb::AsyncResp>& resp,
             const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error: {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error: {}", ec);
             messages::internalError(resp->res);
             return;
         }
@@ -908,14 +905,15 @@ inline void
                            const std::string& service,
                            const std::string& objPath)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, objPath,
+    dbus::utility::getAllProperties(
+        service, objPath,
         "xyz.openbmc_project.Inventory.Item.Cpu.OperatingConfig",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
-            BMCWEB_LOG_WARNING("D-Bus error: {}, {}", ec, ec.message());
+            BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus error: {}, {}", ec,
+                                   ec.message());
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1139,7 +1137,8 @@ inline void requestRoutesOperatingConfigCollection(App& app)
                 const dbus::utility::MapperGetSubTreePathsResponse& objects) {
             if (ec)
             {
-                BMCWEB_LOG_WARNING("D-Bus error: {}, {}", ec, ec.message());
+                BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus error: {}, {}", ec,
+                                       ec.message());
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -1211,7 +1210,8 @@ inline void requestRoutesOperatingConfig(App& app)
                 const dbus::utility::MapperGetSubTreeResponse& subtree) {
             if (ec)
             {
-                BMCWEB_LOG_WARNING("D-Bus error: {}, {}", ec, ec.message());
+                BMCWEB_LOG_WARNING_CAT(Dbus, "D-Bus error: {}, {}", ec,
+                                       ec.message());
                 messages::internalError(asyncResp->res);
                 return;
             }
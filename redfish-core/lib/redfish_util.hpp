@@ -20,7 +20,6 @@
 #include "error_messages.hpp"
 
 #include <boost/system/error_code.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <array>
 #include <charconv>
@@ -102,7 +101,7 @@ void getPortStatusAndPath(
         protocolToDBus,
     CallbackFunc&& callback)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [protocolToDBus, callback = std::forward<CallbackFunc>(callback)](
             const boost::system::error_code& ec,
             const std::vector<UnitStruct>& r) {
@@ -206,9 +205,9 @@ void getPortStatusAndPath(
 template <typename CallbackFunc>
 void getPortNumber(const std::string& socketPath, CallbackFunc&& callback)
 {
-    sdbusplus::asio::getProperty<
+    dbus::utility::getProperty<
         std::vector<std::tuple<std::string, std::string>>>(
-        *crow::connections::systemBus, "org.freedesktop.systemd1", socketPath,
+        "org.freedesktop.systemd1", socketPath,
         "org.freedesktop.systemd1.Socket", "Listen",
         [callback = std::forward<CallbackFunc>(callback)](
             const boost::system::error_code& ec,
@@ -22,7 +22,6 @@
 
 #include <boost/url/format.hpp>
 #include <nlohmann/json.hpp>
-#include <sdbusplus/asio/property.hpp>
 
 #include <optional>
 #include <string_view>
@@ -131,10 +130,9 @@ inline void requestRoutesRoleCollection(App& app)
         asyncResp->res.jsonValue["Name"] = "Roles Collection";
         asyncResp->res.jsonValue["Description"] = "BMC User Roles";
 
-        sdbusplus::asio::getProperty<std::vector<std::string>>(
-            *crow::connections::systemBus, "xyz.openbmc_project.User.Manager",
-            "/xyz/openbmc_project/user", "xyz.openbmc_project.User.Manager",
-            "AllPrivileges",
+        dbus::utility::getProperty<std::vector<std::string>>(
+            "xyz.openbmc_project.User.Manager", "/xyz/openbmc_project/user",
+            "xyz.openbmc_project.User.Manager", "AllPrivileges",
             [asyncResp](const boost::system::error_code& ec,
                         const std::vector<std::string>& privList) {
             if (ec)
@@ -29,7 +29,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -378,8 +377,9 @@ void getObjectsWithConnection(
         if (ec)
         {
             messages::internalError(sensorsAsyncResp->asyncResp->res);
-            BMCWEB_LOG_ERROR(
-                "getObjectsWithConnection resp_handler: Dbus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getObjectsWithConnection resp_handler: Dbus error {}",
+                ec);
             return;
         }
 
@@ -542,7 +542,8 @@ void getChassis(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         BMCWEB_LOG_DEBUG("getChassis respHandler enter");
         if (ec)
         {
-            BMCWEB_LOG_ERROR("getChassis respHandler DBUS error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "getChassis respHandler DBUS error: {}",
+                                 ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1059,9 +1060,8 @@ inline void populateFanRedundancy(
                 {
                     return;
                 }
-                sdbusplus::asio::getAllProperties(
-                    *crow::connections::systemBus, owner, path,
-                    "xyz.openbmc_project.Control.FanRedundancy",
+                dbus::utility::getAllProperties(
+                    owner, path, "xyz.openbmc_project.Control.FanRedundancy",
                     [path, sensorsAsyncResp](
                         const boost::system::error_code& ec3,
                         const dbus::utility::DBusPropertiesMap& ret) {
@@ -1490,8 +1490,9 @@ static void getInventoryItemsData(
             BMCWEB_LOG_DEBUG("getInventoryItemsData respHandler enter");
             if (ec)
             {
-                BMCWEB_LOG_ERROR(
-                    "getInventoryItemsData respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "getInventoryItemsData respHandler DBus error {}",
+                    ec);
                 messages::internalError(sensorsAsyncResp->asyncResp->res);
                 return;
             }
@@ -1569,8 +1570,9 @@ static void getInventoryItemsConnections(
         if (ec)
         {
             messages::internalError(sensorsAsyncResp->asyncResp->res);
-            BMCWEB_LOG_ERROR(
-                "getInventoryItemsConnections respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getInventoryItemsConnections respHandler DBus error {}",
+                ec);
             return;
         }
 
@@ -1642,8 +1644,9 @@ static void getInventoryItemAssociations(
         BMCWEB_LOG_DEBUG("getInventoryItemAssociations respHandler enter");
         if (ec)
         {
-            BMCWEB_LOG_ERROR(
-                "getInventoryItemAssociations respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getInventoryItemAssociations respHandler DBus error {}",
+                ec);
             messages::internalError(sensorsAsyncResp->asyncResp->res);
             return;
         }
@@ -1810,8 +1813,8 @@ void getInventoryLedData(
             BMCWEB_LOG_DEBUG("getInventoryLedData respHandler enter");
             if (ec)
             {
-                BMCWEB_LOG_ERROR(
-                    "getInventoryLedData respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "getInventoryLedData respHandler DBus error {}", ec);
                 messages::internalError(sensorsAsyncResp->asyncResp->res);
                 return;
             }
@@ -1850,9 +1853,8 @@ void getInventoryLedData(
         };
 
         // Get the State property for the current LED
-        sdbusplus::asio::getProperty<std::string>(
-            *crow::connections::systemBus, ledConnection, ledPath,
-            "xyz.openbmc_project.Led.Physical", "State",
+        dbus::utility::getProperty<std::string>(
+            ledConnection, ledPath, "xyz.openbmc_project.Led.Physical", "State",
             std::move(respHandler));
     }
 
@@ -1905,7 +1907,8 @@ void getInventoryLeds(
         if (ec)
         {
             messages::internalError(sensorsAsyncResp->asyncResp->res);
-            BMCWEB_LOG_ERROR("getInventoryLeds respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getInventoryLeds respHandler DBus error {}", ec);
             return;
         }
 
@@ -1992,8 +1995,9 @@ void getPowerSupplyAttributesData(
         BMCWEB_LOG_DEBUG("getPowerSupplyAttributesData respHandler enter");
         if (ec)
         {
-            BMCWEB_LOG_ERROR(
-                "getPowerSupplyAttributesData respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getPowerSupplyAttributesData respHandler DBus error {}",
+                ec);
             messages::internalError(sensorsAsyncResp->asyncResp->res);
             return;
         }
@@ -2015,8 +2019,8 @@ void getPowerSupplyAttributesData(
 
     // Get the DeratingFactor property for the PowerSupplyAttributes
     // Currently only property on the interface/only one we care about
-    sdbusplus::asio::getProperty<uint32_t>(
-        *crow::connections::systemBus, psAttributesConnection, psAttributesPath,
+    dbus::utility::getProperty<uint32_t>(
+        psAttributesConnection, psAttributesPath,
         "xyz.openbmc_project.Control.PowerSupplyAttributes", "DeratingFactor",
         std::move(respHandler));
 
@@ -2077,8 +2081,8 @@ void getPowerSupplyAttributes(
         if (ec)
         {
             messages::internalError(sensorsAsyncResp->asyncResp->res);
-            BMCWEB_LOG_ERROR(
-                "getPowerSupplyAttributes respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "getPowerSupplyAttributes respHandler DBus error {}", ec);
             return;
         }
         if (subtree.empty())
@@ -2315,7 +2319,8 @@ inline void getSensorData(
             BMCWEB_LOG_DEBUG("getManagedObjectsCb enter");
             if (ec)
             {
-                BMCWEB_LOG_ERROR("getManagedObjectsCb DBUS error: {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "getManagedObjectsCb DBUS error: {}",
+                                     ec);
                 messages::internalError(sensorsAsyncResp->asyncResp->res);
                 return;
             }
@@ -2893,8 +2898,8 @@ inline void
     BMCWEB_LOG_DEBUG("Looking up {}", connectionName);
     BMCWEB_LOG_DEBUG("Path {}", sensorPath);
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, connectionName, sensorPath, "",
+    dbus::utility::getAllProperties(
+        connectionName, sensorPath, "",
         [asyncResp,
          sensorPath](const boost::system::error_code& ec,
                      const ::dbus::utility::DBusPropertiesMap& valuesDict) {
@@ -2955,8 +2960,8 @@ inline void handleSensorGet(App& app, const crow::Request& req,
         if (ec)
         {
             messages::internalError(asyncResp->res);
-            BMCWEB_LOG_ERROR(
-                "Sensor getSensorPaths resp_handler: Dbus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "Sensor getSensorPaths resp_handler: Dbus error {}", ec);
             return;
         }
         getSensorFromDbus(asyncResp, sensorPath, subtree);
@@ -30,7 +30,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -153,7 +152,7 @@ inline void afterSystemsStorageGetSubtree(
 {
     if (ec)
     {
-        BMCWEB_LOG_DEBUG("requestRoutesStorage DBUS response error");
+        BMCWEB_LOG_DEBUG_CAT(Dbus, "requestRoutesStorage DBUS response error");
         messages::resourceNotFound(asyncResp->res, "#Storage.v1_13_0.Storage",
                                    storageId);
         return;
@@ -218,7 +217,7 @@ inline void afterSubtree(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     if (ec)
     {
-        BMCWEB_LOG_DEBUG("requestRoutesStorage DBUS response error");
+        BMCWEB_LOG_DEBUG_CAT(Dbus, "requestRoutesStorage DBUS response error");
         messages::resourceNotFound(asyncResp->res, "#Storage.v1_13_0.Storage",
                                    storageId);
         return;
@@ -291,9 +290,8 @@ inline void getDriveAsset(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                           const std::string& connectionName,
                           const std::string& path)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Inventory.Decorator.Asset",
+    dbus::utility::getAllProperties(
+        connectionName, path, "xyz.openbmc_project.Inventory.Decorator.Asset",
         [asyncResp](const boost::system::error_code& ec,
                     const std::vector<
                         std::pair<std::string, dbus::utility::DbusVariantType>>&
@@ -346,9 +344,8 @@ inline void getDrivePresent(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                             const std::string& connectionName,
                             const std::string& path)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        connectionName, path, "xyz.openbmc_project.Inventory.Item", "Present",
         [asyncResp, path](const boost::system::error_code& ec,
                           const bool isPresent) {
         // this interface isn't necessary, only check it if
@@ -369,9 +366,8 @@ inline void getDriveState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                           const std::string& connectionName,
                           const std::string& path)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.State.Drive", "Rebuilding",
+    dbus::utility::getProperty<bool>(
+        connectionName, path, "xyz.openbmc_project.State.Drive", "Rebuilding",
         [asyncResp](const boost::system::error_code& ec, const bool updating) {
         // this interface isn't necessary, only check it
         // if we get a good return
@@ -442,9 +438,8 @@ inline void
                            const std::string& connectionName,
                            const std::string& path)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Inventory.Item.Drive",
+    dbus::utility::getAllProperties(
+        connectionName, path, "xyz.openbmc_project.Inventory.Item.Drive",
         [asyncResp](const boost::system::error_code& ec,
                     const std::vector<
                         std::pair<std::string, dbus::utility::DbusVariantType>>&
@@ -838,7 +833,7 @@ inline void buildDrive(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     if (ec)
     {
-        BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+        BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -1033,9 +1028,8 @@ inline void populateStorageController(
     asyncResp->res.jsonValue["Id"] = controllerId;
     asyncResp->res.jsonValue["Status"]["State"] = "Enabled";
 
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        connectionName, path, "xyz.openbmc_project.Inventory.Item", "Present",
         [asyncResp](const boost::system::error_code& ec, bool isPresent) {
         // this interface isn't necessary, only check it
         // if we get a good return
@@ -1050,9 +1044,8 @@ inline void populateStorageController(
         }
     });
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, connectionName, path,
-        "xyz.openbmc_project.Inventory.Decorator.Asset",
+    dbus::utility::getAllProperties(
+        connectionName, path, "xyz.openbmc_project.Inventory.Decorator.Asset",
         [asyncResp](const boost::system::error_code& ec,
                     const std::vector<
                         std::pair<std::string, dbus::utility::DbusVariantType>>&
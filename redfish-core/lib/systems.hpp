@@ -38,7 +38,6 @@
 #include <boost/system/error_code.hpp>
 #include <boost/system/linux_error.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/message.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
@@ -198,27 +197,25 @@ inline void
                                            const bool cpuPresenceCheck) {
         if (ec3)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec3);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec3);
             return;
         }
         modifyCpuPresenceState(asyncResp, cpuPresenceCheck);
     };
 
     // Get the Presence of CPU
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Item", "Present",
+    dbus::utility::getProperty<bool>(
+        service, path, "xyz.openbmc_project.Inventory.Item", "Present",
         std::move(getCpuPresenceState));
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Item.Cpu",
+    dbus::utility::getAllProperties(
+        service, path, "xyz.openbmc_project.Inventory.Item.Cpu",
         [asyncResp, service,
          path](const boost::system::error_code& ec2,
                const dbus::utility::DBusPropertiesMap& properties) {
         if (ec2)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec2);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec2);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -289,15 +286,14 @@ inline void
     getMemorySummary(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                      const std::string& service, const std::string& path)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Inventory.Item.Dimm",
+    dbus::utility::getAllProperties(
+        service, path, "xyz.openbmc_project.Inventory.Item.Dimm",
         [asyncResp, service,
          path](const boost::system::error_code& ec2,
                const dbus::utility::DBusPropertiesMap& properties) {
         if (ec2)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec2);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec2);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -311,7 +307,7 @@ inline void afterGetUUID(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -425,7 +421,7 @@ inline void afterSystemGetSubTree(
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -467,8 +463,8 @@ inline void afterSystemGetSubTree(
                 {
                     BMCWEB_LOG_DEBUG("Found UUID, now get its properties.");
 
-                    sdbusplus::asio::getAllProperties(
-                        *crow::connections::systemBus, connection.first, path,
+                    dbus::utility::getAllProperties(
+                        connection.first, path,
                         "xyz.openbmc_project.Common.UUID",
                         [asyncResp](const boost::system::error_code& ec3,
                                     const dbus::utility::DBusPropertiesMap&
@@ -479,8 +475,8 @@ inline void afterSystemGetSubTree(
                 else if (interfaceName ==
                          "xyz.openbmc_project.Inventory.Item.System")
                 {
-                    sdbusplus::asio::getAllProperties(
-                        *crow::connections::systemBus, connection.first, path,
+                    dbus::utility::getAllProperties(
+                        connection.first, path,
                         "xyz.openbmc_project.Inventory.Decorator.Asset",
                         [asyncResp](const boost::system::error_code& ec3,
                                     const dbus::utility::DBusPropertiesMap&
@@ -488,8 +484,8 @@ inline void afterSystemGetSubTree(
                         afterGetInventory(asyncResp, ec3, properties);
                     });
 
-                    sdbusplus::asio::getProperty<std::string>(
-                        *crow::connections::systemBus, connection.first, path,
+                    dbus::utility::getProperty<std::string>(
+                        connection.first, path,
                         "xyz.openbmc_project.Inventory.Decorator."
                         "AssetTag",
                         "AssetTag",
@@ -533,10 +529,9 @@ inline void
 inline void getHostState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
     BMCWEB_LOG_DEBUG("Get host information.");
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Host",
-        "/xyz/openbmc_project/state/host0", "xyz.openbmc_project.State.Host",
-        "CurrentHostState",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
+        "xyz.openbmc_project.State.Host", "CurrentHostState",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& hostState) {
         if (ec)
@@ -548,7 +543,7 @@ inline void getHostState(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
                 BMCWEB_LOG_DEBUG("Service not available {}", ec);
                 return;
             }
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -822,9 +817,8 @@ inline int
  */
 inline void getBootProgress(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Host",
-        "/xyz/openbmc_project/state/host0",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
         "xyz.openbmc_project.State.Boot.Progress", "BootProgress",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& bootProgressStr) {
@@ -852,15 +846,14 @@ inline void getBootProgress(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 inline void getBootProgressLastStateTime(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<uint64_t>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Host",
-        "/xyz/openbmc_project/state/host0",
+    dbus::utility::getProperty<uint64_t>(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
         "xyz.openbmc_project.State.Boot.Progress", "BootProgressLastUpdate",
         [asyncResp](const boost::system::error_code& ec,
                     const uint64_t lastStateTime) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("D-BUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "D-BUS response error {}", ec);
             return;
         }
 
@@ -887,8 +880,8 @@ inline void getBootProgressLastStateTime(
 inline void
     getBootOverrideType(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/boot",
         "xyz.openbmc_project.Control.Boot.Type", "BootType",
         [asyncResp](const boost::system::error_code& ec,
@@ -928,15 +921,15 @@ inline void
 inline void
     getBootOverrideMode(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/boot",
         "xyz.openbmc_project.Control.Boot.Mode", "BootMode",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& bootModeStr) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -980,8 +973,8 @@ inline void
 inline void
     getBootOverrideSource(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/boot",
         "xyz.openbmc_project.Control.Boot.Source", "BootSource",
         [asyncResp](const boost::system::error_code& ec,
@@ -992,7 +985,7 @@ inline void
             {
                 return;
             }
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1035,14 +1028,14 @@ inline void processBootOverrideEnable(
 
     // If boot source override is enabled, we need to check 'one_time'
     // property to set a correct value for the "BootSourceOverrideEnabled"
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<bool>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/boot/one_time",
         "xyz.openbmc_project.Object.Enable", "Enabled",
         [asyncResp](const boost::system::error_code& ec, bool oneTimeSetting) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1071,8 +1064,8 @@ inline void processBootOverrideEnable(
 inline void
     getBootOverrideEnable(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<bool>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/boot",
         "xyz.openbmc_project.Object.Enable", "Enabled",
         [asyncResp](const boost::system::error_code& ec,
@@ -1083,7 +1076,7 @@ inline void
             {
                 return;
             }
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1126,15 +1119,15 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Getting System Last Reset Time");
 
-    sdbusplus::asio::getProperty<uint64_t>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Chassis",
+    dbus::utility::getProperty<uint64_t>(
+        "xyz.openbmc_project.State.Chassis",
         "/xyz/openbmc_project/state/chassis0",
         "xyz.openbmc_project.State.Chassis", "LastStateChangeTime",
         [asyncResp](const boost::system::error_code& ec,
                     uint64_t lastResetTime) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("D-BUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "D-BUS response error {}", ec);
             return;
         }
 
@@ -1165,9 +1158,8 @@ inline void getAutomaticRebootAttempts(
 {
     BMCWEB_LOG_DEBUG("Get Automatic Retry policy");
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Host",
-        "/xyz/openbmc_project/state/host0",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
         "xyz.openbmc_project.Control.Boot.RebootAttempts",
         [asyncResp{asyncResp}](
             const boost::system::error_code& ec,
@@ -1176,7 +1168,7 @@ inline void getAutomaticRebootAttempts(
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("D-Bus responses error: {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "D-Bus responses error: {}", ec);
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -1222,8 +1214,8 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Get Automatic Retry policy");
 
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<bool>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/auto_reboot",
         "xyz.openbmc_project.Control.Boot.RebootPolicy", "AutoReboot",
         [asyncResp](const boost::system::error_code& ec,
@@ -1232,7 +1224,7 @@ inline void
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("D-Bus responses error: {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "D-Bus responses error: {}", ec);
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -1321,15 +1313,15 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Get power restore policy");
 
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/power_restore_policy",
         "xyz.openbmc_project.Control.Power.RestorePolicy", "PowerRestorePolicy",
         [asyncResp](const boost::system::error_code& ec,
                     const std::string& policy) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             return;
         }
         computer_system::PowerRestorePolicyTypes restore =
@@ -1356,16 +1348,15 @@ inline void
 {
     BMCWEB_LOG_DEBUG("Get Stop Boot On Fault");
 
-    sdbusplus::asio::getProperty<bool>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
-        "/xyz/openbmc_project/logging/settings",
+    dbus::utility::getProperty<bool>(
+        "xyz.openbmc_project.Settings", "/xyz/openbmc_project/logging/settings",
         "xyz.openbmc_project.Logging.Settings", "QuiesceOnHwError",
         [asyncResp](const boost::system::error_code& ec, bool value) {
         if (ec)
         {
             if (ec.value() != EBADR)
             {
-                BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
                 messages::internalError(asyncResp->res);
             }
             return;
@@ -1402,8 +1393,8 @@ inline void getTrustedModuleRequiredToBoot(
                     const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error on TPM.Policy GetSubTree{}",
-                             ec);
+            BMCWEB_LOG_DEBUG_CAT(
+                Dbus, "DBUS response error on TPM.Policy GetSubTree{}", ec);
             // This is an optional D-Bus object so just return if
             // error occurs
             return;
@@ -1439,15 +1430,14 @@ inline void getTrustedModuleRequiredToBoot(
         const std::string& serv = subtree[0].second.begin()->first;
 
         // Valid TPM Enable object found, now reading the current value
-        sdbusplus::asio::getProperty<bool>(
-            *crow::connections::systemBus, serv, path,
-            "xyz.openbmc_project.Control.TPM.Policy", "TPMEnable",
+        dbus::utility::getProperty<bool>(
+            serv, path, "xyz.openbmc_project.Control.TPM.Policy", "TPMEnable",
             [asyncResp](const boost::system::error_code& ec2,
                         bool tpmRequired) {
             if (ec2)
             {
-                BMCWEB_LOG_ERROR("D-BUS response error on TPM.Policy Get{}",
-                                 ec2);
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "D-BUS response error on TPM.Policy Get{}", ec2);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -1490,8 +1480,8 @@ inline void setTrustedModuleRequiredToBoot(
                       const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error on TPM.Policy GetSubTree{}",
-                             ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "DBUS response error on TPM.Policy GetSubTree{}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1757,7 +1747,8 @@ inline void setAssetTag(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                    const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("D-Bus response error on GetSubTree {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "D-Bus response error on GetSubTree {}",
+                                 ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1957,9 +1948,9 @@ inline void
     getProvisioningStatus(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
     BMCWEB_LOG_DEBUG("Get OEM information.");
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.PFR.Manager",
-        "/xyz/openbmc_project/pfr", "xyz.openbmc_project.PFR.Attributes",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.PFR.Manager", "/xyz/openbmc_project/pfr",
+        "xyz.openbmc_project.PFR.Attributes",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& propertiesList) {
         nlohmann::json& oemPFR =
@@ -1970,7 +1961,7 @@ inline void
 
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             // not an error, don't have to have the interface
             oemPFR["ProvisioningStatus"] = "NotProvisioned";
             return;
@@ -2071,7 +2062,8 @@ inline void
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error on PowerMode GetAll: {}", ec);
+        BMCWEB_LOG_ERROR_CAT(
+            Dbus, "DBUS response error on PowerMode GetAll: {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -2141,8 +2133,8 @@ inline void getPowerMode(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
                     const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error on Power.Mode GetSubTree {}",
-                             ec);
+            BMCWEB_LOG_DEBUG_CAT(
+                Dbus, "DBUS response error on Power.Mode GetSubTree {}", ec);
             // This is an optional D-Bus object so just return if
             // error occurs
             return;
@@ -2179,9 +2171,8 @@ inline void getPowerMode(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
         }
 
         // Valid Power Mode object found, now read the mode properties
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, service, path,
-            "xyz.openbmc_project.Control.Power.Mode",
+        dbus::utility::getAllProperties(
+            service, path, "xyz.openbmc_project.Control.Power.Mode",
             [asyncResp](const boost::system::error_code& ec2,
                         const dbus::utility::DBusPropertiesMap& properties) {
             afterGetPowerMode(asyncResp, ec2, properties);
@@ -2270,8 +2261,8 @@ inline void setPowerMode(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                     const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("DBUS response error on Power.Mode GetSubTree {}",
-                             ec);
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus, "DBUS response error on Power.Mode GetSubTree {}", ec);
             // This is an optional D-Bus object, but user attempted to patch
             messages::internalError(asyncResp->res);
             return;
@@ -2389,16 +2380,15 @@ inline void
     getHostWatchdogTimer(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
     BMCWEB_LOG_DEBUG("Get host watchodg");
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, "xyz.openbmc_project.Watchdog",
-        "/xyz/openbmc_project/watchdog/host0",
+    dbus::utility::getAllProperties(
+        "xyz.openbmc_project.Watchdog", "/xyz/openbmc_project/watchdog/host0",
         "xyz.openbmc_project.State.Watchdog",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& properties) {
         if (ec)
         {
             // watchdog service is stopped
-            BMCWEB_LOG_DEBUG("DBUS response error {}", ec);
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error {}", ec);
             return;
         }
 
@@ -2576,7 +2566,8 @@ inline void
                     const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR(
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus,
                 "DBUS response error on Power.IdlePowerSaver GetSubTree {}",
                 ec);
             messages::internalError(asyncResp->res);
@@ -2615,15 +2606,15 @@ inline void
         }
 
         // Valid IdlePowerSaver object found, now read the current values
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, service, path,
-            "xyz.openbmc_project.Control.Power.IdlePowerSaver",
+        dbus::utility::getAllProperties(
+            service, path, "xyz.openbmc_project.Control.Power.IdlePowerSaver",
             [asyncResp](const boost::system::error_code& ec2,
                         const dbus::utility::DBusPropertiesMap& properties) {
             if (ec2)
             {
-                BMCWEB_LOG_ERROR(
-                    "DBUS response error on IdlePowerSaver GetAll: {}", ec2);
+                BMCWEB_LOG_ERROR_CAT(
+                    Dbus, "DBUS response error on IdlePowerSaver GetAll: {}",
+                    ec2);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -2674,7 +2665,8 @@ inline void
                       const dbus::utility::MapperGetSubTreeResponse& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR(
+            BMCWEB_LOG_ERROR_CAT(
+                Dbus,
                 "DBUS response error on Power.IdlePowerSaver GetSubTree {}",
                 ec);
             messages::internalError(asyncResp->res);
@@ -2801,8 +2793,8 @@ inline void handleComputerSystemCollectionGet(
     system["@odata.id"] = boost::urls::format("/redfish/v1/Systems/{}",
                                               BMCWEB_REDFISH_SYSTEM_URI_NAME);
     ifaceArray.emplace_back(std::move(system));
-    sdbusplus::asio::getProperty<std::string>(
-        *crow::connections::systemBus, "xyz.openbmc_project.Settings",
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/network/hypervisor",
         "xyz.openbmc_project.Network.SystemConfiguration", "HostName",
         [asyncResp](const boost::system::error_code& ec2,
@@ -2843,11 +2835,11 @@ inline void doNMI(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
         "xyz.openbmc_project.Control.Host.NMI";
     constexpr const char* method = "NMI";
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp](const boost::system::error_code& ec) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR(" Bad D-Bus request error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, " Bad D-Bus request error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -2967,7 +2959,7 @@ inline void afterPortRequest(
 {
     if (ec)
     {
-        BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
         messages::internalError(asyncResp->res);
         return;
     }
@@ -2987,7 +2979,7 @@ inline void afterPortRequest(
                                           int portNumber) {
                 if (ec1)
                 {
-                    BMCWEB_LOG_ERROR("DBUS response error {}", ec1);
+                    BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec1);
                     messages::internalError(asyncResp->res);
                     return;
                 }
@@ -3356,7 +3348,7 @@ inline void afterGetAllowedHostTransitions(
         }
         else
         {
-            BMCWEB_LOG_ERROR("DBUS response error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -3422,10 +3414,9 @@ inline void handleSystemCollectionResetActionGet(
     asyncResp->res.jsonValue["Id"] = "ResetActionInfo";
 
     // Look to see if system defines AllowedHostTransitions
-    sdbusplus::asio::getProperty<std::vector<std::string>>(
-        *crow::connections::systemBus, "xyz.openbmc_project.State.Host",
-        "/xyz/openbmc_project/state/host0", "xyz.openbmc_project.State.Host",
-        "AllowedHostTransitions",
+    dbus::utility::getProperty<std::vector<std::string>>(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
+        "xyz.openbmc_project.State.Host", "AllowedHostTransitions",
         [asyncResp](const boost::system::error_code& ec,
                     const std::vector<std::string>& allowedHostTransitions) {
         afterGetAllowedHostTransitions(asyncResp, ec, allowedHostTransitions);
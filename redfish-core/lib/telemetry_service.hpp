@@ -8,7 +8,6 @@
 #include "utils/telemetry_utils.hpp"
 #include "utils/time_utils.hpp"
 
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 namespace redfish
@@ -35,9 +34,8 @@ inline void handleTelemetryServiceGet(
     asyncResp->res.jsonValue["Triggers"]["@odata.id"] =
         "/redfish/v1/TelemetryService/Triggers";
 
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, telemetry::service,
-        "/xyz/openbmc_project/Telemetry/Reports",
+    dbus::utility::getAllProperties(
+        telemetry::service, "/xyz/openbmc_project/Telemetry/Reports",
         "xyz.openbmc_project.Telemetry.ReportManager",
         [asyncResp](const boost::system::error_code& ec,
                     const dbus::utility::DBusPropertiesMap& ret) {
@@ -48,7 +46,7 @@ inline void handleTelemetryServiceGet(
         }
         if (ec)
         {
-            BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "app.hpp"
+#include "dbus_utility.hpp"
 #include "generated/enums/resource.hpp"
 #include "generated/enums/triggers.hpp"
 #include "query.hpp"
@@ -14,7 +15,6 @@
 #include "utils/time_utils.hpp"
 
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
 #include <array>
@@ -693,7 +693,7 @@ inline void afterCreateTrigger(
     if (ec)
     {
         messages::internalError(asyncResp->res);
-        BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+        BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
         return;
     }
 
@@ -953,7 +953,7 @@ inline void handleTriggerCollectionPost(
         return;
     }
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, id = ctx.id](const boost::system::error_code& ec,
                                  const std::string& dbusPath) {
         afterCreateTrigger(ec, dbusPath, asyncResp, id);
@@ -1009,9 +1009,9 @@ inline void requestRoutesTrigger(App& app)
         {
             return;
         }
-        sdbusplus::asio::getAllProperties(
-            *crow::connections::systemBus, telemetry::service,
-            telemetry::getDbusTriggerPath(id), telemetry::triggerInterface,
+        dbus::utility::getAllProperties(
+            telemetry::service, telemetry::getDbusTriggerPath(id),
+            telemetry::triggerInterface,
             [asyncResp,
              id](const boost::system::error_code& ec,
                  const std::vector<std::pair<
@@ -1024,7 +1024,7 @@ inline void requestRoutesTrigger(App& app)
             }
             if (ec)
             {
-                BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
@@ -1048,7 +1048,7 @@ inline void requestRoutesTrigger(App& app)
         }
         const std::string triggerPath = telemetry::getDbusTriggerPath(id);
 
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp, id](const boost::system::error_code& ec) {
             if (ec.value() == EBADR)
             {
@@ -1058,7 +1058,7 @@ inline void requestRoutesTrigger(App& app)
 
             if (ec)
             {
-                BMCWEB_LOG_ERROR("respHandler DBus error {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "respHandler DBus error {}", ec);
                 messages::internalError(asyncResp->res);
                 return;
             }
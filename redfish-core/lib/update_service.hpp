@@ -36,7 +36,6 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/url/format.hpp>
-#include <sdbusplus/asio/property.hpp>
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
@@ -113,9 +112,9 @@ inline void activateImage(const std::string& objPath,
                           const std::string& service)
 {
     BMCWEB_LOG_DEBUG("Activate image for {} {}", objPath, service);
-    sdbusplus::asio::setProperty(
-        *crow::connections::systemBus, service, objPath,
-        "xyz.openbmc_project.Software.Activation", "RequestedActivation",
+    dbus::utility::setProperty(
+        service, objPath, "xyz.openbmc_project.Software.Activation",
+        "RequestedActivation",
         "xyz.openbmc_project.Software.Activation.RequestedActivations.Active",
         [](const boost::system::error_code& ec) {
         if (ec)
@@ -610,7 +609,7 @@ inline void doTftpUpdate(const crow::Request& req,
     redfish::messages::success(asyncResp->res);
 
     // Call TFTP service
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [](const boost::system::error_code& ec) {
         if (ec)
         {
@@ -897,7 +896,7 @@ inline void startUpdate(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& objectPath,
                         const std::string& serviceName)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, payload = std::move(payload),
          objectPath](const boost::system::error_code& ec1,
                      const sdbusplus::message::object_path& retPath) mutable {
@@ -1257,9 +1256,8 @@ inline void
                        const std::string& service, const std::string& path,
                        const std::string& swId)
 {
-    sdbusplus::asio::getAllProperties(
-        *crow::connections::systemBus, service, path,
-        "xyz.openbmc_project.Software.Version",
+    dbus::utility::getAllProperties(
+        service, path, "xyz.openbmc_project.Software.Version",
         [asyncResp,
          swId](const boost::system::error_code& ec,
                const dbus::utility::DBusPropertiesMap& propertiesList) {
@@ -103,7 +103,7 @@ inline void
             const dbus::utility::ManagedObjectType& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
 
             return;
         }
@@ -283,7 +283,7 @@ inline void getVmResourceList(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
             const dbus::utility::ManagedObjectType& subtree) {
         if (ec)
         {
-            BMCWEB_LOG_DEBUG("DBUS response error");
+            BMCWEB_LOG_DEBUG_CAT(Dbus, "DBUS response error");
             return;
         }
         nlohmann::json& members = asyncResp->res.jsonValue["Members"];
@@ -490,12 +490,12 @@ inline void doMountVmLegacy(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     sdbusplus::message::object_path path(
         "/xyz/openbmc_project/VirtualMedia/Legacy");
     path /= name;
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::asyncMethodCall(
         [asyncResp, secretPipe](const boost::system::error_code& ec,
                                 bool success) {
         if (ec)
         {
-            BMCWEB_LOG_ERROR("Bad D-Bus request error: {}", ec);
+            BMCWEB_LOG_ERROR_CAT(Dbus, "Bad D-Bus request error: {}", ec);
             messages::internalError(asyncResp->res);
             return;
         }
@@ -660,11 +660,11 @@ inline void doEjectAction(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     // Legacy mount requires parameter with image
     if (legacy)
     {
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec) {
             if (ec)
             {
-                BMCWEB_LOG_ERROR("Bad D-Bus request error: {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "Bad D-Bus request error: {}", ec);
 
                 messages::internalError(asyncResp->res);
                 return;
@@ -675,11 +675,11 @@ inline void doEjectAction(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     }
     else // proxy
     {
-        crow::connections::systemBus->async_method_call(
+        dbus::utility::asyncMethodCall(
             [asyncResp](const boost::system::error_code& ec) {
             if (ec)
             {
-                BMCWEB_LOG_ERROR("Bad D-Bus request error: {}", ec);
+                BMCWEB_LOG_ERROR_CAT(Dbus, "Bad D-Bus request error: {}", ec);
 
                 messages::internalError(asyncResp->res);
                 return;
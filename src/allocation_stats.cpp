@@ -0,0 +1,114 @@
+// Replaces the global allocation functions to count allocations per thread.
+// Only linked into bmcweb when the allocation-stats option is enabled.
+
+#include "allocation_stats.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+void* countedAllocate(size_t size)
+{
+    bmcweb::AllocationStats& stats = bmcweb::threadAllocationStats();
+    stats.count++;
+    stats.bytes += size;
+    // malloc(0) may return nullptr, which new isn't allowed to
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        std::abort();
+    }
+    return ptr;
+}
+
+void* countedAllocateAligned(size_t size, std::align_val_t alignment)
+{
+    bmcweb::AllocationStats& stats = bmcweb::threadAllocationStats();
+    stats.count++;
+    stats.bytes += size;
+    size_t align = static_cast<size_t>(alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    size_t rounded = (size + align - 1) / align * align;
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded);
+    if (ptr == nullptr)
+    {
+        std::abort();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return countedAllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return countedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
@@ -8,11 +8,14 @@
 #include "event_service_manager.hpp"
 #include "google/google_service_root.hpp"
 #include "hostname_monitor.hpp"
+#include "http_stats_routes.hpp"
 #include "ibm/management_console_rest.hpp"
 #include "image_upload.hpp"
 #include "kvm_websocket.hpp"
 #include "logging.hpp"
+#include "logging_routes.hpp"
 #include "login_routes.hpp"
+#include "mapper_cache_routes.hpp"
 #include "obmc_console.hpp"
 #include "openbmc_dbus_rest.hpp"
 #include "redfish.hpp"
@@ -85,7 +88,10 @@ int run()
         crow::google_api::requestRoutes(app);
     }
 
+    crow::http_stats_routes::requestRoutes(app);
     crow::login_routes::requestRoutes(app);
+    crow::logging_routes::requestRoutes(app);
+    crow::mapper_cache_routes::requestRoutes(app);
 
     if constexpr (!BMCWEB_REDFISH_DBUS_LOG)
     {
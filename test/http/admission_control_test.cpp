@@ -0,0 +1,114 @@
+#include "admission_control.hpp"
+#include "http_response.hpp"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow
+{
+namespace
+{
+
+using Decision = AdmissionControl::Decision;
+
+const boost::asio::ip::address clientA =
+    boost::asio::ip::make_address("10.0.0.1");
+const boost::asio::ip::address clientB =
+    boost::asio::ip::make_address("10.0.0.2");
+
+TEST(AdmissionControl, ConnectionLimits)
+{
+    AdmissionControl control({.maxConnections = 3,
+                              .maxConnectionsPerClient = 2,
+                              .acceptQueue = 1});
+
+    AdmissionControl::Ticket a1 = control.admitConnection(clientA);
+    AdmissionControl::Ticket a2 = control.admitConnection(clientA);
+    EXPECT_TRUE(a1.admitted());
+    EXPECT_TRUE(a2.admitted());
+    {
+        // Over the per client limit, but another client is still fine
+        AdmissionControl::Ticket a3 = control.admitConnection(clientA);
+        EXPECT_EQ(a3.getDecision(), Decision::TooManyRequests);
+        // The accept queue is full
+        AdmissionControl::Ticket a4 = control.admitConnection(clientA);
+        EXPECT_EQ(a4.getDecision(), Decision::Drop);
+    }
+    AdmissionControl::Ticket b1 = control.admitConnection(clientB);
+    EXPECT_TRUE(b1.admitted());
+
+    // Over the server wide limit
+    AdmissionControl::Ticket b2 = control.admitConnection(clientB);
+    EXPECT_EQ(b2.getDecision(), Decision::Busy);
+
+    AdmissionControl::Counters counters = control.getCounters();
+    EXPECT_EQ(counters.connections, 3U);
+    EXPECT_EQ(counters.queuedConnections, 1U);
+    EXPECT_EQ(counters.connectionsRejected, 2U);
+    EXPECT_EQ(counters.connectionsDropped, 1U);
+
+    // Closing a connection makes room for another
+    b2 = AdmissionControl::Ticket();
+    a1 = AdmissionControl::Ticket();
+    AdmissionControl::Ticket b3 = control.admitConnection(clientB);
+    EXPECT_TRUE(b3.admitted());
+    counters = control.getCounters();
+    EXPECT_EQ(counters.connections, 3U);
+    EXPECT_EQ(counters.queuedConnections, 0U);
+}
+
+TEST(AdmissionControl, RequestLimits)
+{
+    AdmissionControl control({.maxRequests = 2, .maxRequestsPerClient = 1});
+
+    AdmissionControl::Ticket a1 = control.admitRequest(clientA);
+    EXPECT_TRUE(a1.admitted());
+    EXPECT_EQ(control.admitRequest(clientA).getDecision(),
+              Decision::TooManyRequests);
+
+    AdmissionControl::Ticket b1 = control.admitRequest(clientB);
+    EXPECT_TRUE(b1.admitted());
+    // The server wide limit is checked first
+    EXPECT_EQ(control.admitRequest(clientB).getDecision(), Decision::Busy);
+
+    // Moving a ticket keeps the request counted until the new owner is done
+    AdmissionControl::Ticket moved = std::move(a1);
+    EXPECT_EQ(control.getCounters().requests, 2U);
+    moved = AdmissionControl::Ticket();
+    EXPECT_EQ(control.getCounters().requests, 1U);
+    EXPECT_EQ(control.getCounters().requestsRejected, 2U);
+}
+
+TEST(AdmissionControl, UnlimitedByDefault)
+{
+    AdmissionControl control({});
+    AdmissionControl::Ticket a1 = control.admitConnection(clientA);
+    AdmissionControl::Ticket a2 = control.admitRequest(clientA);
+    EXPECT_TRUE(a1.admitted());
+    EXPECT_TRUE(a2.admitted());
+}
+
+TEST(AdmissionControl, RejectedResponse)
+{
+    Response res;
+    AdmissionControl::setRejectedResponse(res, Decision::TooManyRequests);
+    EXPECT_EQ(res.result(), boost::beast::http::status::too_many_requests);
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::retry_after),
+              std::to_string(BMCWEB_HTTP_RETRY_AFTER));
+
+    Response busy;
+    AdmissionControl::setRejectedResponse(busy, Decision::Busy);
+    EXPECT_EQ(busy.result(), boost::beast::http::status::service_unavailable);
+}
+
+} // namespace
+} // namespace crow
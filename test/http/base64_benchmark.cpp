@@ -0,0 +1,89 @@
+#include "base64_kernels.hpp"
+#include "utility.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Measures base64 encoding and decoding with each kernel this CPU supports.
+// Run with "meson test --benchmark base64_benchmark".
+
+namespace
+{
+
+double nsPerByte(std::chrono::steady_clock::duration elapsed, size_t bytes)
+{
+    std::chrono::duration<double, std::nano> ns = elapsed;
+    return ns.count() / static_cast<double>(bytes);
+}
+
+} // namespace
+
+int main()
+{
+    using crow::utility::Base64Kernel;
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> byte(0, 255);
+    // One HttpBody read, and one Basic auth header
+    for (size_t size : {size_t{8192}, size_t{48}})
+    {
+        std::string raw(size, '\0');
+        for (char& c : raw)
+        {
+            c = static_cast<char>(byte(gen));
+        }
+        size_t iterations = (64UL * 1024UL * 1024UL) / size;
+
+        for (std::pair<Base64Kernel, std::string_view> kernel :
+             {std::pair{Base64Kernel::Scalar, "scalar"},
+              std::pair{Base64Kernel::Ssse3, "ssse3"},
+              std::pair{Base64Kernel::Avx2, "avx2"},
+              std::pair{Base64Kernel::Neon, "neon"}})
+        {
+            if (!crow::utility::setBase64Kernel(kernel.first))
+            {
+                continue;
+            }
+            std::string encoded;
+            std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                encoded = crow::utility::base64encode(raw);
+            }
+            std::chrono::steady_clock::duration encodeTime =
+                std::chrono::steady_clock::now() - start;
+
+            std::string decoded;
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                if (!crow::utility::base64Decode(encoded, decoded))
+                {
+                    std::cerr << "Decode failed\n";
+                    return 1;
+                }
+            }
+            std::chrono::steady_clock::duration decodeTime =
+                std::chrono::steady_clock::now() - start;
+            if (decoded != raw)
+            {
+                std::cerr << "Decode didn't match\n";
+                return 1;
+            }
+
+            std::cout << std::format(
+                "{:>6} {:>5} bytes: encode {:.3f} ns/byte, "
+                "decode {:.3f} ns/byte\n",
+                kernel.second, size, nsPerByte(encodeTime, iterations * size),
+                nsPerByte(decodeTime, iterations * encoded.size()));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "base64_kernels.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow::utility
+{
+namespace
+{
+
+constexpr std::string_view alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string randomBytes(std::mt19937& gen, size_t size)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::string out(size, '\0');
+    for (char& c : out)
+    {
+        c = static_cast<char>(byte(gen));
+    }
+    return out;
+}
+
+struct DecodeResult
+{
+    bool ok;
+    std::string output;
+};
+
+DecodeResult decodeWith(Base64Kernel kernel, std::string_view input)
+{
+    EXPECT_TRUE(setBase64Kernel(kernel));
+    DecodeResult result;
+    result.ok = base64Decode(input, result.output);
+    return result;
+}
+
+std::string encodeWith(Base64Kernel kernel, std::string_view input,
+                       size_t chunkSize)
+{
+    EXPECT_TRUE(setBase64Kernel(kernel));
+    Base64Encoder encoder;
+    std::string out;
+    while (!input.empty())
+    {
+        std::string_view chunk = input.substr(0, chunkSize);
+        encoder.encode(chunk, out);
+        input.remove_prefix(chunk.size());
+    }
+    encoder.finalize(out);
+    return out;
+}
+
+// Runs every kernel this CPU supports over random input, including input
+// broken in random places, and checks it matches the scalar code exactly
+TEST(Base64Kernels, MatchScalar)
+{
+    Base64Kernel original = getBase64Kernels().kernel;
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<size_t> sizes(0, 300);
+    std::uniform_int_distribution<int> anyByte(0, 255);
+
+    for (Base64Kernel kernel :
+         {Base64Kernel::Ssse3, Base64Kernel::Avx2, Base64Kernel::Neon})
+    {
+        if (getBase64Kernels(kernel) == nullptr)
+        {
+            continue;
+        }
+        for (size_t round = 0; round < 2000; round++)
+        {
+            std::string raw = randomBytes(gen, sizes(gen));
+            size_t chunkSize = 1 + (sizes(gen) % 64);
+            std::string expected =
+                encodeWith(Base64Kernel::Scalar, raw, chunkSize);
+            ASSERT_EQ(encodeWith(kernel, raw, chunkSize), expected);
+
+            std::string encoded = expected;
+            if (!encoded.empty() && round % 2 == 1)
+            {
+                std::uniform_int_distribution<size_t> pos(0,
+                                                          encoded.size() - 1);
+                encoded[pos(gen)] = static_cast<char>(anyByte(gen));
+                if (round % 4 == 3)
+                {
+                    encoded[pos(gen)] = alphabet[pos(gen) % alphabet.size()];
+                }
+            }
+            DecodeResult scalar = decodeWith(Base64Kernel::Scalar, encoded);
+            DecodeResult vector = decodeWith(kernel, encoded);
+            ASSERT_EQ(vector.ok, scalar.ok) << encoded;
+            ASSERT_EQ(vector.output, scalar.output) << encoded;
+            if (round % 2 == 0)
+            {
+                EXPECT_TRUE(vector.ok);
+                EXPECT_EQ(vector.output, raw);
+            }
+        }
+    }
+    EXPECT_TRUE(setBase64Kernel(original));
+}
+
+TEST(Base64Kernels, ScalarIsAlwaysAvailable)
+{
+    const Base64Kernels* scalar = getBase64Kernels(Base64Kernel::Scalar);
+    ASSERT_NE(scalar, nullptr);
+    EXPECT_EQ(scalar->encode("abcdefghijklmnopqrstuvwxyz", 26, nullptr), 0U);
+}
+
+} // namespace
+} // namespace crow::utility
@@ -0,0 +1,73 @@
+#include "buffer_pool.hpp"
+
+#include <boost/asio/buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace bmcweb
+{
+namespace
+{
+
+TEST(BufferPool, KeepsFreedBlocksUpToBudget)
+{
+    BufferPool pool(1024, 2048);
+    std::unique_ptr<std::byte[]> first = pool.take();
+    std::unique_ptr<std::byte[]> second = pool.take();
+    std::unique_ptr<std::byte[]> third = pool.take();
+    EXPECT_EQ(pool.getBlocksInUse(), 3U);
+    EXPECT_EQ(pool.getFreeBlocks(), 0U);
+
+    const std::byte* firstPtr = first.get();
+    pool.give(std::move(first));
+    pool.give(std::move(second));
+    pool.give(std::move(third));
+    EXPECT_EQ(pool.getBlocksInUse(), 0U);
+    // Only two blocks fit in the budget
+    EXPECT_EQ(pool.getFreeBlocks(), 2U);
+
+    std::unique_ptr<std::byte[]> last = pool.take();
+    std::unique_ptr<std::byte[]> reused = pool.take();
+    EXPECT_EQ(reused.get(), firstPtr);
+    EXPECT_EQ(pool.getFreeBlocks(), 0U);
+}
+
+TEST(PooledFlatBuffer, OnlyHoldsStorageWhileInUse)
+{
+    constexpr size_t size = 64;
+    BufferPool& pool = BufferPool::getInstance<size>();
+    size_t inUse = pool.getBlocksInUse();
+
+    PooledFlatBuffer<size> buffer;
+    EXPECT_FALSE(buffer.hasStorage());
+    EXPECT_EQ(buffer.capacity(), 0U);
+
+    buffer.acquire();
+    EXPECT_TRUE(buffer.hasStorage());
+    EXPECT_EQ(buffer.capacity(), size);
+    EXPECT_EQ(pool.getBlocksInUse(), inUse + 1);
+
+    std::string_view data = "some data";
+    buffer.commit(boost::asio::buffer_copy(buffer.prepare(data.size()),
+                                           boost::asio::buffer(data)));
+    // Storage with unread data in it is kept
+    EXPECT_FALSE(buffer.release());
+    EXPECT_TRUE(buffer.hasStorage());
+
+    buffer.consume(data.size());
+    EXPECT_TRUE(buffer.release());
+    EXPECT_FALSE(buffer.hasStorage());
+    EXPECT_EQ(buffer.capacity(), 0U);
+    EXPECT_EQ(pool.getBlocksInUse(), inUse);
+}
+
+} // namespace
+} // namespace bmcweb
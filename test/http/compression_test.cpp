@@ -0,0 +1,91 @@
+#include "compression.hpp"
+#include "http_utility.hpp"
+
+#include <zlib.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace bmcweb
+{
+namespace
+{
+
+std::string inflateAll(std::string_view compressed, int windowBits)
+{
+    z_stream stream{};
+    EXPECT_EQ(inflateInit2(&stream, windowBits), Z_OK);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(
+        compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    std::string out;
+    std::array<char, 1024> buf{};
+    int ret = Z_OK;
+    while (ret == Z_OK)
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(buf.data());
+        stream.avail_out = static_cast<uInt>(buf.size());
+        ret = inflate(&stream, Z_NO_FLUSH);
+        out.append(buf.data(), buf.size() - stream.avail_out);
+    }
+    EXPECT_EQ(ret, Z_STREAM_END);
+    inflateEnd(&stream);
+    return out;
+}
+
+std::string testData()
+{
+    std::string data;
+    for (int i = 0; i < 10000; i++)
+    {
+        data += "{\"@odata.id\": \"/redfish/v1/Chassis/" + std::to_string(i) +
+                "\"}";
+    }
+    return data;
+}
+
+TEST(Compressor, GzipRoundTrip)
+{
+    std::string data = testData();
+    std::string out;
+    ASSERT_TRUE(Compressor::compress(
+        data, out, http_helpers::ContentEncoding::Gzip, 4));
+    EXPECT_LT(out.size(), data.size());
+    // gzip magic
+    ASSERT_GE(out.size(), 2U);
+    EXPECT_EQ(static_cast<unsigned char>(out[0]), 0x1f);
+    EXPECT_EQ(static_cast<unsigned char>(out[1]), 0x8b);
+    EXPECT_EQ(inflateAll(out, 15 + 16), data);
+}
+
+TEST(Compressor, DeflateRoundTrip)
+{
+    std::string data = testData();
+    std::string out;
+    ASSERT_TRUE(Compressor::compress(
+        data, out, http_helpers::ContentEncoding::Deflate, 9));
+    EXPECT_EQ(inflateAll(out, 15), data);
+}
+
+TEST(Compressor, Streaming)
+{
+    std::string data = testData();
+    Compressor compressor;
+    ASSERT_TRUE(compressor.init(http_helpers::ContentEncoding::Gzip, 1));
+    std::string out;
+    std::string_view remaining = data;
+    while (remaining.size() > 1000)
+    {
+        ASSERT_TRUE(compressor.compress(remaining.substr(0, 1000), out, false));
+        remaining.remove_prefix(1000);
+    }
+    ASSERT_TRUE(compressor.compress(remaining, out, true));
+    EXPECT_EQ(inflateAll(out, 15 + 16), data);
+}
+
+} // namespace
+} // namespace bmcweb
@@ -1,4 +1,5 @@
 #include "async_resp.hpp"
+#include "bmcweb_config.h"
 #include "http/http2_connection.hpp"
 #include "http/http_request.hpp"
 #include "http/http_response.hpp"
@@ -58,6 +59,17 @@ std::string getDateStr()
     return "TestTime";
 }
 
+// HTTP/2 frames encode integers as big endian
+std::string bigEndian32(uint32_t value)
+{
+    std::string out;
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        out += static_cast<char>((value >> shift) & 0xFFU);
+    }
+    return out;
+}
+
 void unpackHeaders(std::string_view dataField,
                    std::vector<std::pair<std::string, std::string>>& headers)
 {
@@ -127,18 +139,27 @@ TEST(http_connection, RequestPropogates)
         std::move(stream), &handler, date);
     conn->start();
 
-    std::string_view expectedPrefix =
-        // Settings frame size 13
-        "\x00\x00\x0c\x04\x00\x00\x00\x00\x00"
-        // 4 max concurrent streams
-        "\x00\x03\x00\x00\x00\x04"
+    std::string expectedPrefix =
+        // Settings frame size 18
+        "\x00\x00\x12\x04\x00\x00\x00\x00\x00"s
+        // Max concurrent streams
+        + "\x00\x03"s + bigEndian32(BMCWEB_HTTP2_MAX_CONCURRENT_STREAMS)
+        // Initial window size
+        + "\x00\x04"s + bigEndian32(BMCWEB_HTTP2_INITIAL_WINDOW_SIZE)
         // Enable push = false
-        "\x00\x02\x00\x00\x00\x00"
+        + "\x00\x02\x00\x00\x00\x00"s;
+    if constexpr (BMCWEB_HTTP2_CONNECTION_WINDOW_SIZE > 65535)
+    {
+        // Window update frame raising the connection window from its default
+        expectedPrefix += "\x00\x00\x04\x08\x00\x00\x00\x00\x00"s;
+        expectedPrefix += bigEndian32(BMCWEB_HTTP2_CONNECTION_WINDOW_SIZE -
+                                      65535);
+    }
+    expectedPrefix +=
         // Settings ACK from server to client
         "\x00\x00\x00\x04\x01\x00\x00\x00\x00"
-
         // Start Headers frame stream 1, size 0x005f
-        "\x00\x00\x5f\x01\x04\x00\x00\x00\x01"sv;
+        "\x00\x00\x5f\x01\x04\x00\x00\x00\x01"s;
 
     std::string_view expectedPostfix =
         // Data Frame, Length 12, Stream 1, End Stream flag set
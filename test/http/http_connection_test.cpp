@@ -1,20 +1,30 @@
 #include "async_resp.hpp"
+#include "http/buffer_pool.hpp"
 #include "http/http_connection.hpp"
 #include "http/http_request.hpp"
 #include "http/http_response.hpp"
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/io_context.hpp>
-#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/beast/_experimental/test/stream.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/verb.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 namespace crow
@@ -68,13 +78,12 @@ TEST(http_connection, RequestPropogates)
     out.write_some(boost::asio::buffer(
         "GET / HTTP/1.1\r\nHost: openbmc_project.xyz\r\nConnection: close\r\n\r\n"));
     FakeHandler handler;
-    boost::asio::steady_timer timer(io);
     std::function<std::string()> date(
         std::bind_front(&ClockFake::getDateStr, &clock));
     std::shared_ptr<crow::Connection<boost::beast::test::stream, FakeHandler>>
         conn = std::make_shared<
             crow::Connection<boost::beast::test::stream, FakeHandler>>(
-            &handler, std::move(timer), date, std::move(stream));
+            &handler, date, std::move(stream));
     conn->start();
     io.run_for(std::chrono::seconds(1000));
     EXPECT_TRUE(handler.called);
@@ -93,4 +102,209 @@ TEST(http_connection, RequestPropogates)
     EXPECT_TRUE(clock.wascalled);
 }
 
+struct PipelineHandler
+{
+    static void
+        handleUpgrade(const std::shared_ptr<Request>& /*req*/,
+                      const std::shared_ptr<bmcweb::AsyncResp>& /*asyncResp*/,
+                      boost::beast::test::stream&& /*adaptor*/)
+    {
+        EXPECT_FALSE(true);
+    }
+
+    void handle(const std::shared_ptr<Request>& req,
+                const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+    {
+        std::string target(req->target());
+        handled.push_back(target);
+        if (target == "/slow")
+        {
+            // Held until the request behind it has been handled
+            slow = asyncResp;
+            return;
+        }
+        asyncResp->res.write("fast");
+        boost::asio::post(*req->ioService, [this]() {
+            slow->res.write("slow");
+            slow = nullptr;
+        });
+    }
+
+    std::vector<std::string> handled;
+    std::shared_ptr<bmcweb::AsyncResp> slow;
+};
+
+TEST(http_connection, PipelinedResponsesStayInOrder)
+{
+    boost::asio::io_context io;
+    ClockFake clock;
+    boost::beast::test::stream stream(io);
+    boost::beast::test::stream out(io);
+    stream.connect(out);
+
+    out.write_some(boost::asio::buffer(
+        "GET /slow HTTP/1.1\r\nHost: openbmc_project.xyz\r\n\r\n"
+        "GET /fast HTTP/1.1\r\nHost: openbmc_project.xyz\r\n"
+        "Connection: close\r\n\r\n"));
+    PipelineHandler handler;
+    std::function<std::string()> date(
+        std::bind_front(&ClockFake::getDateStr, &clock));
+    using ConnectionType =
+        crow::Connection<boost::beast::test::stream, PipelineHandler>;
+    std::shared_ptr<ConnectionType> conn = std::make_shared<ConnectionType>(
+        &handler, date, std::move(stream));
+    conn->start();
+    io.run_for(std::chrono::seconds(1000));
+
+    // The second request was handled while the first was still outstanding,
+    // but its response is sent second
+    std::vector<std::string> expectedOrder{"/slow", "/fast"};
+    EXPECT_EQ(handler.handled, expectedOrder);
+    std::string outStr = out.str();
+    size_t slowPos = outStr.find("\r\n\r\nslow");
+    size_t fastPos = outStr.find("\r\n\r\nfast");
+    ASSERT_NE(slowPos, std::string::npos);
+    ASSERT_NE(fastPos, std::string::npos);
+    EXPECT_LT(slowPos, fastPos);
+    EXPECT_NE(outStr.find("Connection: close", slowPos), std::string::npos);
+}
+
+struct FileHandler
+{
+    static void
+        handleUpgrade(const std::shared_ptr<Request>& /*req*/,
+                      const std::shared_ptr<bmcweb::AsyncResp>& /*asyncResp*/,
+                      boost::asio::ip::tcp::socket&& /*adaptor*/)
+    {
+        EXPECT_FALSE(true);
+    }
+
+    void handle(const std::shared_ptr<Request>& /*req*/,
+                const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) const
+    {
+        EXPECT_TRUE(asyncResp->res.openFile(path));
+    }
+    std::filesystem::path path;
+};
+
+TEST(http_connection, FileSentWithSendfile)
+{
+    // Large enough to take several trips through the socket buffer
+    std::string contents(3UL * 1024UL * 1024UL, '\0');
+    for (size_t i = 0; i < contents.size(); i++)
+    {
+        contents[i] = static_cast<char>('a' + i % 26);
+    }
+    FileHandler handler;
+    handler.path = std::filesystem::temp_directory_path() /
+                   "http_connection_sendfile_test";
+    {
+        std::ofstream file(handler.path, std::ios::binary);
+        file << contents;
+    }
+
+    boost::asio::io_context io;
+    boost::asio::ip::tcp::acceptor acceptor(
+        io, boost::asio::ip::tcp::endpoint(
+                boost::asio::ip::make_address("127.0.0.1"), 0));
+    boost::asio::ip::tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    boost::asio::ip::tcp::socket server = acceptor.accept();
+
+    ClockFake clock;
+    std::function<std::string()> date(
+        std::bind_front(&ClockFake::getDateStr, &clock));
+    using ConnectionType =
+        crow::Connection<boost::asio::ip::tcp::socket, FileHandler>;
+    std::shared_ptr<ConnectionType> conn = std::make_shared<ConnectionType>(
+        &handler, date, std::move(server));
+    conn->start();
+
+    std::string_view request =
+        "GET / HTTP/1.1\r\nHost: openbmc_project.xyz\r\n"
+        "Connection: close\r\n\r\n";
+    boost::asio::write(client, boost::asio::buffer(request));
+    std::string response;
+    boost::asio::async_read(client, boost::asio::dynamic_buffer(response),
+                            [](const boost::system::error_code&, size_t) {});
+    io.run_for(std::chrono::seconds(10));
+    std::filesystem::remove(handler.path);
+
+    size_t headerEnd = response.find("\r\n\r\n");
+    ASSERT_NE(headerEnd, std::string::npos);
+    std::string_view header(response.data(), headerEnd);
+    EXPECT_NE(header.find("Content-Length: 3145728"), std::string::npos);
+    EXPECT_EQ(response.substr(headerEnd + 4), contents);
+}
+
+struct OkHandler
+{
+    static void
+        handleUpgrade(const std::shared_ptr<Request>& /*req*/,
+                      const std::shared_ptr<bmcweb::AsyncResp>& /*asyncResp*/,
+                      boost::asio::ip::tcp::socket&& /*adaptor*/)
+    {
+        EXPECT_FALSE(true);
+    }
+
+    static void handle(const std::shared_ptr<Request>& /*req*/,
+                       const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+    {
+        asyncResp->res.write("ok");
+    }
+};
+
+TEST(http_connection, IdleConnectionHoldsNoReadBuffer)
+{
+    bmcweb::BufferPool& pool =
+        bmcweb::BufferPool::getInstance<httpReadBufferSize>();
+    size_t inUse = pool.getBlocksInUse();
+
+    boost::asio::io_context io;
+    boost::asio::ip::tcp::acceptor acceptor(
+        io, boost::asio::ip::tcp::endpoint(
+                boost::asio::ip::make_address("127.0.0.1"), 0));
+    boost::asio::ip::tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    boost::asio::ip::tcp::socket server = acceptor.accept();
+
+    OkHandler handler;
+    ClockFake clock;
+    std::function<std::string()> date(
+        std::bind_front(&ClockFake::getDateStr, &clock));
+    using ConnectionType =
+        crow::Connection<boost::asio::ip::tcp::socket, OkHandler>;
+    std::shared_ptr<ConnectionType> conn = std::make_shared<ConnectionType>(
+        &handler, date, std::move(server));
+    conn->start();
+    EXPECT_EQ(pool.getBlocksInUse(), inUse + 1);
+
+    std::string_view request =
+        "GET / HTTP/1.1\r\nHost: openbmc_project.xyz\r\n\r\n";
+    boost::asio::write(client, boost::asio::buffer(request));
+    std::string response;
+    boost::asio::async_read_until(
+        client, boost::asio::dynamic_buffer(response), "\r\n\r\nok",
+        [&io](const boost::system::error_code&, size_t) { io.stop(); });
+    io.run_for(std::chrono::seconds(10));
+    io.restart();
+    io.poll();
+
+    // The connection is waiting for the next request, holding no buffer
+    EXPECT_NE(response.find("\r\n\r\nok"), std::string::npos);
+    EXPECT_EQ(pool.getBlocksInUse(), inUse);
+
+    std::string_view closeRequest =
+        "GET / HTTP/1.1\r\nHost: openbmc_project.xyz\r\n"
+        "Connection: close\r\n\r\n";
+    boost::asio::write(client, boost::asio::buffer(closeRequest));
+    response.clear();
+    boost::asio::async_read(client, boost::asio::dynamic_buffer(response),
+                            [](const boost::system::error_code&, size_t) {});
+    io.run_for(std::chrono::seconds(10));
+
+    EXPECT_NE(response.find("Connection: close"), std::string::npos);
+    EXPECT_NE(response.find("\r\n\r\nok"), std::string::npos);
+}
+
 } // namespace crow
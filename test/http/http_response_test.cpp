@@ -3,6 +3,8 @@
 #include "http/http_response.hpp"
 #include "utility.hpp"
 
+#include <zlib.h>
+
 #include <boost/beast/core/buffers_to_string.hpp>
 #include <boost/beast/core/file_base.hpp>
 #include <boost/beast/core/file_posix.hpp>
@@ -12,6 +14,7 @@
 
 #include <cstdio>
 #include <filesystem>
+#include <optional>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -30,11 +33,13 @@ void verifyHeaders(crow::Response& res)
     EXPECT_EQ(res.result(), boost::beast::http::status::ok);
 }
 
-std::string getData(boost::beast::http::response<bmcweb::HttpBody>& m)
+std::string getData(crow::Response::response_type& m)
 {
     std::string ret;
 
-    boost::beast::http::response_serializer<bmcweb::HttpBody> sr{m};
+    boost::beast::http::response_serializer<bmcweb::HttpBody,
+                                            crow::Response::Fields>
+        sr{m};
     sr.split(true);
     // Reads buffers into ret
     auto reader = [&sr, &ret](const boost::system::error_code& ec2,
@@ -182,4 +187,177 @@ TEST(HttpResponse, HttpBodyWriterLarge)
     EXPECT_EQ(getData(res.response), data);
 }
 
+TEST(HttpResponse, ByteRange)
+{
+    crow::Response res;
+    std::string data = generateBigdata();
+    TemporaryFileHandle temporaryFile(data);
+    ASSERT_TRUE(res.openFile(temporaryFile.stringPath));
+    ASSERT_TRUE(res.setByteRanges({{100, 5099}}));
+    EXPECT_EQ(res.result(), boost::beast::http::status::partial_content);
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::content_range),
+              "bytes 100-5099/10010");
+    EXPECT_EQ(res.size(), 5000);
+    EXPECT_EQ(getData(res.response), data.substr(100, 5000));
+}
+
+TEST(HttpResponse, MultipleByteRanges)
+{
+    crow::Response res;
+    TemporaryFileHandle temporaryFile("sample text");
+    ASSERT_TRUE(res.openFile(temporaryFile.stringPath));
+    res.addHeader(boost::beast::http::field::content_type, "text/plain");
+    ASSERT_TRUE(res.setByteRanges({{0, 5}, {7, 10}}));
+    EXPECT_EQ(res.result(), boost::beast::http::status::partial_content);
+
+    std::string_view contentType =
+        res.getHeaderValue(boost::beast::http::field::content_type);
+    std::string_view prefix = "multipart/byteranges; boundary=";
+    ASSERT_TRUE(contentType.starts_with(prefix));
+    std::string boundary(contentType.substr(prefix.size()));
+    std::string expected = "\r\n--" + boundary +
+                           "\r\n"
+                           "Content-Type: text/plain\r\n"
+                           "Content-Range: bytes 0-5/11\r\n\r\n"
+                           "sample\r\n--" +
+                           boundary +
+                           "\r\n"
+                           "Content-Type: text/plain\r\n"
+                           "Content-Range: bytes 7-10/11\r\n\r\n"
+                           "text\r\n--" +
+                           boundary + "--\r\n";
+    EXPECT_EQ(res.size(), expected.size());
+    EXPECT_EQ(getData(res.response), expected);
+}
+
+TEST(HttpResponse, Base64ByteRanges)
+{
+    std::string data = generateBigdata();
+    std::string encoded = crow::utility::base64encode(data);
+    TemporaryFileHandle temporaryFile(data);
+    // Ranges of the encoded payload that start and end partway through a
+    // group of 4 characters, including the padded end
+    for (size_t first : {0UL, 1UL, 2UL, 3UL, 4UL, 7000UL})
+    {
+        for (size_t last : {first, first + 2, encoded.size() - 2,
+                            encoded.size() - 1})
+        {
+            crow::Response res;
+            ASSERT_TRUE(res.openFile(temporaryFile.stringPath,
+                                     bmcweb::EncodingType::Base64));
+            ASSERT_TRUE(res.setByteRanges({{first, last}}));
+            EXPECT_EQ(getData(res.response),
+                      encoded.substr(first, last - first + 1));
+        }
+    }
+}
+
+TEST(HttpResponse, ByteRangeNotSatisfiable)
+{
+    crow::Response res;
+    TemporaryFileHandle temporaryFile("sample text");
+    ASSERT_TRUE(res.openFile(temporaryFile.stringPath));
+    ASSERT_TRUE(res.setByteRanges({}));
+    EXPECT_EQ(res.result(),
+              boost::beast::http::status::range_not_satisfiable);
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::content_range),
+              "bytes */11");
+    EXPECT_EQ(res.size(), 0);
+}
+
+TEST(HttpResponse, JsonBodySmall)
+{
+    crow::Response res;
+    res.jsonValue["Name"] = "value";
+    std::string expected = res.jsonValue.dump(2);
+    res.writeJson(2);
+    EXPECT_EQ(res.size(), expected.size());
+    EXPECT_EQ(*res.body(), expected);
+    EXPECT_EQ(getData(res.response), expected);
+}
+
+TEST(HttpResponse, JsonBodyWriterLarge)
+{
+    crow::Response res;
+    std::string data = generateBigdata();
+    nlohmann::json& members = res.jsonValue["Members"];
+    for (size_t i = 0; i < 10000; i++)
+    {
+        members.push_back(data.substr(0, i % 100));
+    }
+    std::string expected = res.jsonValue.dump(2);
+    res.writeJson(2);
+    EXPECT_EQ(res.size(), std::nullopt);
+    EXPECT_EQ(getData(res.response), expected);
+}
+
+TEST(HttpResponse, JsonBodyWriterCopied)
+{
+    crow::Response res;
+    std::string data = generateBigdata();
+    nlohmann::json& members = res.jsonValue["Members"];
+    for (size_t i = 0; i < 10000; i++)
+    {
+        members.push_back(data.substr(0, i % 100));
+    }
+    std::string expected = res.jsonValue.dump(2);
+    res.writeJson(2);
+
+    // The copy starts again from the beginning, and the original carries on
+    // from the chunk serialized by writeJson
+    crow::Response::response_type copy = res.response;
+    EXPECT_EQ(getData(copy), expected);
+    EXPECT_EQ(getData(res.response), expected);
+}
+
+TEST(HttpResponse, JsonBodyWriterCompressed)
+{
+    crow::Response res;
+    std::string data = generateBigdata();
+    nlohmann::json& members = res.jsonValue["Members"];
+    for (size_t i = 0; i < 10000; i++)
+    {
+        members.push_back(data.substr(0, i % 100));
+    }
+    std::string expected = res.jsonValue.dump(2);
+    res.writeJson(2);
+    res.response.body().jsonContentEncoding(
+        http_helpers::ContentEncoding::Deflate);
+    std::string compressed = getData(res.response);
+    EXPECT_LT(compressed.size(), expected.size());
+
+    std::string inflated(expected.size(), '\0');
+    uLongf inflatedSize = inflated.size();
+    ASSERT_EQ(uncompress(reinterpret_cast<Bytef*>(inflated.data()),
+                         &inflatedSize,
+                         reinterpret_cast<const Bytef*>(compressed.data()),
+                         compressed.size()),
+              Z_OK);
+    inflated.resize(inflatedSize);
+    EXPECT_EQ(inflated, expected);
+}
+
+TEST(HttpResponse, NotModifiedEncodedEtag)
+{
+    crow::Response res;
+    res.jsonValue["Name"] = "value";
+    std::string etag = res.computeEtag();
+
+    // The tag of a compressed copy is still current
+    std::string gzipEtag =
+        http_helpers::getEncodedEtag(etag, http_helpers::ContentEncoding::Gzip);
+    res.setExpectedHash(gzipEtag);
+    res.setHashAndHandleNotModified();
+    EXPECT_EQ(res.result(), boost::beast::http::status::not_modified);
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::etag), gzipEtag);
+
+    crow::Response changed;
+    changed.jsonValue["Name"] = "other";
+    changed.setExpectedHash(gzipEtag);
+    changed.setHashAndHandleNotModified();
+    EXPECT_EQ(changed.result(), boost::beast::http::status::ok);
+    EXPECT_EQ(changed.getHeaderValue(boost::beast::http::field::etag),
+              changed.computeEtag());
+}
+
 } // namespace
@@ -0,0 +1,119 @@
+#include "json_serializer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace bmcweb
+{
+namespace
+{
+
+std::string serializeInChunks(const nlohmann::json& value, int indent,
+                              size_t chunk)
+{
+    JsonSerializer serializer(value, indent);
+    std::string out;
+    while (!serializer.done())
+    {
+        std::string part;
+        serializer.fill(part, chunk);
+        out += part;
+    }
+    return out;
+}
+
+nlohmann::json testDocument()
+{
+    nlohmann::json value;
+    value["@odata.id"] = "/redfish/v1/Chassis";
+    value["Name"] = "Chassis Collection";
+    value["Members@odata.count"] = 3;
+    value["Empty"] = nlohmann::json::object();
+    value["EmptyArray"] = nlohmann::json::array();
+    value["Null"] = nullptr;
+    value["Bool"] = false;
+    value["Float"] = 1.5;
+    value["Negative"] = -42;
+    value["Escaped \"key\""] = "tab\there\nnewline \\ \x7f";
+    value["Unicode"] = "caf\xc3\xa9";
+    value["Invalid"] = "bad\xff";
+    nlohmann::json& members = value["Members"];
+    for (int i = 0; i < 3; i++)
+    {
+        members.push_back(
+            {{"@odata.id", "/redfish/v1/Chassis/" + std::to_string(i)},
+             {"Nested", {{"Array", {1, 2, {{"Deep", true}}}}}}});
+    }
+    return value;
+}
+
+TEST(JsonSerializer, MatchesDumpPretty)
+{
+    nlohmann::json value = testDocument();
+    std::string expected =
+        value.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+    for (size_t chunk : {1, 7, 64, 1024 * 16})
+    {
+        EXPECT_EQ(serializeInChunks(value, 2, chunk), expected);
+    }
+}
+
+TEST(JsonSerializer, MatchesDumpCompact)
+{
+    nlohmann::json value = testDocument();
+    std::string expected =
+        value.dump(-1, ' ', true, nlohmann::json::error_handler_t::replace);
+    for (size_t chunk : {1, 7, 64, 1024 * 16})
+    {
+        EXPECT_EQ(serializeInChunks(value, -1, chunk), expected);
+    }
+}
+
+TEST(JsonSerializer, Scalars)
+{
+    EXPECT_EQ(serializeInChunks(nlohmann::json::object(), 2, 1), "{}");
+    EXPECT_EQ(serializeInChunks(nlohmann::json::array(), 2, 1), "[]");
+    EXPECT_EQ(serializeInChunks("string", 2, 1), "\"string\"");
+    EXPECT_EQ(serializeInChunks(nullptr, 2, 1), "null");
+    EXPECT_EQ(serializeInChunks(true, 2, 1), "true");
+    EXPECT_EQ(serializeInChunks(std::numeric_limits<int64_t>::min(), 2, 1),
+              "-9223372036854775808");
+    EXPECT_EQ(serializeInChunks(std::numeric_limits<uint64_t>::max(), 2, 1),
+              "18446744073709551615");
+}
+
+TEST(JsonSerializer, DeeplyNested)
+{
+    nlohmann::json value = 1;
+    for (int i = 0; i < 20; i++)
+    {
+        value = nlohmann::json::array({value, i});
+    }
+    std::string expected =
+        value.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+    EXPECT_EQ(serializeInChunks(value, 2, 7), expected);
+}
+
+TEST(JsonSerializer, ChunkIsBounded)
+{
+    nlohmann::json value = nlohmann::json::array();
+    for (int i = 0; i < 1000; i++)
+    {
+        value.push_back(i);
+    }
+    JsonSerializer serializer(value, 2);
+    std::string part;
+    serializer.fill(part, 100);
+    EXPECT_FALSE(serializer.done());
+    EXPECT_GE(part.size(), 100U);
+    EXPECT_LT(part.size(), 120U);
+}
+
+} // namespace
+} // namespace bmcweb
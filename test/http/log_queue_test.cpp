@@ -0,0 +1,112 @@
+#include "log_queue.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow
+{
+namespace
+{
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<std::string> lines;
+
+void collect(std::string_view line)
+{
+    lines.emplace_back(line);
+}
+
+TEST(LogQueue, WritesInOrderAndCountsDrops)
+{
+    lines.clear();
+    LogQueue queue(4, &collect);
+    EXPECT_EQ(queue.getCapacity(), 4U);
+    for (int i = 0; i < 5; i++)
+    {
+        bool pushed = queue.push([i](LogMessage& message) {
+            message.format("line {}", i);
+            message.append('\n');
+        });
+        EXPECT_EQ(pushed, i < 4);
+    }
+    EXPECT_EQ(queue.getDropped(), 1U);
+    EXPECT_TRUE(lines.empty());
+
+    queue.flush();
+    ASSERT_EQ(lines.size(), 5U);
+    EXPECT_EQ(lines[0], "line 0\n");
+    EXPECT_EQ(lines[3], "line 3\n");
+    EXPECT_NE(lines[4].find("1 log lines dropped"), std::string::npos);
+
+    // Slots are reused once written out
+    lines.clear();
+    EXPECT_TRUE(queue.push(
+        [](LogMessage& message) { message.format("again{}", '\n'); }));
+    queue.flush();
+    ASSERT_EQ(lines.size(), 1U);
+    EXPECT_EQ(lines[0], "again\n");
+}
+
+TEST(LogQueue, LongLinesAreKeptWhole)
+{
+    lines.clear();
+    LogQueue queue(2, &collect);
+    std::string longText(LogMessage::inlineSize * 3, 'x');
+    EXPECT_TRUE(queue.push([&longText](LogMessage& message) {
+        message.format("[{}] ", "prefix");
+        message.format("{}", longText);
+        message.append('\n');
+    }));
+    queue.flush();
+    ASSERT_EQ(lines.size(), 1U);
+    EXPECT_EQ(lines[0], "[prefix] " + longText + "\n");
+}
+
+TEST(LogQueue, BackgroundThreadWritesEverything)
+{
+    lines.clear();
+    LogQueue queue(1024, &collect);
+    queue.start();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; t++)
+    {
+        producers.emplace_back([&queue, t]() {
+            for (int i = 0; i < 200; i++)
+            {
+                while (!queue.push([t, i](LogMessage& message) {
+                    message.format("{} {}", t, i);
+                }))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    queue.stop();
+
+    size_t lineCount = 0;
+    for (const std::string& line : lines)
+    {
+        if (line.find("dropped") == std::string::npos)
+        {
+            lineCount++;
+        }
+    }
+    EXPECT_EQ(lineCount, 800U);
+}
+
+} // namespace
+} // namespace crow
@@ -0,0 +1,115 @@
+#include "request_arena.hpp"
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/fields.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace bmcweb
+{
+namespace
+{
+
+TEST(RequestArena, ResetOnlyOnceEverythingIsReleased)
+{
+    std::shared_ptr<RequestArena> arena = std::make_shared<RequestArena>();
+    std::shared_ptr<std::string> str = std::allocate_shared<std::string>(
+        ArenaAllocator<std::string>(arena), "request");
+    std::shared_ptr<int> value =
+        std::allocate_shared<int>(ArenaAllocator<int>(arena), 42);
+    EXPECT_FALSE(arena->reset());
+
+    str.reset();
+    EXPECT_FALSE(arena->reset());
+    EXPECT_EQ(*value, 42);
+
+    value.reset();
+    EXPECT_TRUE(arena->reset());
+    EXPECT_EQ(arena.use_count(), 1);
+}
+
+TEST(RequestArena, ReusesMemoryAfterReset)
+{
+    std::shared_ptr<RequestArena> arena = std::make_shared<RequestArena>();
+    const void* first =
+        std::allocate_shared<int>(ArenaAllocator<int>(arena), 1).get();
+    ASSERT_TRUE(arena->reset());
+    const void* second =
+        std::allocate_shared<int>(ArenaAllocator<int>(arena), 2).get();
+    EXPECT_EQ(first, second);
+}
+
+TEST(RequestArena, OutlivesOwner)
+{
+    std::shared_ptr<RequestArena> arena = std::make_shared<RequestArena>();
+    std::shared_ptr<std::string> str = std::allocate_shared<std::string>(
+        ArenaAllocator<std::string>(arena), std::string(8192, 'a'));
+    // The allocation keeps the arena alive once its owner lets go
+    arena.reset();
+    EXPECT_EQ(str->size(), 8192U);
+}
+
+TEST(RequestArena, PoolReusesFreeArenas)
+{
+    std::shared_ptr<RequestArena> arena = RequestArena::acquire();
+    const RequestArena* first = arena.get();
+    RequestArena::release(std::move(arena));
+    EXPECT_EQ(arena, nullptr);
+
+    arena = RequestArena::acquire();
+    EXPECT_EQ(arena.get(), first);
+    RequestArena::release(std::move(arena));
+}
+
+TEST(RequestArena, PoolSkipsArenasInUse)
+{
+    std::shared_ptr<RequestArena> arena = RequestArena::acquire();
+    const RequestArena* first = arena.get();
+    std::shared_ptr<int> value =
+        std::allocate_shared<int>(ArenaAllocator<int>(arena), 42);
+    RequestArena::release(std::move(arena));
+
+    std::shared_ptr<RequestArena> other = RequestArena::acquire();
+    EXPECT_NE(other.get(), first);
+
+    // Handed out again once the request is done with it
+    value.reset();
+    arena = RequestArena::acquire();
+    EXPECT_EQ(arena.get(), first);
+    RequestArena::release(std::move(arena));
+    RequestArena::release(std::move(other));
+}
+
+TEST(RequestArena, FieldsAllocateFromArena)
+{
+    using Fields = boost::beast::http::basic_fields<ArenaAllocator<char>>;
+    std::shared_ptr<RequestArena> arena = std::make_shared<RequestArena>();
+    Fields fields{ArenaAllocator<char>(arena)};
+    fields.set(boost::beast::http::field::content_type, "application/json");
+    fields.set("OData-Version", "4.0");
+    EXPECT_FALSE(arena->reset());
+
+    // The allocator goes along with the headers, so they're still freed
+    // back to the arena
+    Fields moved;
+    moved = std::move(fields);
+    EXPECT_EQ(moved["OData-Version"], "4.0");
+    moved.clear();
+    EXPECT_TRUE(arena->reset());
+
+    // Without an arena, the heap is used
+    Fields heap;
+    heap.set("OData-Version", "4.0");
+    EXPECT_EQ(heap["OData-Version"], "4.0");
+}
+
+} // namespace
+} // namespace bmcweb
@@ -0,0 +1,154 @@
+#include "app.hpp"
+#include "redfish.hpp"
+#include "routing/baserule.hpp"
+#include "routing.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow
+{
+namespace
+{
+
+using ::crow::utility::isSegmentRoute;
+
+static_assert(isSegmentRoute("/redfish/v1/Systems/<str>/"));
+static_assert(isSegmentRoute("/redfish/<path>"));
+static_assert(isSegmentRoute("/"));
+static_assert(!isSegmentRoute("/redfish/<path>/foo"));
+static_assert(!isSegmentRoute("/redfish/v1/Foo<str>"));
+static_assert(!isSegmentRoute("redfish"));
+
+// Fills in every parameter of a rule to make a url that matches it
+std::string fillParams(std::string_view rule)
+{
+    std::string url;
+    while (!rule.empty())
+    {
+        if (rule.starts_with("<str>"))
+        {
+            url += "param";
+            rule.remove_prefix(5);
+        }
+        else if (rule.starts_with("<path>"))
+        {
+            url += "path/param";
+            rule.remove_prefix(6);
+        }
+        else
+        {
+            url += rule.front();
+            rule.remove_prefix(1);
+        }
+    }
+    return url;
+}
+
+void expectSameResult(const Trie& trie, const RouteTable& table,
+                      std::string_view url)
+{
+    for (Trie::TableBits paramTables :
+         {static_cast<Trie::TableBits>(0U),
+          static_cast<Trie::TableBits>(Trie::tableBit(0) |
+                                       Trie::tableBit(notFoundTable)),
+          std::numeric_limits<Trie::TableBits>::max()})
+    {
+        Trie::FindResult expected = trie.find(url, paramTables);
+        Trie::FindResult actual = table.find(url, paramTables);
+        EXPECT_EQ(expected.ruleIndexes, actual.ruleIndexes) << url;
+        EXPECT_EQ(expected.params, actual.params) << url;
+    }
+}
+
+TEST(RouteTable, AgreesWithTrieOnEveryRoute)
+{
+    App app;
+    redfish::RedfishService redfish(app);
+    app.validate();
+    std::vector<const BaseRule*> rules = app.getRouter().getRules();
+    ASSERT_FALSE(rules.empty());
+
+    // Add every rule the way the router does, to the table of each verb it
+    // handles, so that a url handled by several rules matches in several
+    // tables at once
+    Trie trie;
+    RouteTable table;
+    std::set<std::string, std::less<>> urls;
+    unsigned ruleIndex = 1U;
+    for (const BaseRule* rule : rules)
+    {
+        auto add = [&trie, &table, ruleIndex](std::string_view url,
+                                              size_t tableIndex) {
+            trie.add(url, tableIndex, ruleIndex);
+            EXPECT_TRUE(table.add(url, tableIndex, ruleIndex)) << url;
+        };
+        Router::forEachRoute(rule->rule, *rule, add);
+        urls.emplace(rule->rule);
+        ruleIndex++;
+    }
+    trie.validate();
+    ASSERT_TRUE(table.compile());
+
+    // Routes with parameters are the ones most likely to disagree
+    EXPECT_TRUE(std::ranges::any_of(urls, [](std::string_view url) {
+        return url.find("<str>") != std::string_view::npos;
+    }));
+
+    for (const std::string& route : urls)
+    {
+        std::string url = fillParams(route);
+        expectSameResult(trie, table, url);
+        expectSameResult(trie, table, url + "/");
+        expectSameResult(trie, table, url + "/missing");
+        expectSameResult(trie, table, url.substr(0, url.size() / 2));
+    }
+    expectSameResult(trie, table, "");
+    expectSameResult(trie, table, "/");
+    expectSameResult(trie, table, "//");
+    expectSameResult(trie, table, "*");
+}
+
+TEST(RouteTable, ParametersAndTables)
+{
+    RouteTable table;
+    EXPECT_TRUE(table.add("/foo/<str>", 0U, 1U));
+    EXPECT_TRUE(table.add("/foo/bar", 1U, 2U));
+    EXPECT_TRUE(table.add("/foo/<path>", notFoundTable, 3U));
+    EXPECT_FALSE(table.add("/foo<str>", 0U, 4U));
+    ASSERT_TRUE(table.compile());
+
+    Trie::FindResult found = table.find("/foo/bar", 0xFFFFU);
+    EXPECT_EQ(found.ruleIndexes[0], 1U);
+    EXPECT_EQ(found.ruleIndexes[1], 2U);
+    EXPECT_EQ(found.ruleIndexes[notFoundTable], 3U);
+    ASSERT_EQ(found.params[0].size(), 1U);
+    EXPECT_EQ(found.params[0][0], "bar");
+    EXPECT_TRUE(found.params[1].empty());
+
+    found = table.find("/foo/bar/baz", 0xFFFFU);
+    EXPECT_EQ(found.ruleIndexes[0], 0U);
+    EXPECT_EQ(found.ruleIndexes[1], 0U);
+    ASSERT_EQ(found.params[notFoundTable].size(), 1U);
+    EXPECT_EQ(found.params[notFoundTable][0], "bar/baz");
+
+    // <str> never matches an empty segment
+    found = table.find("/foo/", 0xFFFFU);
+    EXPECT_EQ(found.ruleIndexes[0], 0U);
+}
+
+} // namespace
+} // namespace crow
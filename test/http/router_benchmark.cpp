@@ -0,0 +1,106 @@
+#include "app.hpp"
+#include "http_request.hpp"
+#include "redfish.hpp"
+#include "routing.hpp"
+#include "routing/baserule.hpp"
+
+#include <boost/beast/http/verb.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// Measures Router::findRoute against the registered Redfish route set.
+// Run with "meson test --benchmark router_benchmark".
+
+namespace
+{
+
+std::string fillParams(std::string_view rule)
+{
+    std::string url;
+    while (!rule.empty())
+    {
+        if (rule.starts_with("<str>"))
+        {
+            url += "param";
+            rule.remove_prefix(5);
+        }
+        else if (rule.starts_with("<path>"))
+        {
+            url += "path/param";
+            rule.remove_prefix(6);
+        }
+        else
+        {
+            url += rule.front();
+            rule.remove_prefix(1);
+        }
+    }
+    return url;
+}
+
+} // namespace
+
+int main()
+{
+    App app;
+    redfish::RedfishService redfish(app);
+    app.validate();
+
+    // Several rules can share a url, one per verb
+    std::set<std::string, std::less<>> routes;
+    for (const crow::BaseRule* rule : app.getRouter().getRules())
+    {
+        routes.emplace(rule->rule);
+    }
+
+    std::vector<crow::Request> requests;
+    for (const std::string& route : routes)
+    {
+        std::string url = fillParams(route);
+        for (boost::beast::http::verb verb :
+             {boost::beast::http::verb::get, boost::beast::http::verb::patch})
+        {
+            std::error_code ec;
+            requests.emplace_back(crow::Request::Body{verb, url, 11}, ec);
+            // Misses exercise the 404 path
+            requests.emplace_back(
+                crow::Request::Body{verb, url + "/missing", 11}, ec);
+        }
+    }
+
+    const crow::Router& router = app.getRouter();
+    constexpr size_t iterations = 200;
+    size_t matched = 0;
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        for (const crow::Request& req : requests)
+        {
+            crow::Router::FindRouteResponse found = router.findRoute(req);
+            if (found.route.rule != nullptr)
+            {
+                matched++;
+            }
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    size_t lookups = iterations * requests.size();
+
+    std::cout << std::format(
+        "{} routes, {} lookups, {} matched, {:.1f} ns per lookup\n",
+        routes.size(), lookups, matched,
+        elapsed.count() / static_cast<double>(lookups));
+    return 0;
+}
@@ -62,6 +62,49 @@ TEST(Router, AllowHeader)
     EXPECT_NE(router.findRoute(patchReq).route.rule, nullptr);
 }
 
+TEST(Router, AllowHeaderAcrossParameters)
+{
+    auto nullCallback = [](const Request&,
+                           const std::shared_ptr<bmcweb::AsyncResp>&) {};
+    auto paramCallback = [](const Request&,
+                            const std::shared_ptr<bmcweb::AsyncResp>&,
+                            const std::string&) {};
+
+    Router router;
+    std::error_code ec;
+
+    router.newRuleTagged<getParameterTag("/foo/<str>")>("/foo/<str>")
+        .methods(boost::beast::http::verb::get)(paramCallback);
+    router.newRuleTagged<getParameterTag("/foo/bar")>("/foo/bar")
+        .methods(boost::beast::http::verb::post)(nullCallback);
+    router.validate();
+
+    // Each verb matches a different rule for the same url
+    Request getReq{{boost::beast::http::verb::get, "/foo/bar", 11}, ec};
+    Router::FindRouteResponse found = router.findRoute(getReq);
+    EXPECT_EQ(found.allowHeader, "GET, POST");
+    ASSERT_NE(found.route.rule, nullptr);
+    EXPECT_EQ(found.route.rule->rule, "/foo/<str>");
+    ASSERT_EQ(found.route.params.size(), 1U);
+    EXPECT_EQ(found.route.params[0], "bar");
+    // Parameters point into the request rather than being copied
+    EXPECT_EQ(found.route.params[0].data(),
+              getReq.url().encoded_path().data() + 5);
+
+    Request postReq{{boost::beast::http::verb::post, "/foo/bar", 11}, ec};
+    found = router.findRoute(postReq);
+    EXPECT_EQ(found.allowHeader, "GET, POST");
+    ASSERT_NE(found.route.rule, nullptr);
+    EXPECT_EQ(found.route.rule->rule, "/foo/bar");
+    EXPECT_TRUE(found.route.params.empty());
+
+    Request postOtherReq{{boost::beast::http::verb::post, "/foo/baz", 11},
+                         ec};
+    found = router.findRoute(postOtherReq);
+    EXPECT_EQ(found.allowHeader, "GET");
+    EXPECT_EQ(found.route.rule, nullptr);
+}
+
 TEST(Router, OverlapingRoutes)
 {
     // Callback handler that does nothing
@@ -98,6 +141,53 @@ TEST(Router, OverlapingRoutes)
     EXPECT_TRUE(barCalled);
 }
 
+TEST(Router, LongParameters)
+{
+    // Longer than any small string buffer
+    std::string longId(200, 'a');
+    std::string url = "/foo/" + longId + "/bar/" + longId;
+
+    std::string_view viewParam;
+    std::string stringParam;
+    auto viewCallback = [&viewParam](const Request&,
+                                     const std::shared_ptr<bmcweb::AsyncResp>&,
+                                     std::string_view foo, std::string_view) {
+        viewParam = foo;
+    };
+    auto stringCallback =
+        [&stringParam](const Request&,
+                       const std::shared_ptr<bmcweb::AsyncResp>&,
+                       const std::string& foo, const std::string&) {
+        stringParam = foo;
+    };
+
+    Router router;
+    std::error_code ec;
+    router.newRuleTagged<getParameterTag("/foo/<str>/bar/<str>")>(
+        "/foo/<str>/bar/<str>")(viewCallback);
+    router
+        .newRuleTagged<getParameterTag("/foo/<str>/baz/<str>")>(
+            "/foo/<str>/baz/<str>")
+        .methods(boost::beast::http::verb::get)(stringCallback);
+    router.validate();
+
+    auto req = std::make_shared<Request>(
+        Request::Body{boost::beast::http::verb::get, url, 11}, ec);
+    router.handle(req, std::make_shared<bmcweb::AsyncResp>());
+    EXPECT_EQ(viewParam, longId);
+    // Handed over as a view into the url, rather than a copy
+    std::string_view reqUrl = req->url().buffer();
+    EXPECT_GE(viewParam.data(), reqUrl.data());
+    EXPECT_LE(viewParam.data() + viewParam.size(),
+              reqUrl.data() + reqUrl.size());
+
+    url = "/foo/" + longId + "/baz/" + longId;
+    req = std::make_shared<Request>(
+        Request::Body{boost::beast::http::verb::get, url, 11}, ec);
+    router.handle(req, std::make_shared<bmcweb::AsyncResp>());
+    EXPECT_EQ(stringParam, longId);
+}
+
 TEST(Router, 404)
 {
     bool notFoundCalled = false;
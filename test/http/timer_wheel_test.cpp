@@ -0,0 +1,92 @@
+#include "timer_wheel.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <chrono>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace bmcweb
+{
+namespace
+{
+
+TEST(TimerWheel, ArmAndCancel)
+{
+    boost::asio::io_context io;
+    TimerWheel& wheel = TimerWheel::getInstance(io);
+    EXPECT_EQ(&wheel, &TimerWheel::getInstance(io));
+
+    bool fired = false;
+    Deadline shortDeadline;
+    shortDeadline.setCallback([&fired]() { fired = true; });
+    // Long enough to go in the second level of the wheel
+    Deadline longDeadline;
+    longDeadline.setCallback([]() { EXPECT_FALSE(true); });
+
+    shortDeadline.arm(wheel, std::chrono::seconds(100));
+    longDeadline.arm(wheel, std::chrono::seconds(1000));
+    EXPECT_TRUE(shortDeadline.isArmed());
+    EXPECT_EQ(wheel.size(), 2U);
+
+    // Re-arming moves the deadline, rather than adding it again
+    shortDeadline.arm(wheel, std::chrono::seconds(1));
+    EXPECT_EQ(wheel.size(), 2U);
+
+    longDeadline.cancel();
+    EXPECT_FALSE(longDeadline.isArmed());
+    EXPECT_EQ(wheel.size(), 1U);
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    io.run_for(std::chrono::seconds(10));
+    std::chrono::steady_clock::duration elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    // Deadlines fire late rather than early, by at most one tick, and the
+    // wheel stops once nothing is armed, letting run_for return
+    EXPECT_TRUE(fired);
+    EXPECT_FALSE(shortDeadline.isArmed());
+    EXPECT_EQ(wheel.size(), 0U);
+    EXPECT_GE(elapsed, std::chrono::seconds(1));
+    EXPECT_LT(elapsed, std::chrono::seconds(3));
+}
+
+TEST(TimerWheel, CallbackCanRearm)
+{
+    boost::asio::io_context io;
+    TimerWheel& wheel = TimerWheel::getInstance(io);
+
+    int fired = 0;
+    Deadline deadline;
+    deadline.setCallback([&]() {
+        fired++;
+        if (fired < 2)
+        {
+            deadline.arm(wheel, std::chrono::seconds(0));
+        }
+    });
+    deadline.arm(wheel, std::chrono::seconds(0));
+    io.run_for(std::chrono::seconds(10));
+    EXPECT_EQ(fired, 2);
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(TimerWheel, DestroyedDeadlineIsRemoved)
+{
+    boost::asio::io_context io;
+    TimerWheel& wheel = TimerWheel::getInstance(io);
+    {
+        Deadline deadline;
+        deadline.arm(wheel, std::chrono::seconds(5));
+        EXPECT_EQ(wheel.size(), 1U);
+    }
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+} // namespace
+} // namespace bmcweb
@@ -0,0 +1,93 @@
+#include "call_coalescer.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace dbus::utility
+{
+namespace
+{
+
+TEST(CallKey, DiffersByArguments)
+{
+    std::array<std::string_view, 1> chassis{
+        "xyz.openbmc_project.Inventory.Item.Chassis"};
+    std::vector<std::string> board{"xyz.openbmc_project.Inventory.Item.Board"};
+
+    std::string key = callKey("service", "/path", "interface", "GetSubTree",
+                              "/xyz", int32_t{0}, chassis);
+    EXPECT_EQ(key, callKey("service", "/path", "interface", "GetSubTree",
+                           std::string("/xyz"), int32_t{0}, chassis));
+    EXPECT_NE(key, callKey("service", "/path", "interface", "GetSubTree",
+                           "/xyz", int32_t{1}, chassis));
+    EXPECT_NE(key, callKey("service", "/path", "interface", "GetSubTree",
+                           "/xyz", int32_t{0}, board));
+    EXPECT_NE(key, callKey("service", "/path", "interface", "GetSubTreePaths",
+                           "/xyz", int32_t{0}, chassis));
+}
+
+TEST(CallKey, ArgumentsDontRunTogether)
+{
+    EXPECT_NE(callKey("a", "/b", "c", "Get", "de", "f"),
+              callKey("a", "/b", "c", "Get", "d", "ef"));
+    EXPECT_NE(callKey("a", "/b", "c", "Get", std::vector<std::string>{"d"},
+                      std::vector<std::string>{}),
+              callKey("a", "/b", "c", "Get", std::vector<std::string>{},
+                      std::vector<std::string>{"d"}));
+}
+
+using IntCoalescer = CallCoalescer<int>;
+
+TEST(CallCoalescer, OneReplyForAll)
+{
+    IntCoalescer calls;
+    std::vector<int> replies;
+    EXPECT_TRUE(calls.join("a", [&replies](int value) {
+        replies.push_back(value);
+    }));
+    EXPECT_FALSE(calls.join("a", [&replies](int value) {
+        replies.push_back(value + 1);
+    }));
+    EXPECT_TRUE(calls.join("b", [&replies](int value) {
+        replies.push_back(value + 2);
+    }));
+    EXPECT_EQ(calls.size(), 2U);
+    EXPECT_EQ(calls.getJoined(), 1U);
+
+    calls.complete("a", 10);
+    EXPECT_EQ(replies, (std::vector<int>{10, 11}));
+    EXPECT_EQ(calls.size(), 1U);
+
+    calls.complete("b", 20);
+    EXPECT_EQ(replies, (std::vector<int>{10, 11, 22}));
+    EXPECT_EQ(calls.size(), 0U);
+
+    // Nobody is waiting any more
+    calls.complete("a", 30);
+    EXPECT_EQ(replies.size(), 3U);
+}
+
+TEST(CallCoalescer, CallAgainFromCallback)
+{
+    IntCoalescer calls;
+    bool secondCall = false;
+    EXPECT_TRUE(calls.join("a", [&calls, &secondCall](int /*value*/) {
+        secondCall = calls.join("a", [](int /*value*/) {});
+    }));
+    calls.complete("a", 1);
+    // The reply was for a request sent before, so the new one is sent again
+    EXPECT_TRUE(secondCall);
+    EXPECT_EQ(calls.size(), 1U);
+}
+
+} // namespace
+} // namespace dbus::utility
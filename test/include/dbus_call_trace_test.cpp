@@ -0,0 +1,147 @@
+#include "dbus_call_trace.hpp"
+
+#include <boost/system/error_code.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+// IWYU pragma: no_include <boost/system/detail/error_code.hpp>
+
+namespace bmcweb
+{
+namespace
+{
+
+DbusCall makeCall(std::string method, std::chrono::milliseconds latency,
+                  size_t replyBytes)
+{
+    DbusCall call;
+    call.service = "xyz.openbmc_project.Inventory.Manager";
+    call.path = "/xyz/openbmc_project/inventory";
+    call.interface = "org.freedesktop.DBus.Properties";
+    call.method = std::move(method);
+    call.latency = latency;
+    call.replyBytes = replyBytes;
+    return call;
+}
+
+TEST(DbusPayloadSize, SumsValues)
+{
+    EXPECT_EQ(dbusPayloadSize(std::string("abc")), 3U);
+    EXPECT_EQ(dbusPayloadSize(uint32_t{7}), 4U);
+    EXPECT_EQ(dbusPayloadSize(boost::system::error_code()), 0U);
+
+    using Properties =
+        std::vector<std::pair<std::string, std::variant<int64_t, bool>>>;
+    Properties properties{{"Present", true}, {"Count", int64_t{2}}};
+    EXPECT_EQ(dbusPayloadSize(properties), 7U + 1U + 5U + 8U);
+
+    std::vector<std::tuple<std::string, uint16_t>> structs{{"ab", 1}};
+    EXPECT_EQ(dbusPayloadSize(structs), 4U);
+}
+
+TEST(DbusCallTrace, ServerTiming)
+{
+    DbusCallTrace trace("GET /redfish/v1/Chassis");
+    EXPECT_EQ(trace.serverTiming(),
+              R"(dbus;dur=0.000;desc="0 calls, 0 bytes")");
+
+    trace.add(makeCall("GetAll", std::chrono::milliseconds(2), 100));
+    trace.add(makeCall("Get", std::chrono::milliseconds(5), 20));
+    EXPECT_EQ(trace.size(), 2U);
+    EXPECT_EQ(
+        trace.serverTiming(),
+        R"(dbus;dur=7.000;desc="2 calls, 120 bytes", )"
+        R"(dbus-slowest;dur=5.000;desc=")"
+        R"(xyz.openbmc_project.Inventory.Manager )"
+        R"(/xyz/openbmc_project/inventory )"
+        R"(org.freedesktop.DBus.Properties.Get")");
+}
+
+TEST(DbusCallTrace, KeepsTotalsPastMaxCalls)
+{
+    DbusCallTrace trace("GET /redfish/v1");
+    for (size_t i = 0; i <= DbusCallTrace::maxCalls; i++)
+    {
+        trace.add(makeCall("Get", std::chrono::milliseconds(1), 1));
+    }
+    EXPECT_EQ(trace.getCalls().size(), DbusCallTrace::maxCalls);
+    EXPECT_EQ(trace.size(), DbusCallTrace::maxCalls + 1);
+}
+
+TEST(DbusCallTrace, Scope)
+{
+    std::shared_ptr<DbusCallTrace> outer =
+        std::make_shared<DbusCallTrace>("outer");
+    std::shared_ptr<DbusCallTrace> inner =
+        std::make_shared<DbusCallTrace>("inner");
+    EXPECT_EQ(DbusCallTrace::current(), nullptr);
+    {
+        DbusCallTrace::Scope outerScope(outer);
+        {
+            DbusCallTrace::Scope innerScope(inner);
+            EXPECT_EQ(DbusCallTrace::current(), inner);
+        }
+        EXPECT_EQ(DbusCallTrace::current(), outer);
+    }
+    EXPECT_EQ(DbusCallTrace::current(), nullptr);
+}
+
+TEST(DbusCallTrace, TracedHandler)
+{
+    std::shared_ptr<DbusCallTrace> trace =
+        std::make_shared<DbusCallTrace>("GET /redfish/v1/Systems");
+    bool called = false;
+    auto handler = traceDbusCall(
+        [&called, trace](const boost::system::error_code& ec,
+                         const std::vector<std::string>& paths) mutable {
+        called = true;
+        EXPECT_FALSE(ec);
+        EXPECT_EQ(paths.size(), 2U);
+        // Calls made from here belong to the same request
+        EXPECT_EQ(DbusCallTrace::current(), trace);
+    },
+        trace, "xyz.openbmc_project.ObjectMapper",
+        "/xyz/openbmc_project/object_mapper",
+        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths");
+    handler(boost::system::error_code(), std::vector<std::string>{"/a", "/bc"});
+    EXPECT_TRUE(called);
+    EXPECT_EQ(DbusCallTrace::current(), nullptr);
+
+    ASSERT_EQ(trace->getCalls().size(), 1U);
+    const DbusCall& call = trace->getCalls()[0];
+    EXPECT_EQ(call.service, "xyz.openbmc_project.ObjectMapper");
+    EXPECT_EQ(call.method, "GetSubTreePaths");
+    EXPECT_EQ(call.replyBytes, 5U);
+    EXPECT_FALSE(call.failed);
+}
+
+TEST(DbusCallTrace, KeepTrace)
+{
+    std::shared_ptr<DbusCallTrace> trace =
+        std::make_shared<DbusCallTrace>("GET /redfish/v1/Managers");
+    std::shared_ptr<DbusCallTrace> seen;
+    auto later = [&seen]() { seen = DbusCallTrace::current(); };
+    auto kept = [&trace, &later]() {
+        DbusCallTrace::Scope scope(trace);
+        return keepDbusCallTrace(later);
+    }();
+    kept();
+    EXPECT_EQ(seen, trace);
+    EXPECT_EQ(DbusCallTrace::current(), nullptr);
+}
+
+} // namespace
+} // namespace bmcweb
@@ -0,0 +1,68 @@
+#include "admission_control.hpp"
+#include "async_resp.hpp"
+#include "http_request.hpp"
+#include "http_stats_routes.hpp"
+#include "tls_session_resumption.hpp"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/beast/http/status.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <system_error>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow::http_stats_routes
+{
+namespace
+{
+
+TEST(HandleHttpStatsGet, AdmissionCounters)
+{
+    std::error_code ec;
+    crow::Request req("", ec);
+    auto before = std::make_shared<bmcweb::AsyncResp>();
+    handleHttpStatsGet(req, before);
+    EXPECT_EQ(before->res.result(), boost::beast::http::status::ok);
+    size_t connections = before->res.jsonValue["Admission"]["Connections"];
+
+    AdmissionControl::Ticket ticket =
+        AdmissionControl::getInstance().admitConnection(
+            boost::asio::ip::make_address("10.0.0.1"));
+    ASSERT_TRUE(ticket.admitted());
+
+    auto during = std::make_shared<bmcweb::AsyncResp>();
+    handleHttpStatsGet(req, during);
+    const nlohmann::json& admission = during->res.jsonValue["Admission"];
+    EXPECT_EQ(admission["Connections"], connections + 1);
+    EXPECT_EQ(admission["Requests"], 0U);
+    EXPECT_EQ(admission["QueuedConnections"], 0U);
+    EXPECT_EQ(admission["ConnectionsRejected"], 0U);
+    EXPECT_EQ(admission["ConnectionsDropped"], 0U);
+    EXPECT_EQ(admission["RequestsRejected"], 0U);
+}
+
+TEST(HandleHttpStatsGet, HandshakeCounters)
+{
+    ensuressl::HandshakeCounters& handshakes = ensuressl::handshakeCounters();
+    handshakes.full++;
+    handshakes.resumed += 2;
+
+    std::error_code ec;
+    crow::Request req("", ec);
+    auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+    handleHttpStatsGet(req, asyncResp);
+    const nlohmann::json& tls = asyncResp->res.jsonValue["Tls"];
+    EXPECT_EQ(tls["FullHandshakes"], handshakes.full.load());
+    EXPECT_EQ(tls["ResumedHandshakes"], handshakes.resumed.load());
+    EXPECT_EQ(tls["TicketKeyRotations"],
+              ensuressl::SessionTicketKeys::getInstance().getRotations());
+}
+
+} // namespace
+} // namespace crow::http_stats_routes
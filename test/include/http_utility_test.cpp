@@ -1,6 +1,12 @@
 #include "http_utility.hpp"
 
 #include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h> // IWYU pragma: keep
 
@@ -85,5 +91,138 @@ TEST(getPreferredContentType, NegativeTest)
         getPreferredContentType("text/html, application/json", contentType),
         ContentType::NoMatch);
 }
+
+TEST(getPreferredContentType, IgnoresParameters)
+{
+    std::array<ContentType, 2> htmlJson{ContentType::HTML, ContentType::JSON};
+    EXPECT_EQ(getPreferredContentType("application/json;format=compact",
+                                      htmlJson),
+              ContentType::JSON);
+    EXPECT_EQ(getPreferredContentType("application/json ; q=0.9", htmlJson),
+              ContentType::JSON);
+}
+
+TEST(getPreferredEncoding, PositiveTest)
+{
+    EXPECT_EQ(getPreferredEncoding("gzip"), ContentEncoding::Gzip);
+    EXPECT_EQ(getPreferredEncoding("deflate"), ContentEncoding::Deflate);
+    EXPECT_EQ(getPreferredEncoding("deflate, gzip"), ContentEncoding::Gzip);
+    EXPECT_EQ(getPreferredEncoding("br, deflate"), ContentEncoding::Deflate);
+    EXPECT_EQ(getPreferredEncoding("gzip;q=0.5, deflate;q=0.8"),
+              ContentEncoding::Deflate);
+    EXPECT_EQ(getPreferredEncoding("*"), ContentEncoding::Gzip);
+}
+
+TEST(getPreferredEncoding, NegativeTest)
+{
+    EXPECT_EQ(getPreferredEncoding(""), ContentEncoding::Identity);
+    EXPECT_EQ(getPreferredEncoding("identity"), ContentEncoding::Identity);
+    EXPECT_EQ(getPreferredEncoding("br, zstd"), ContentEncoding::Identity);
+    EXPECT_EQ(getPreferredEncoding("gzip;q=0"), ContentEncoding::Identity);
+    EXPECT_EQ(getPreferredEncoding("gzip; q=0.000, deflate;q=0"),
+              ContentEncoding::Identity);
+}
+
+TEST(getEncodingQuality, ListedAndWildcard)
+{
+    EXPECT_EQ(getEncodingQuality("gzip, br", "br"), 1.0);
+    EXPECT_EQ(getEncodingQuality("gzip;q=0.5, br", "gzip"), 0.5);
+    EXPECT_EQ(getEncodingQuality("x-gzip", "gzip"), 1.0);
+    EXPECT_EQ(getEncodingQuality("*;q=0.2, gzip", "br"), 0.2);
+    EXPECT_EQ(getEncodingQuality("*, br;q=0", "br"), 0.0);
+    EXPECT_EQ(getEncodingQuality("gzip", "br"), 0.0);
+    EXPECT_EQ(getEncodingQuality("", "gzip"), 0.0);
+}
+
+TEST(getEncodedEtag, AddsCoding)
+{
+    EXPECT_EQ(getEncodedEtag("\"1234abcd\"", ContentEncoding::Gzip),
+              "\"1234abcd-gzip\"");
+    EXPECT_EQ(getEncodedEtag("\"1234abcd\"", ContentEncoding::Deflate),
+              "\"1234abcd-deflate\"");
+    EXPECT_EQ(getEncodedEtag("\"1234abcd\"", ContentEncoding::Identity),
+              "\"1234abcd\"");
+    EXPECT_EQ(getEncodedEtag("", ContentEncoding::Gzip), "");
+}
+
+TEST(etagMatchesAnyEncoding, Codings)
+{
+    EXPECT_TRUE(etagMatchesAnyEncoding("\"1234abcd\"", "\"1234abcd\""));
+    EXPECT_TRUE(
+        etagMatchesAnyEncoding("\"1234abcd-gzip\"", "\"1234abcd\""));
+    EXPECT_TRUE(
+        etagMatchesAnyEncoding("\"1234abcd-deflate\"", "\"1234abcd\""));
+    EXPECT_FALSE(etagMatchesAnyEncoding("\"1234abcd-br\"", "\"1234abcd\""));
+    EXPECT_FALSE(
+        etagMatchesAnyEncoding("\"5678abcd-gzip\"", "\"1234abcd\""));
+    EXPECT_FALSE(etagMatchesAnyEncoding("W/\"1234abcd\"", "\"1234abcd\""));
+}
+
+TEST(getJsonIndent, Override)
+{
+    EXPECT_EQ(getJsonIndent("application/json;format=compact"), -1);
+    EXPECT_EQ(getJsonIndent("text/html, application/json; format=compact"),
+              -1);
+    EXPECT_EQ(getJsonIndent("*/*;format=pretty"), 2);
+}
+
+TEST(getJsonIndent, Default)
+{
+    EXPECT_EQ(getJsonIndent(""), defaultJsonIndent);
+    EXPECT_EQ(getJsonIndent("application/json"), defaultJsonIndent);
+    EXPECT_EQ(getJsonIndent("text/html;format=compact"), defaultJsonIndent);
+}
+
+void expectRanges(std::string_view header, size_t size,
+                  const std::vector<std::pair<size_t, size_t>>& expected)
+{
+    std::optional<std::vector<ByteRange>> ranges = parseRange(header, size);
+    ASSERT_TRUE(ranges) << header;
+    ASSERT_EQ(ranges->size(), expected.size()) << header;
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ((*ranges)[i].first, expected[i].first) << header;
+        EXPECT_EQ((*ranges)[i].last, expected[i].second) << header;
+    }
+}
+
+TEST(parseRange, Satisfiable)
+{
+    expectRanges("bytes=0-499", 1000, {{0, 499}});
+    expectRanges("bytes=500-", 1000, {{500, 999}});
+    expectRanges("bytes=-200", 1000, {{800, 999}});
+    expectRanges("bytes=-2000", 1000, {{0, 999}});
+    expectRanges("bytes=900-1500", 1000, {{900, 999}});
+    expectRanges("bytes=0-0, -1", 1000, {{0, 0}, {999, 999}});
+    expectRanges("bytes=0-1,,4-5", 10, {{0, 1}, {4, 5}});
+}
+
+TEST(parseRange, Unsatisfiable)
+{
+    expectRanges("bytes=1000-", 1000, {});
+    expectRanges("bytes=-0", 1000, {});
+    expectRanges("bytes=0-", 0, {});
+    // Ranges past the end are dropped, and the rest are still sent
+    expectRanges("bytes=2000-3000, 0-1", 1000, {{0, 1}});
+}
+
+TEST(parseRange, Ignored)
+{
+    EXPECT_FALSE(parseRange("", 1000));
+    EXPECT_FALSE(parseRange("items=0-1", 1000));
+    EXPECT_FALSE(parseRange("bytes=", 1000));
+    EXPECT_FALSE(parseRange("bytes=5-1", 1000));
+    EXPECT_FALSE(parseRange("bytes=a-b", 1000));
+    EXPECT_FALSE(parseRange("bytes=1", 1000));
+    EXPECT_FALSE(parseRange("bytes=+1-2", 1000));
+
+    std::string tooMany = "bytes=0-0";
+    for (size_t i = 0; i < maxByteRanges; i++)
+    {
+        tooMany += ",0-0";
+    }
+    EXPECT_FALSE(parseRange(tooMany, 1000));
+}
+
 } // namespace
 } // namespace http_helpers
@@ -0,0 +1,165 @@
+#include "introspection_cache.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow::openbmc_mapper
+{
+namespace
+{
+
+constexpr const char* introspectXml = R"(
+<!DOCTYPE node PUBLIC "-//freedesktop//DTD D-BUS Object Introspection 1.0//EN"
+"http://www.freedesktop.org/standards/dbus/1.0/introspect.dtd">
+<node>
+  <interface name="xyz.openbmc_project.State.Host">
+    <method name="Transition">
+      <arg name="state" direction="in" type="s"/>
+      <arg direction="out" type="b"/>
+    </method>
+    <method>
+      <arg name="nameless" direction="in" type="s"/>
+    </method>
+    <signal name="Changed">
+      <arg name="state" type="s"/>
+    </signal>
+    <property name="CurrentHostState" type="s" access="read"/>
+    <property type="s" access="read"/>
+  </interface>
+  <interface>
+    <method name="Skipped"/>
+  </interface>
+  <node name="host0"/>
+  <node name="host1"/>
+</node>
+)";
+
+std::shared_ptr<const Introspection> withChildren(
+    std::vector<std::string> children)
+{
+    Introspection introspection;
+    introspection.children = std::move(children);
+    return std::make_shared<const Introspection>(std::move(introspection));
+}
+
+TEST(ParseIntrospection, Members)
+{
+    std::optional<Introspection> parsed = parseIntrospection(introspectXml);
+    ASSERT_TRUE(parsed);
+    EXPECT_EQ(parsed->children, (std::vector<std::string>{"host0", "host1"}));
+    ASSERT_EQ(parsed->interfaces.size(), 1U);
+
+    const IntrospectedInterface* host =
+        parsed->findInterface("xyz.openbmc_project.State.Host");
+    ASSERT_NE(host, nullptr);
+    EXPECT_EQ(parsed->findInterface("xyz.openbmc_project.State.BMC"),
+              nullptr);
+
+    ASSERT_EQ(host->methods.size(), 1U);
+    EXPECT_EQ(host->methods[0].name, "Transition");
+    ASSERT_EQ(host->methods[0].args.size(), 2U);
+    EXPECT_EQ(host->methods[0].args[0].name, "state");
+    EXPECT_EQ(host->methods[0].args[0].direction, "in");
+    EXPECT_EQ(host->methods[0].args[0].type, "s");
+    EXPECT_EQ(host->methods[0].args[1].name, "");
+    EXPECT_EQ(host->methods[0].args[1].direction, "out");
+    EXPECT_EQ(host->methods[0].args[1].type, "b");
+
+    ASSERT_EQ(host->signals.size(), 1U);
+    EXPECT_EQ(host->signals[0].name, "Changed");
+    ASSERT_EQ(host->signals[0].args.size(), 1U);
+    EXPECT_EQ(host->signals[0].args[0].direction, "");
+
+    ASSERT_EQ(host->properties.size(), 1U);
+    EXPECT_EQ(host->properties[0].name, "CurrentHostState");
+    EXPECT_EQ(host->properties[0].type, "s");
+}
+
+TEST(ParseIntrospection, NotIntrospection)
+{
+    EXPECT_EQ(parseIntrospection(""), std::nullopt);
+    EXPECT_EQ(parseIntrospection("<interface name=\"a\"/>"), std::nullopt);
+}
+
+TEST(IntrospectionCache, FindAndInsert)
+{
+    IntrospectionCache cache;
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.Host", "/xyz"), nullptr);
+    std::shared_ptr<const Introspection> introspection =
+        withChildren({"openbmc_project"});
+    cache.insert("xyz.openbmc_project.State.Host", ":1.10", "/xyz",
+                 introspection);
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.Host", "/xyz"),
+              introspection);
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.Host", "/"), nullptr);
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.BMC", "/xyz"), nullptr);
+    EXPECT_EQ(cache.getHits(), 1U);
+    EXPECT_EQ(cache.getMisses(), 3U);
+
+    // Answered by a new owner
+    cache.insert("xyz.openbmc_project.State.Host", ":1.11", "/", introspection);
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.Host", "/xyz"), nullptr);
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST(IntrospectionCache, InterfacesChanged)
+{
+    IntrospectionCache cache;
+    for (const char* path :
+         {"/", "/xyz", "/xyz/openbmc_project", "/xyz/openbmc_project/state",
+          "/xyz/openbmc_project/state/host0", "/xyz/openbmc_project/network"})
+    {
+        cache.insert("xyz.openbmc_project.State.Host", ":1.10", path,
+                     withChildren({}));
+    }
+    cache.insert("xyz.openbmc_project.Network", ":1.20", "/xyz",
+                 withChildren({}));
+
+    // From someone else
+    cache.onInterfacesChanged(":1.30", "/xyz/openbmc_project/state/host0");
+    EXPECT_EQ(cache.size(), 7U);
+
+    // The object and everything above it have changed, but nothing beside
+    // or under it has
+    cache.onInterfacesChanged(":1.10", "/xyz/openbmc_project/state");
+    EXPECT_EQ(cache.size(), 3U);
+    EXPECT_NE(cache.find("xyz.openbmc_project.State.Host",
+                         "/xyz/openbmc_project/state/host0"),
+              nullptr);
+    EXPECT_NE(cache.find("xyz.openbmc_project.State.Host",
+                         "/xyz/openbmc_project/network"),
+              nullptr);
+    EXPECT_NE(cache.find("xyz.openbmc_project.Network", "/xyz"), nullptr);
+}
+
+TEST(IntrospectionCache, NameOwnerChanged)
+{
+    IntrospectionCache cache;
+    cache.insert("xyz.openbmc_project.State.Host", ":1.10", "/",
+                 withChildren({}));
+    cache.insert(":1.10", ":1.10", "/", withChildren({}));
+    cache.insert("xyz.openbmc_project.Network", ":1.20", "/",
+                 withChildren({}));
+
+    cache.onNameOwnerChanged("xyz.openbmc_project.State.Host", "");
+    EXPECT_EQ(cache.find("xyz.openbmc_project.State.Host", "/"), nullptr);
+    EXPECT_EQ(cache.size(), 2U);
+
+    // The connection went away, along with every name it had
+    cache.insert("xyz.openbmc_project.State.Host", ":1.10", "/",
+                 withChildren({}));
+    cache.onNameOwnerChanged(":1.10", ":1.10");
+    EXPECT_EQ(cache.size(), 1U);
+    EXPECT_NE(cache.find("xyz.openbmc_project.Network", "/"), nullptr);
+}
+
+} // namespace
+} // namespace crow::openbmc_mapper
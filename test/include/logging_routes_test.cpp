@@ -0,0 +1,111 @@
+#include "async_resp.hpp"
+#include "bmcweb_config.h"
+#include "http_request.hpp"
+#include "http_response.hpp"
+#include "logging.hpp"
+#include "logging_routes.hpp"
+
+#include <boost/beast/http/status.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow::logging_routes
+{
+namespace
+{
+
+TEST(GetLogCategoryFromPath, MatchesFiles)
+{
+    EXPECT_EQ(getLogCategoryFromPath("../http/http_connection.hpp"),
+              LogCategory::Http);
+    EXPECT_EQ(getLogCategoryFromPath("../http/routing.hpp"),
+              LogCategory::Routing);
+    EXPECT_EQ(getLogCategoryFromPath("../http/routing/baserule.hpp"),
+              LogCategory::Routing);
+    EXPECT_EQ(getLogCategoryFromPath("../include/dbus_utility.hpp"),
+              LogCategory::Dbus);
+    EXPECT_EQ(getLogCategoryFromPath(
+                  "../redfish-core/include/event_service_manager.hpp"),
+              LogCategory::EventService);
+    EXPECT_EQ(getLogCategoryFromPath(
+                  "../redfish-core/include/redfish_aggregator.hpp"),
+              LogCategory::Aggregation);
+    EXPECT_EQ(getLogCategoryFromPath("../redfish-core/lib/sensors.hpp"),
+              LogCategory::Sensors);
+    EXPECT_EQ(getLogCategoryFromPath("../redfish-core/lib/thermal.hpp"),
+              LogCategory::Sensors);
+    EXPECT_EQ(getLogCategoryFromPath("../redfish-core/lib/systems.hpp"),
+              LogCategory::Redfish);
+    EXPECT_EQ(getLogCategoryFromPath("../redfish-core/include/query.hpp"),
+              LogCategory::Redfish);
+    EXPECT_EQ(getLogCategoryFromPath("../include/login_routes.hpp"),
+              LogCategory::Other);
+}
+
+TEST(LogCategoryMacro, OverridesFileCategory)
+{
+    if constexpr (BMCWEB_ASYNC_LOGGING ||
+                  bmcwebMaxLoggingLevel < LogLevel::Error)
+    {
+        GTEST_SKIP() << "Log lines aren't written to stdout as they're logged";
+    }
+    RuntimeLogLevels& levels = RuntimeLogLevels::getInstance();
+    levels.set(LogLevel::Disabled);
+    levels.set(LogCategory::Dbus, LogLevel::Error);
+
+    testing::internal::CaptureStdout();
+    // This file is in the other category
+    BMCWEB_LOG_ERROR("Not logged");
+    BMCWEB_LOG_ERROR_CAT(Dbus, "DBUS response error");
+    std::string out = testing::internal::GetCapturedStdout();
+    levels.set(bmcwebCurrentLoggingLevel);
+
+    EXPECT_EQ(out.find("Not logged"), std::string::npos);
+    EXPECT_NE(out.find("DBUS response error"), std::string::npos);
+}
+
+// The BMCWEB_LOG_* macros pass the category as a template argument
+static_assert(getLogCategoryFromPath("../http/routing.hpp") ==
+              LogCategory::Routing);
+
+TEST(HandleLoggingPatch, SetsCategoryLevels)
+{
+    RuntimeLogLevels& levels = RuntimeLogLevels::getInstance();
+    std::error_code ec;
+    crow::Request req(
+        R"({"Level": "CRITICAL", "Categories": {"dbus": "ERROR"}})", ec);
+    auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+    handleLoggingPatch(req, asyncResp);
+
+    EXPECT_EQ(asyncResp->res.result(), boost::beast::http::status::ok);
+    EXPECT_EQ(levels.get(LogCategory::Http), LogLevel::Critical);
+    EXPECT_EQ(levels.get(LogCategory::Dbus), LogLevel::Error);
+    EXPECT_EQ(levels.getMax(), LogLevel::Error);
+    EXPECT_FALSE(levels.isUniform());
+    EXPECT_EQ(asyncResp->res.jsonValue["Categories"]["dbus"], "ERROR");
+    EXPECT_EQ(asyncResp->res.jsonValue["Categories"]["sensors"], "CRITICAL");
+
+    // Nothing changes if any of it is wrong
+    auto badResp = std::make_shared<bmcweb::AsyncResp>();
+    crow::Request badReq(
+        R"({"Level": "DEBUG", "Categories": {"nope": "DEBUG"}})", ec);
+    handleLoggingPatch(badReq, badResp);
+    EXPECT_EQ(badResp->res.result(), boost::beast::http::status::bad_request);
+    EXPECT_EQ(levels.get(LogCategory::Http), LogLevel::Critical);
+
+    levels.set(bmcwebCurrentLoggingLevel);
+    EXPECT_TRUE(levels.isUniform());
+    EXPECT_EQ(levels.getMax(), bmcwebCurrentLoggingLevel);
+}
+
+} // namespace
+} // namespace crow::logging_routes
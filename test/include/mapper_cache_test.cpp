@@ -0,0 +1,263 @@
+#include "mapper_cache.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace dbus::utility
+{
+namespace
+{
+
+using Paths = std::vector<std::string>;
+using ServiceMap =
+    std::vector<std::pair<std::string, std::vector<std::string>>>;
+using SubTree = std::vector<std::pair<std::string, ServiceMap>>;
+
+MapperQuery subTreeQuery(std::string path, int32_t depth,
+                         std::vector<std::string> interfaces)
+{
+    MapperQuery query;
+    query.method = "GetSubTree";
+    query.path = std::move(path);
+    query.depth = depth;
+    query.interfaces = std::move(interfaces);
+    return query;
+}
+
+SubTree chassisTree()
+{
+    return {{"/xyz/openbmc_project/inventory/system/chassis",
+             {{"xyz.openbmc_project.Inventory.Manager",
+               {"xyz.openbmc_project.Inventory.Item.Chassis"}}}}};
+}
+
+// Caches start with the last change at the epoch of steady_clock, so
+// inserting into a new one isn't held back by the settle time
+class MapperCacheTest : public testing::Test
+{
+  protected:
+    MapperCacheTest()
+    {
+        cache.setEnabled(true);
+    }
+
+    void insert(const MapperQuery& query, const SubTree& response)
+    {
+        cache.insert(query, cache.getGeneration(), response);
+    }
+
+    MapperCache cache;
+    MapperQuery chassis = subTreeQuery(
+        "/xyz/openbmc_project/inventory", 0,
+        {"xyz.openbmc_project.Inventory.Item.Chassis"});
+};
+
+TEST_F(MapperCacheTest, HitsAndMisses)
+{
+    EXPECT_EQ(cache.find<SubTree>(chassis), nullptr);
+    insert(chassis, chassisTree());
+    std::shared_ptr<const SubTree> found = cache.find<SubTree>(chassis);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, chassisTree());
+    EXPECT_EQ(cache.size(), 1U);
+    EXPECT_EQ(cache.getHits(), 1U);
+    EXPECT_EQ(cache.getMisses(), 1U);
+
+    // Any difference in the arguments is a different query
+    MapperQuery other = chassis;
+    other.depth = 1;
+    EXPECT_EQ(cache.find<SubTree>(other), nullptr);
+    other = chassis;
+    other.method = "GetSubTreePaths";
+    EXPECT_EQ(cache.find<Paths>(other), nullptr);
+}
+
+TEST_F(MapperCacheTest, InterfacesChangedInScope)
+{
+    insert(chassis, chassisTree());
+    std::vector<std::string> board = {
+        "xyz.openbmc_project.Inventory.Item.Board"};
+    std::vector<std::string> chassisInterface = {
+        "xyz.openbmc_project.Inventory.Item.Chassis"};
+
+    // Outside of the subtree
+    cache.onInterfacesChanged("/xyz/openbmc_project/sensors/temp",
+                              chassisInterface);
+    // Not an interface the query asks for
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system/board",
+                              board);
+    // Shares a prefix, but isn't under the path
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory2/chassis",
+                              chassisInterface);
+    EXPECT_EQ(cache.size(), 1U);
+
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/chassis2",
+                              chassisInterface);
+    EXPECT_EQ(cache.size(), 0U);
+    EXPECT_EQ(cache.getInvalidations(), 1U);
+}
+
+TEST_F(MapperCacheTest, InterfacesChangedOnListedObject)
+{
+    insert(chassis, chassisTree());
+    // Anything on an object in the reply drops it, even interfaces the query
+    // didn't ask for
+    std::vector<std::string> board = {
+        "xyz.openbmc_project.Inventory.Item.Board"};
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system/chassis",
+                              board);
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, GetObject)
+{
+    MapperQuery object;
+    object.method = "GetObject";
+    object.path = "/xyz/openbmc_project/inventory/system/chassis";
+    object.interfaces = {"xyz.openbmc_project.Inventory.Item.Chassis"};
+    cache.insert(object, cache.getGeneration(), chassisTree()[0].second);
+
+    std::vector<std::string> board = {
+        "xyz.openbmc_project.Inventory.Item.Board"};
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system/board",
+                              board);
+    EXPECT_EQ(cache.size(), 1U);
+
+    // The reply lists every interface on the object, so even ones the query
+    // didn't ask for change it
+    cache.onInterfacesChanged(object.path, board);
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, InterfacesUnknown)
+{
+    insert(chassis, chassisTree());
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system/board",
+                              {});
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, Depth)
+{
+    MapperQuery shallow = subTreeQuery("/xyz/openbmc_project/inventory", 1,
+                                       {});
+    insert(shallow, {});
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system/chassis",
+                              {});
+    EXPECT_EQ(cache.size(), 1U);
+    cache.onInterfacesChanged("/xyz/openbmc_project/inventory/system", {});
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, ServiceOwnerChanged)
+{
+    insert(chassis, chassisTree());
+
+    MapperQuery paths = chassis;
+    paths.method = "GetSubTreePaths";
+    cache.insert(paths, cache.getGeneration(),
+                 Paths{"/xyz/openbmc_project/inventory/system/chassis"});
+    EXPECT_EQ(cache.size(), 2U);
+
+    // Paths can't say which service they came from, so they always go
+    cache.onServiceOwnerChanged("xyz.openbmc_project.ObjectMapper", false);
+    EXPECT_EQ(cache.size(), 1U);
+    cache.onServiceOwnerChanged("xyz.openbmc_project.Inventory.Manager",
+                                false);
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, ServiceAppeared)
+{
+    insert(chassis, chassisTree());
+    cache.onServiceOwnerChanged("xyz.openbmc_project.FruDevice", true);
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, Associations)
+{
+    MapperQuery associated = chassis;
+    associated.method = "GetAssociatedSubTree";
+    associated.associatedPath =
+        "/xyz/openbmc_project/inventory/system/chassis/containing";
+    insert(associated, {});
+    insert(chassis, chassisTree());
+
+    cache.onAssociationChanged();
+    EXPECT_EQ(cache.size(), 1U);
+    EXPECT_NE(cache.find<SubTree>(chassis), nullptr);
+}
+
+TEST_F(MapperCacheTest, RacedSignal)
+{
+    uint64_t generation = cache.getGeneration();
+    cache.onInterfacesChanged("/xyz/openbmc_project/sensors/temp", {});
+    cache.insert(chassis, generation, chassisTree());
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(MapperCacheTest, SettleTime)
+{
+    cache.onInterfacesChanged("/xyz/openbmc_project/sensors/temp", {});
+    insert(chassis, chassisTree());
+    EXPECT_EQ(cache.size(), 0U);
+
+    std::this_thread::sleep_for(MapperCache::settleTime);
+    insert(chassis, chassisTree());
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(MapperCacheTest, MaxBytes)
+{
+    // Half of the bound, give or take the path and the mentions
+    SubTree big = chassisTree();
+    big[0].second[0].second.emplace_back(MapperCache::maxBytes / 2, 'x');
+    insert(chassis, big);
+    EXPECT_EQ(cache.size(), 1U);
+    EXPECT_GT(cache.sizeBytes(), MapperCache::maxBytes / 2);
+
+    // Doesn't fit alongside the first
+    MapperQuery other = chassis;
+    other.depth = 1;
+    insert(other, big);
+    EXPECT_EQ(cache.size(), 1U);
+
+    // Replacing an entry doesn't count it twice
+    insert(chassis, big);
+    EXPECT_EQ(cache.size(), 1U);
+    EXPECT_NE(cache.find<SubTree>(chassis), nullptr);
+
+    // Nor does a reply bigger than the bound by itself
+    cache.clear();
+    EXPECT_EQ(cache.sizeBytes(), 0U);
+    big[0].second[0].second.emplace_back(MapperCache::maxBytes, 'x');
+    std::this_thread::sleep_for(MapperCache::settleTime);
+    insert(chassis, big);
+    EXPECT_EQ(cache.size(), 0U);
+
+    insert(chassis, chassisTree());
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(MapperCacheTest, Disable)
+{
+    insert(chassis, chassisTree());
+    cache.setEnabled(false);
+    EXPECT_EQ(cache.size(), 0U);
+    insert(chassis, chassisTree());
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+} // namespace
+} // namespace dbus::utility
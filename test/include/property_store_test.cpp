@@ -0,0 +1,175 @@
+#include "dbus_utility.hpp"
+#include "property_store.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace dbus::utility
+{
+namespace
+{
+
+constexpr const char* inventory = "xyz.openbmc_project.Inventory.Manager";
+constexpr const char* network = "xyz.openbmc_project.Network";
+constexpr const char* asset = "xyz.openbmc_project.Inventory.Decorator.Asset";
+constexpr const char* chassisPath =
+    "/xyz/openbmc_project/inventory/system/chassis";
+
+DBusPropertiesMap assetProperties(const std::string& serial)
+{
+    return {{"Manufacturer", std::string("OpenBMC")},
+            {"SerialNumber", serial}};
+}
+
+ManagedObjectType networkObjects()
+{
+    sdbusplus::message::object_path eth0("/xyz/openbmc_project/network/eth0");
+    return {{eth0,
+             {{"xyz.openbmc_project.Network.EthernetInterface",
+               {{"LinkUp", true}}}}}};
+}
+
+TEST(PropertyStore, IsStored)
+{
+    EXPECT_TRUE(PropertyStore::isStored(inventory, asset));
+    EXPECT_TRUE(PropertyStore::isStored(network, "anything"));
+    EXPECT_FALSE(PropertyStore::isStored(network, ""));
+    EXPECT_FALSE(PropertyStore::isStored(
+        "xyz.openbmc_project.Hwmon", "xyz.openbmc_project.Sensor.Value"));
+}
+
+TEST(PropertyStore, FindProperties)
+{
+    PropertyStore store;
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              std::nullopt);
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              assetProperties("1234"));
+    EXPECT_EQ(store.findProperties(network, chassisPath, asset), std::nullopt);
+    EXPECT_EQ(store.getHits(), 1U);
+    EXPECT_EQ(store.getMisses(), 2U);
+}
+
+TEST(PropertyStore, PropertiesChanged)
+{
+    PropertyStore store;
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+
+    // From someone else
+    store.onPropertiesChanged(":1.11", chassisPath, asset,
+                              {{"SerialNumber", std::string("5678")}}, {});
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              assetProperties("1234"));
+
+    store.onPropertiesChanged(":1.10", chassisPath, asset,
+                              {{"SerialNumber", std::string("5678")}}, {});
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              assetProperties("5678"));
+
+    std::vector<std::string> invalidated{"SerialNumber"};
+    store.onPropertiesChanged(":1.10", chassisPath, asset, {}, invalidated);
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              std::nullopt);
+}
+
+TEST(PropertyStore, InterfacesRemoved)
+{
+    PropertyStore store;
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+    std::vector<std::string> removed{asset};
+    store.onInterfacesRemoved(":1.10", chassisPath, removed);
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              std::nullopt);
+    EXPECT_EQ(store.size(), 0U);
+}
+
+TEST(PropertyStore, NameOwnerChanged)
+{
+    PropertyStore store;
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+    store.onNameOwnerChanged(inventory, ":1.10");
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              std::nullopt);
+
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+    store.onNameOwnerChanged(":1.10", ":1.10");
+    EXPECT_EQ(store.size(), 0U);
+
+    // Answered by a new owner
+    store.insertProperties(inventory, ":1.10", chassisPath, asset,
+                           assetProperties("1234"));
+    store.insertProperties(inventory, ":1.12", "/xyz/openbmc_project/other",
+                           asset, assetProperties("1234"));
+    EXPECT_EQ(store.findProperties(inventory, chassisPath, asset),
+              std::nullopt);
+}
+
+TEST(PropertyStore, ManagedObjects)
+{
+    PropertyStore store;
+    store.insertManagedObjects(network, ":1.20", "/xyz/openbmc_project/network",
+                               networkObjects());
+    EXPECT_EQ(store.findManagedObjects(network, "/xyz/openbmc_project/network"),
+              networkObjects());
+    EXPECT_EQ(store.findManagedObjects(network, "/"), std::nullopt);
+
+    // Anything on the objects in the reply can be read on its own
+    EXPECT_EQ(store.findProperties(
+                  network, "/xyz/openbmc_project/network/eth0",
+                  "xyz.openbmc_project.Network.EthernetInterface"),
+              DBusPropertiesMap({{"LinkUp", true}}));
+}
+
+TEST(PropertyStore, ManagedObjectsAddedAndRemoved)
+{
+    PropertyStore store;
+    store.insertManagedObjects(network, ":1.20", "/xyz/openbmc_project/network",
+                               networkObjects());
+
+    ManagedObjectType expected = networkObjects();
+    DBusInterfacesMap added{
+        {"xyz.openbmc_project.Network.IP", {{"Address", std::string("::1")}}}};
+    expected.emplace_back(
+        sdbusplus::message::object_path(
+            "/xyz/openbmc_project/network/eth0/ipv6/1"),
+        added);
+    store.onInterfacesAdded(":1.20", "/xyz/openbmc_project/network/eth0/ipv6/1",
+                            added);
+    EXPECT_EQ(store.findManagedObjects(network, "/xyz/openbmc_project/network"),
+              expected);
+
+    std::vector<std::string> removed{"xyz.openbmc_project.Network.IP"};
+    store.onInterfacesRemoved(
+        ":1.20", "/xyz/openbmc_project/network/eth0/ipv6/1", removed);
+    EXPECT_EQ(store.findManagedObjects(network, "/xyz/openbmc_project/network"),
+              networkObjects());
+}
+
+TEST(PropertyStore, ManagedObjectsUnknownInterface)
+{
+    PropertyStore store;
+    store.insertManagedObjects(network, ":1.20", "/xyz/openbmc_project/network",
+                               networkObjects());
+    store.onPropertiesChanged(":1.20", "/xyz/openbmc_project/network/eth0",
+                              "xyz.openbmc_project.Network.VLAN",
+                              {{"Id", uint32_t{2}}}, {});
+    EXPECT_EQ(store.findManagedObjects(network, "/xyz/openbmc_project/network"),
+              std::nullopt);
+}
+
+} // namespace
+} // namespace dbus::utility
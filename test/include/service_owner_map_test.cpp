@@ -0,0 +1,111 @@
+#include "service_owner_map.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace dbus::utility
+{
+namespace
+{
+
+using Paths = std::vector<std::string>;
+
+TEST(ServiceOwnerMap, ForOwner)
+{
+    size_t dropped = 0;
+    ServiceOwnerMap<Paths> services(
+        [&dropped](const Paths& paths) { dropped += paths.size(); });
+    EXPECT_EQ(services.find("xyz.openbmc_project.State.Host"), nullptr);
+
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10")
+        .emplace_back("/xyz");
+    Paths* paths = services.find("xyz.openbmc_project.State.Host");
+    ASSERT_NE(paths, nullptr);
+    EXPECT_EQ(*paths, Paths{"/xyz"});
+
+    // Same owner, same entry
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10")
+        .emplace_back("/");
+    EXPECT_EQ(paths->size(), 2U);
+    EXPECT_EQ(dropped, 0U);
+
+    // Answered by someone else
+    EXPECT_TRUE(
+        services.forOwner("xyz.openbmc_project.State.Host", ":1.11").empty());
+    EXPECT_EQ(dropped, 2U);
+}
+
+TEST(ServiceOwnerMap, ForEachOwnedBy)
+{
+    ServiceOwnerMap<Paths> services;
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10");
+    services.forOwner(":1.10", ":1.10");
+    services.forOwner("xyz.openbmc_project.Network", ":1.20");
+
+    std::vector<std::string> names;
+    services.forEachOwnedBy(":1.10", [&names](std::string_view name, Paths&) {
+        names.emplace_back(name);
+    });
+    EXPECT_EQ(names, (std::vector<std::string>{
+                         ":1.10", "xyz.openbmc_project.State.Host"}));
+}
+
+TEST(ServiceOwnerMap, NameOwnerChanged)
+{
+    size_t dropped = 0;
+    ServiceOwnerMap<Paths> services(
+        [&dropped](const Paths& paths) { dropped += paths.size(); });
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10")
+        .emplace_back("/");
+    services.forOwner(":1.10", ":1.10").emplace_back("/");
+    services.forOwner("xyz.openbmc_project.Network", ":1.20")
+        .emplace_back("/");
+
+    services.onNameOwnerChanged("xyz.openbmc_project.State.Host", "");
+    EXPECT_EQ(services.find("xyz.openbmc_project.State.Host"), nullptr);
+    EXPECT_NE(services.find(":1.10"), nullptr);
+    EXPECT_EQ(dropped, 1U);
+
+    // The connection went away, along with every name it had
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10")
+        .emplace_back("/");
+    services.onNameOwnerChanged(":1.10", ":1.10");
+    EXPECT_EQ(services.find("xyz.openbmc_project.State.Host"), nullptr);
+    EXPECT_EQ(services.find(":1.10"), nullptr);
+    EXPECT_NE(services.find("xyz.openbmc_project.Network"), nullptr);
+    EXPECT_EQ(dropped, 3U);
+}
+
+TEST(ServiceOwnerMap, Prune)
+{
+    ServiceOwnerMap<Paths> services;
+    EXPECT_TRUE(services.pruneDue());
+    services.forOwner("xyz.openbmc_project.State.Host", ":1.10")
+        .emplace_back("/");
+    services.forOwner("xyz.openbmc_project.Network", ":1.20");
+
+    // Drops the entries that are left empty
+    services.prune([](const Paths& paths) { return paths.empty(); });
+    EXPECT_FALSE(services.pruneDue());
+    EXPECT_NE(services.find("xyz.openbmc_project.State.Host"), nullptr);
+    EXPECT_EQ(services.find("xyz.openbmc_project.Network"), nullptr);
+}
+
+TEST(ServiceOwnerMap, IsFresh)
+{
+    using Clock = ServiceOwnerMap<Paths>::Clock;
+    EXPECT_TRUE(ServiceOwnerMap<Paths>::isFresh(Clock::now()));
+    EXPECT_FALSE(ServiceOwnerMap<Paths>::isFresh(
+        Clock::now() - ServiceOwnerMap<Paths>::maxAge));
+}
+
+} // namespace
+} // namespace dbus::utility
@@ -0,0 +1,125 @@
+#include "file_test_utilities.hpp"
+#include "http_request.hpp"
+#include "http_response.hpp"
+#include "static_asset_cache.hpp"
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace crow::webassets
+{
+namespace
+{
+
+TEST(StaticAssetCache, SelectEncoding)
+{
+    StaticAsset asset;
+    asset.variants[static_cast<size_t>(AssetEncoding::Identity)].emplace();
+    asset.variants[static_cast<size_t>(AssetEncoding::Gzip)].emplace();
+    EXPECT_EQ(selectEncoding(asset, ""), AssetEncoding::Identity);
+    EXPECT_EQ(selectEncoding(asset, "gzip, deflate, br"), AssetEncoding::Gzip);
+    EXPECT_EQ(selectEncoding(asset, "gzip;q=0"), AssetEncoding::Identity);
+    EXPECT_EQ(selectEncoding(asset, "*"), AssetEncoding::Gzip);
+
+    asset.variants[static_cast<size_t>(AssetEncoding::Brotli)].emplace();
+    EXPECT_EQ(selectEncoding(asset, "gzip, deflate, br"),
+              AssetEncoding::Brotli);
+    EXPECT_EQ(selectEncoding(asset, "gzip, br;q=0.5"), AssetEncoding::Gzip);
+
+    // Assets that are only installed compressed are sent compressed anyway
+    asset.variants[static_cast<size_t>(AssetEncoding::Identity)].reset();
+    asset.variants[static_cast<size_t>(AssetEncoding::Brotli)].reset();
+    EXPECT_EQ(selectEncoding(asset, ""), AssetEncoding::Gzip);
+}
+
+TEST(StaticAssetCache, EtagMatches)
+{
+    EXPECT_TRUE(etagMatches("\"abc\"", "\"abc\""));
+    EXPECT_TRUE(etagMatches("\"xyz\", W/\"abc\"", "\"abc\""));
+    EXPECT_TRUE(etagMatches("*", "\"abc\""));
+    EXPECT_FALSE(etagMatches("", "\"abc\""));
+    EXPECT_FALSE(etagMatches("\"abcd\"", "\"abc\""));
+}
+
+TEST(StaticAssetCache, LoadsWithinBudget)
+{
+    TemporaryFileHandle identity("some javascript, uncompressed");
+    TemporaryFileHandle gzip("compressed");
+
+    StaticAssetCache cache(20);
+    StaticAsset* asset = cache.addFile("/app.js", identity.stringPath,
+                                       AssetEncoding::Identity);
+    ASSERT_NE(asset, nullptr);
+    asset->hash = "0123abcd";
+    EXPECT_EQ(cache.addFile("/app.js", gzip.stringPath, AssetEncoding::Gzip),
+              asset);
+    EXPECT_EQ(cache.addFile("/app.js", gzip.stringPath, AssetEncoding::Gzip),
+              nullptr);
+    cache.load();
+
+    // Only the smaller, compressed copy fits
+    EXPECT_EQ(cache.getCachedFiles(), 1U);
+    EXPECT_EQ(cache.getCachedBytes(), 10U);
+    const std::optional<AssetVariant>& cached =
+        asset->variant(AssetEncoding::Gzip);
+    ASSERT_TRUE(cached);
+    ASSERT_NE(cached->data, nullptr);
+    EXPECT_EQ(*cached->data, "compressed");
+    EXPECT_EQ(cached->etag, "\"0123abcd-gzip\"");
+
+    const std::optional<AssetVariant>& uncached =
+        asset->variant(AssetEncoding::Identity);
+    ASSERT_TRUE(uncached);
+    EXPECT_EQ(uncached->data, nullptr);
+    EXPECT_EQ(uncached->size, 29U);
+    EXPECT_EQ(uncached->etag, "\"0123abcd\"");
+}
+
+TEST(StaticAssetCache, HandleRequest)
+{
+    TemporaryFileHandle identity("some javascript, uncompressed");
+    TemporaryFileHandle gzip("compressed");
+
+    StaticAssetCache cache(1024);
+    StaticAsset* asset = cache.addFile("/app.js", identity.stringPath,
+                                       AssetEncoding::Identity);
+    ASSERT_NE(asset, nullptr);
+    asset->contentType = "application/javascript;charset=UTF-8";
+    cache.addFile("/app.js", gzip.stringPath, AssetEncoding::Gzip);
+    cache.load();
+
+    std::error_code ec;
+    Request req({boost::beast::http::verb::get, "/app.js", 11}, ec);
+    req.addHeader(boost::beast::http::field::accept_encoding, "gzip");
+    Response res;
+    handleAssetRequest(*asset, req, res);
+    EXPECT_EQ(res.result(), boost::beast::http::status::ok);
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::content_encoding),
+              "gzip");
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::vary),
+              "Accept-Encoding");
+    EXPECT_EQ(res.getHeaderValue(boost::beast::http::field::content_type),
+              "application/javascript;charset=UTF-8");
+    EXPECT_EQ(res.size(), 10U);
+    std::string etag(res.getHeaderValue(boost::beast::http::field::etag));
+    EXPECT_FALSE(etag.empty());
+
+    req.addHeader(boost::beast::http::field::if_none_match, etag);
+    Response notModified;
+    handleAssetRequest(*asset, req, notModified);
+    EXPECT_EQ(notModified.result(), boost::beast::http::status::not_modified);
+}
+
+} // namespace
+} // namespace crow::webassets
@@ -0,0 +1,157 @@
+#include "ssl_key_handler.hpp"
+#include "tls_session_resumption.hpp"
+
+extern "C"
+{
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+}
+
+#include <boost/asio/ssl/context.hpp>
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <span>
+#include <string>
+
+#include <gtest/gtest.h> // IWYU pragma: keep
+
+// IWYU pragma: no_include <gtest/gtest-message.h>
+// IWYU pragma: no_include <gtest/gtest-test-part.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace ensuressl
+{
+namespace
+{
+
+using std::chrono::seconds;
+
+TEST(SessionTicketKeys, RotatesAndRenews)
+{
+    SessionTicketKeys keys(seconds(100));
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    std::optional<SessionTicketKeys::Key> first = keys.currentKey(start);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(keys.getRotations(), 1U);
+    std::optional<SessionTicketKeys::Key> same =
+        keys.currentKey(start + seconds(99));
+    ASSERT_TRUE(same);
+    EXPECT_EQ(same->name, first->name);
+
+    bool renew = true;
+    std::span<const unsigned char, 16> firstName(first->name);
+    ASSERT_TRUE(keys.findKey(firstName, start + seconds(50), renew));
+    EXPECT_FALSE(renew);
+
+    // Past the rotation period a new key is made, and tickets from the old
+    // one are still accepted, but replaced
+    std::optional<SessionTicketKeys::Key> second =
+        keys.currentKey(start + seconds(100));
+    ASSERT_TRUE(second);
+    EXPECT_NE(second->name, first->name);
+    EXPECT_EQ(keys.getRotations(), 2U);
+    ASSERT_TRUE(keys.findKey(firstName, start + seconds(150), renew));
+    EXPECT_TRUE(renew);
+
+    // Two periods on, the first key is no longer accepted
+    EXPECT_FALSE(keys.findKey(firstName, start + seconds(200), renew));
+
+    std::array<unsigned char, 16> unknown{};
+    EXPECT_FALSE(keys.findKey(unknown, start, renew));
+}
+
+// Runs a handshake between a client and a server over a memory BIO pair.
+// Returns the server side SSL, or nullptr if the handshake failed.
+SSL* handshake(SSL_CTX* serverCtx, SSL_CTX* clientCtx, SSL_SESSION* session,
+               SSL_SESSION** newSession)
+{
+    SSL* server = SSL_new(serverCtx);
+    SSL* client = SSL_new(clientCtx);
+    BIO* serverBio = nullptr;
+    BIO* clientBio = nullptr;
+    BIO_new_bio_pair(&serverBio, 0, &clientBio, 0);
+    SSL_set_bio(server, serverBio, serverBio);
+    SSL_set_bio(client, clientBio, clientBio);
+    SSL_set_accept_state(server);
+    SSL_set_connect_state(client);
+    if (session != nullptr)
+    {
+        SSL_set_session(client, session);
+    }
+
+    bool serverDone = false;
+    bool clientDone = false;
+    for (int round = 0; round < 10 && !(serverDone && clientDone); round++)
+    {
+        clientDone = clientDone || SSL_do_handshake(client) == 1;
+        serverDone = serverDone || SSL_do_handshake(server) == 1;
+    }
+    if (serverDone && clientDone)
+    {
+        // Lets the client read the tickets that TLS 1.3 sends after the
+        // handshake
+        std::array<char, 1> buf{};
+        SSL_read(client, buf.data(), static_cast<int>(buf.size()));
+        *newSession = SSL_get1_session(client);
+        // Sessions are only kept for resumption after a clean shutdown
+        SSL_shutdown(client);
+    }
+    SSL_free(client);
+    if (!serverDone || !clientDone)
+    {
+        SSL_free(server);
+        return nullptr;
+    }
+    return server;
+}
+
+TEST(TlsSessionResumption, ClientResumes)
+{
+    boost::asio::ssl::context serverCtx(boost::asio::ssl::context::tls_server);
+    ASSERT_TRUE(
+        getSslContext(serverCtx, generateSslCertificate("TestCommonName")));
+    setupSessionResumption(serverCtx.native_handle());
+
+    SSL_CTX* clientCtx = SSL_CTX_new(TLS_client_method());
+    ASSERT_NE(clientCtx, nullptr);
+    SSL_CTX_set_verify(clientCtx, SSL_VERIFY_NONE, nullptr);
+    // Clients only keep the sessions from TLS 1.3 tickets with this set
+    SSL_CTX_set_session_cache_mode(clientCtx, SSL_SESS_CACHE_CLIENT);
+
+    HandshakeCounters& counters = handshakeCounters();
+    uint64_t full = counters.full;
+    uint64_t resumed = counters.resumed;
+
+    SSL_SESSION* session = nullptr;
+    SSL* first = handshake(serverCtx.native_handle(), clientCtx, nullptr,
+                           &session);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(SSL_session_reused(first), 0);
+    countHandshake(first);
+    SSL_shutdown(first);
+    SSL_free(first);
+
+    SSL_SESSION* unused = nullptr;
+    SSL* second = handshake(serverCtx.native_handle(), clientCtx, session,
+                            &unused);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(SSL_session_reused(second), 1);
+    countHandshake(second);
+    SSL_shutdown(second);
+    SSL_free(second);
+
+    EXPECT_EQ(counters.full, full + 1);
+    EXPECT_EQ(counters.resumed, resumed + 1);
+
+    SSL_SESSION_free(unused);
+    SSL_SESSION_free(session);
+    SSL_CTX_free(clientCtx);
+}
+
+} // namespace
+} // namespace ensuressl